@@ -0,0 +1,81 @@
+#include <chrono>
+#include <codac>
+
+using namespace std;
+using namespace codac2;
+
+// Compares the evaluation (and contraction) of a function on a set of boxes,
+// either box by box or with a single batch evaluation. The best time over
+// several runs is reported: the values allocated for the evaluations are
+// then reused from one run to the other, as in a paver loop.
+
+template<typename F>
+double duration_ms(const F& f, int nb_runs = 5)
+{
+  double t = oo;
+  for(int i = 0 ; i < nb_runs ; i++)
+  {
+    auto t0 = chrono::steady_clock::now();
+    f();
+    t = min(t, chrono::duration<double,milli>(chrono::steady_clock::now()-t0).count());
+  }
+  return t;
+}
+
+int main()
+{
+  const size_t n = 100000;
+
+  for(Index dim = 2 ; dim <= 6 ; dim += 2)
+  {
+    VectorVar x(dim);
+    ScalarExpr e = sqr(x[0]);
+    for(Index i = 1 ; i < dim ; i++)
+      e = e + sqr(x[i])*sin(x[i-1]);
+    AnalyticFunction f { {x}, e };
+
+    vector<IntervalVector> b(n, IntervalVector(dim));
+    for(auto& bk : b)
+      bk = IntervalVector(Vector::random(dim)).inflate(1e-2);
+
+    cout << "dim=" << dim << ", " << n << " boxes (box by box / batch)" << endl;
+
+    for(const auto& [m,s] : { make_pair(EvalMode::NATURAL,"natural"), make_pair(EvalMode::DEFAULT,"default") })
+    {
+      vector<Interval> y1(n), y2;
+
+      double t1 = duration_ms([&]() {
+        for(size_t k = 0 ; k < n ; k++)
+          y1[k] = f.eval(m, b[k]);
+      });
+
+      double t2 = duration_ms([&]() {
+        y2 = f.eval_batch(m, b);
+      });
+
+      cout << "  eval (" << s << "):\t" << t1 << " ms / " << t2 << " ms"
+           << (y1 == y2 ? "" : "  [different results]") << endl;
+    }
+
+    for(bool with_centered_form : { false, true })
+    {
+      CtcInverse c(f, Interval(0,0.5), with_centered_form);
+      vector<IntervalVector> b1, b2;
+
+      double t1 = duration_ms([&]() {
+        b1 = b;
+        for(auto& bk : b1)
+          c.contract(bk);
+      });
+
+      double t2 = duration_ms([&]() {
+        b2 = b;
+        c.contract_batch(b2);
+      });
+
+      cout << "  contract (" << (with_centered_form ? "centered" : "natural") << "):\t"
+           << t1 << " ms / " << t2 << " ms"
+           << (b1 == b2 ? "" : "  [different results]") << endl;
+    }
+  }
+}
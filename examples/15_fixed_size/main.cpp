@@ -0,0 +1,80 @@
+#include <chrono>
+#include <codac>
+
+using namespace std;
+using namespace codac2;
+
+// Paving throughput of the boundary of a polygon, with contractors on its edges
+// either based on fixed-size 2d boxes (IntervalVector_<2>, as in CtcSegment) or
+// on dynamic IntervalVector temporaries (heap-allocated on each contraction).
+// The best time over several runs is reported.
+
+class CtcSegmentDynamic : public Ctc<CtcSegmentDynamic,IntervalVector>
+{
+  public:
+
+    CtcSegmentDynamic(const Segment& ab)
+      : Ctc<CtcSegmentDynamic,IntervalVector>(2), _ab(ab)
+    { }
+
+    void contract(IntervalVector& x) const
+    {
+      IntervalVector a(_ab[0]), b(_ab[1]);
+      x &= a | b;
+      IntervalVector c = a-x, d = b-a;
+      IntervalMatrix m(2,2);
+      m.col(0) = d; m.col(1) = c;
+      DetOp::bwd(0.,m);
+      d &= m.col(0); c &= m.col(1);
+      SubOp::bwd(c[0],a[0],x[0]);
+      SubOp::bwd(c[1],a[1],x[1]);
+    }
+
+  protected:
+
+    const Segment _ab;
+};
+
+template<typename F>
+double duration_ms(const F& f, int nb_runs = 5)
+{
+  double t = oo;
+  for(int i = 0 ; i < nb_runs ; i++)
+  {
+    auto t0 = chrono::steady_clock::now();
+    f();
+    t = min(t, chrono::duration<double,milli>(chrono::steady_clock::now()-t0).count());
+  }
+  return t;
+}
+
+int main()
+{
+  Polygon p({{3,-1},{3,4},{5,6},{-1,1},{0,-2},{2,0}});
+  IntervalVector x0({{-2,6},{-3,7}});
+
+  CtcUnion<IntervalVector> c_fixed(2), c_dynamic(2);
+  for(const auto& e : p.edges())
+  {
+    c_fixed |= CtcSegment(e);
+    c_dynamic |= CtcSegmentDynamic(e);
+  }
+
+  for(double eps : { 1e-2, 2e-3, 5e-4 })
+  {
+    size_t n_fixed = 0, n_dynamic = 0;
+
+    double t_fixed = duration_ms([&]() {
+      n_fixed = pave(x0, c_fixed, eps).boxes(PavingOut::outer).size();
+    });
+
+    double t_dynamic = duration_ms([&]() {
+      n_dynamic = pave(x0, c_dynamic, eps).boxes(PavingOut::outer).size();
+    });
+
+    cout << "eps=" << eps << ", " << n_fixed << " boxes (fixed-size / dynamic): "
+         << t_fixed << " ms / " << t_dynamic << " ms, "
+         << (int)(n_fixed/t_fixed) << " / " << (int)(n_dynamic/t_dynamic) << " boxes/ms"
+         << (n_fixed == n_dynamic ? "" : "  [different pavings]") << endl;
+  }
+}
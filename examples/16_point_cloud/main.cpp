@@ -0,0 +1,69 @@
+#include <chrono>
+#include <random>
+#include <codac>
+
+using namespace std;
+using namespace codac2;
+
+// Contraction time of CtcPointCloud with respect to the size of the cloud, compared
+// with an exhaustive contraction visiting all the points (as done before the
+// points were indexed in a BoxTree). The contracted boxes are small compared to the
+// map, as in a localization paver.
+
+template<typename F>
+double duration_ms(const F& f, int nb_runs = 5)
+{
+  double t = oo;
+  for(int i = 0 ; i < nb_runs ; i++)
+  {
+    auto t0 = chrono::steady_clock::now();
+    f();
+    t = min(t, chrono::duration<double,milli>(chrono::steady_clock::now()-t0).count());
+  }
+  return t;
+}
+
+int main()
+{
+  mt19937 gen(42);
+  uniform_real_distribution<double> d(-1000.,1000.);
+
+  vector<IntervalVector> x0;
+  for(int k = 0 ; k < 1000 ; k++)
+    x0.push_back(IntervalVector(Vector({d(gen),d(gen)})).inflate(10.));
+
+  for(int n : { 1000, 10000, 100000 })
+  {
+    vector<IntervalVector> p;
+    for(int i = 0 ; i < n ; i++)
+      p.push_back(IntervalVector(Vector({d(gen),d(gen)})).inflate(0.5));
+
+    CtcPointCloud c(p);
+    double v_tree = 0., v_loop = 0.;
+
+    double t_tree = duration_ms([&]() {
+      v_tree = 0.;
+      for(const auto& xk : x0)
+      {
+        IntervalVector x = xk;
+        c.contract(x);
+        v_tree += x.is_empty() ? 0. : x.volume();
+      }
+    });
+
+    double t_loop = duration_ms([&]() {
+      v_loop = 0.;
+      for(const auto& xk : x0)
+      {
+        auto x = IntervalVector::empty(2);
+        for(const auto& pi : p)
+          x |= xk & pi;
+        v_loop += x.is_empty() ? 0. : x.volume();
+      }
+    }, 1);
+
+    cout << n << " points, " << x0.size() << " contractions (tree / exhaustive): "
+         << t_tree << " ms / " << t_loop << " ms"
+         << (v_tree == v_loop ? "" : "  [different contractions]") << endl;
+  }
+}
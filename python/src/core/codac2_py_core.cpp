@@ -34,6 +34,7 @@ void export_OctaSym(py::module& m);
 
 // contractors
 py::class_<CtcBase<IntervalVector>,pyCtcIntervalVector> export_CtcIntervalVector(py::module& m);
+void export_ContractorNetwork(py::module& m);
 void export_CtcAction(py::module& m, py::class_<CtcBase<IntervalVector>,pyCtcIntervalVector>& ctc);
 void export_CtcCartProd(py::module& m, py::class_<CtcBase<IntervalVector>,pyCtcIntervalVector>& ctc);
 void export_CtcConstell(py::module& m, py::class_<CtcBase<IntervalVector>,pyCtcIntervalVector>& ctc);
@@ -69,6 +70,7 @@ py::class_<IntervalRow> export_IntervalRow(py::module& m);
 py::class_<IntervalVector> export_IntervalVector(py::module& m);
 py::class_<IntervalMatrix> export_IntervalMatrix(py::module& m);
 void export_Paving(py::module& m);
+void export_CompactPaving(py::module& m);
 void export_PavingNode(py::module& m);
 void export_Subpaving(py::module& m);
 void export_Zonotope(py::module& m);
@@ -150,6 +152,7 @@ void export_SepWrapper(py::module& m, py::class_<SepBase,pySep>& sep);
 
 // tools
 void export_Approx(py::module& m);
+void export_ChunkedFile(py::module& m);
 void export_RobotSimulator(py::module& m);
 void export_serialization(py::module& m);
 void export_transformations(py::module& m);
@@ -175,6 +178,7 @@ PYBIND11_MODULE(_core, m)
 
   // contractors
   auto py_ctc_iv = export_CtcIntervalVector(m);
+  export_ContractorNetwork(m);
   export_CtcAction(m, py_ctc_iv);
   export_CtcCartProd(m, py_ctc_iv);
   export_CtcConstell(m, py_ctc_iv);
@@ -248,6 +252,7 @@ PYBIND11_MODULE(_core, m)
   export_Paving(m);
   export_PavingNode(m);
   export_Subpaving(m);
+  export_CompactPaving(m);
 
   export_Zonotope(m);
   export_Parallelepiped(m);
@@ -316,6 +321,7 @@ PYBIND11_MODULE(_core, m)
 
   // tools
   export_Approx(m);
+  export_ChunkedFile(m);
   export_serialization(m);
   export_transformations(m);
   export_trunc(m);
@@ -0,0 +1,172 @@
+/** 
+ *  Codac binding (core)
+ * ----------------------------------------------------------------------------
+ *  \date       2025
+ *  \author     Simon Rohou
+ *  \copyright  Copyright 2025 Codac Team
+ *  \license    GNU Lesser General Public License (LGPL)
+ */
+
+#include <pybind11/pybind11.h>
+#include <pybind11/operators.h>
+#include <pybind11/stl.h>
+#include <codac2_ContractorNetwork.h>
+#include "codac2_py_Ctc.h"
+#include "codac2_py_ContractorNetwork_docs.h" // Generated file from Doxygen XML (doxygen2docstring.py):
+#include "codac2_py_cast.h"
+
+using namespace std;
+using namespace codac2;
+namespace py = pybind11;
+using namespace pybind11::literals;
+
+void export_ContractorNetwork(py::module& m)
+{
+  py::class_<ContractorNetwork::Subvector>(m, "ContractorNetwork_Subvector", CONTRACTORNETWORK_SUBVECTOR_MAIN);
+
+  py::class_<ContractorNetwork::Stats>(m, "ContractorNetwork_Stats", CONTRACTORNETWORK_STATS_MAIN)
+
+    .def_readonly("nb_calls", &ContractorNetwork::Stats::nb_calls)
+    .def_readonly("time", &ContractorNetwork::Stats::time)
+  ;
+
+  py::class_<ContractorNetwork> exported(m, "ContractorNetwork", CONTRACTORNETWORK_MAIN);
+  exported
+
+    .def(py::init<double>(),
+      CONTRACTORNETWORK_CONTRACTORNETWORK_DOUBLE,
+      "ratio"_a = 0.1)
+
+    .def_static("subvector", &ContractorNetwork::subvector,
+      STATIC_SUBVECTOR_CONTRACTORNETWORK_SUBVECTOR_INTERVALVECTOR_REF_INDEX_INDEX,
+      py::keep_alive<0,1>(), "x"_a, "start_id"_a, "end_id"_a)
+
+    // The domains are referenced by the network, and kept alive with it
+
+    .def("add", [](ContractorNetwork& cn, const pyCtcIntervalVector& c, IntervalVector& x)
+        {
+          return cn.add(c.copy(), x);
+        },
+      SIZET_CONTRACTORNETWORK_ADD_CONST_C_REF_X_REF_REF_VARIADIC,
+      py::keep_alive<1,2>(), py::keep_alive<1,3>(), "c"_a, "x"_a)
+
+    .def("add", [](ContractorNetwork& cn, const pyCtcIntervalVector& c, const ContractorNetwork::Subvector& x)
+        {
+          return cn.add(c.copy(), x);
+        },
+      SIZET_CONTRACTORNETWORK_ADD_CONST_C_REF_X_REF_REF_VARIADIC,
+      py::keep_alive<1,2>(), py::keep_alive<1,3>(), "c"_a, "x"_a)
+
+    .def("add", [](ContractorNetwork& cn, const pyCtcIntervalVector& c, py::object& x)
+        {
+          assert_release(is_instance<SlicedTube<IntervalVector>>(x) && "add: invalid domain type");
+          return cn.add(c.copy(), cast<SlicedTube<IntervalVector>>(x));
+        },
+      SIZET_CONTRACTORNETWORK_ADD_CONST_C_REF_X_REF_REF_VARIADIC,
+      py::keep_alive<1,2>(), py::keep_alive<1,3>(), "c"_a, "x"_a)
+
+    // Several domains: as for the functions of several variables,
+    // the contractor is applied on the Cartesian product of the domains
+
+    .def("add", [](py::object& cn, const pyCtcIntervalVector& c, const py::args& x)
+        {
+          assert_release(x.size() > 1 && "add: at least two domains are expected");
+
+          std::vector<ContractorNetwork::Subvector> d;
+          for(const auto& xi_ : x)
+          {
+            py::object xi = py::reinterpret_borrow<py::object>(xi_);
+            assert_release((is_instance<IntervalVector>(xi) || is_instance<ContractorNetwork::Subvector>(xi))
+              && "add: invalid domain type");
+
+            if(is_instance<IntervalVector>(xi))
+            {
+              IntervalVector& v = xi.cast<IntervalVector&>();
+              d.push_back(ContractorNetwork::subvector(v, 0, v.size()-1));
+            }
+
+            else
+              d.push_back(xi.cast<ContractorNetwork::Subvector>());
+
+            py::detail::keep_alive_impl(cn, xi); // the domains are kept alive with the network
+          }
+
+          std::vector<ContractorNetwork::DomainRef> d_ref(d.begin(), d.end());
+          return cn.cast<ContractorNetwork&>().add([c_ = c.copy(),d]()
+            {
+              Index n = 0;
+              for(const auto& di : d)
+                n += di.end_id-di.start_id+1;
+
+              IntervalVector y(n);
+              Index i = 0;
+              for(const auto& di : d)
+              {
+                y.put(i, di.x.subvector(di.start_id,di.end_id));
+                i += di.end_id-di.start_id+1;
+              }
+
+              c_->contract(y);
+
+              i = 0;
+              for(const auto& di : d)
+              {
+                di.x.segment(di.start_id,di.end_id-di.start_id+1) = y.subvector(i,i+di.end_id-di.start_id);
+                i += di.end_id-di.start_id+1;
+              }
+            },
+            d_ref, d_ref);
+        },
+      SIZET_CONTRACTORNETWORK_ADD_CONST_C_REF_X_REF_REF_VARIADIC,
+      py::keep_alive<1,2>(), "c"_a)
+
+    .def("add", [](py::object& cn, const py::function& f, const py::list& read, const py::list& written)
+        {
+          auto domain_ref = [&cn](const py::handle& xi) -> ContractorNetwork::DomainRef
+          {
+            py::object x = py::reinterpret_borrow<py::object>(xi);
+            py::detail::keep_alive_impl(cn, x);
+
+            if(is_instance<Interval>(x))
+              return x.cast<Interval&>();
+            else if(is_instance<IntervalVector>(x))
+              return x.cast<IntervalVector&>();
+            else if(is_instance<ContractorNetwork::Subvector>(x))
+              return x.cast<ContractorNetwork::Subvector>();
+            else if(is_instance<SlicedTube<Interval>>(x))
+              return x.cast<SlicedTube<Interval>&>();
+            assert_release(is_instance<SlicedTube<IntervalVector>>(x) && "add: invalid domain type");
+            return x.cast<SlicedTube<IntervalVector>&>();
+          };
+
+          std::vector<ContractorNetwork::DomainRef> read_, written_;
+          for(const auto& xi : read)
+            read_.push_back(domain_ref(xi));
+          for(const auto& xi : written)
+            written_.push_back(domain_ref(xi));
+
+          py::detail::keep_alive_impl(cn, f);
+          return cn.cast<ContractorNetwork&>().add(
+            std::function<void()>([f]() { f(); }),
+            read_, written_);
+        },
+      SIZET_CONTRACTORNETWORK_ADD_CONST_FUNCTION_VOID___REF_CONST_VECTOR_DOMAINREF_REF_CONST_VECTOR_DOMAINREF_REF,
+      "f"_a, "read"_a, "written"_a)
+
+    .def("nb_ctc", &ContractorNetwork::nb_ctc,
+      SIZET_CONTRACTORNETWORK_NB_CTC_CONST)
+
+    .def("nb_dom", &ContractorNetwork::nb_dom,
+      SIZET_CONTRACTORNETWORK_NB_DOM_CONST)
+
+    .def("trigger_all_contractors", &ContractorNetwork::trigger_all_contractors,
+      VOID_CONTRACTORNETWORK_TRIGGER_ALL_CONTRACTORS)
+
+    .def("contract", &ContractorNetwork::contract,
+      VOID_CONTRACTORNETWORK_CONTRACT)
+
+    .def("stats", &ContractorNetwork::stats,
+      CONST_STATS_REF_CONTRACTORNETWORK_STATS_SIZET_CONST,
+      py::return_value_policy::reference_internal, "i"_a)
+  ;
+}
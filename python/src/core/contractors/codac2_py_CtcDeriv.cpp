@@ -58,5 +58,48 @@ void export_CtcDeriv(py::module& m)
       VOID_CTCDERIV_CONTRACT_SLICEDTUBE_T_REF_CONST_SLICEDTUBE_T_REF_CONST_VECTOR_INDEX_REF_CONST,
       "x"_a, "v"_a, "ctc_indices"_a=std::vector<Index>())
 
+    .def("parallel_contract", [](const CtcDeriv& ctc, py::object& x, const py::object& v, std::size_t nb_threads, const std::vector<Index_type>& ctc_indices)
+        {
+          if(is_instance<SlicedTube<Interval>>(x) && is_instance<SlicedTube<Interval>>(v))
+          {
+            auto& x_ = cast<SlicedTube<Interval>>(x);
+            const auto& v_ = cast<SlicedTube<Interval>>(v);
+            py::gil_scoped_release release;
+            ctc.parallel_contract(x_, v_, nb_threads);
+          }
+
+          else if(is_instance<SlicedTube<IntervalVector>>(x) && is_instance<SlicedTube<IntervalVector>>(v))
+          {
+            auto& x_ = cast<SlicedTube<IntervalVector>>(x);
+            const auto& v_ = cast<SlicedTube<IntervalVector>>(v);
+            auto ctc_indices_ = matlab::convert_indices(ctc_indices);
+            py::gil_scoped_release release;
+            ctc.parallel_contract(x_, v_, nb_threads, ctc_indices_);
+          }
+
+          else {
+            assert_release("parallel_contract: invalid tube types");
+          }
+        },
+      VOID_CTCDERIV_PARALLEL_CONTRACT_SLICEDTUBE_T_REF_CONST_SLICEDTUBE_T_REF_SIZET_CONST_VECTOR_INDEX_REF_CONST,
+      "x"_a, "v"_a, "nb_threads"_a=0, "ctc_indices"_a=std::vector<Index>())
+
+    .def("contract_incremental", [](const CtcDeriv& ctc, py::object& x, const py::object& v, const std::vector<Index_type>& ctc_indices)
+        {
+          if(is_instance<SlicedTube<Interval>>(x) && is_instance<SlicedTube<Interval>>(v))
+            return ctc.contract_incremental(cast<SlicedTube<Interval>>(x), cast<SlicedTube<Interval>>(v));
+
+          else if(is_instance<SlicedTube<IntervalVector>>(x) && is_instance<SlicedTube<IntervalVector>>(v))
+            return ctc.contract_incremental(cast<SlicedTube<IntervalVector>>(x), cast<SlicedTube<IntervalVector>>(v),
+              matlab::convert_indices(ctc_indices));
+
+          else {
+            assert_release("contract_incremental: invalid tube types");
+            return (Index)0;
+          }
+        },
+      INDEX_CTCDERIV_CONTRACT_INCREMENTAL_SLICEDTUBE_T_REF_CONST_SLICEDTUBE_T_REF_CONST_VECTOR_INDEX_REF_CONST,
+      "x"_a, "v"_a, "ctc_indices"_a=std::vector<Index>())
+
   ;
 }
\ No newline at end of file
@@ -65,6 +65,28 @@ void export_CtcInverse(py::module& m, const std::string& export_name, py::class_
       VOID_CTCBASE_X_CONTRACT_TUBE_SLICEDTUBE_X_REF_VARIADIC_CONST,
       "x"_a)
 
+    .def("parallel_contract_tube", [](const C& c, py::object& x1, std::size_t nb_threads) -> py::object&
+        {
+          if(!is_instance<SlicedTube<IntervalVector>>(x1)) {
+            assert_release("parallel_contract_tube: invalid tube type");
+          }
+
+          auto& x1_ = cast<SlicedTube<IntervalVector>>(x1);
+          py::gil_scoped_release release;
+          c.parallel_contract_tube(nb_threads, x1_);
+          return x1;
+        },
+      VOID_CTCBASE_X_PARALLEL_CONTRACT_TUBE_SIZET_SLICEDTUBE_X_REF_VARIADIC_CONST,
+      "x"_a, "nb_threads"_a=0)
+
+    .def("contract_batch", [](const C& c, std::vector<IntervalVector> x)
+        {
+          c.contract_batch(x);
+          return x;
+        },
+      VOID_CTCINVERSE_YX_CONTRACT_BATCH_VECTOR_TUPLE_ELEMENT_T_0TUPLE_X_VARIADIC_REF_CONST,
+      "x"_a)
+
     .def("function", &C::function,
       CONST_ANALYTICFUNCTION_TYPENAME_EXPRTYPE_Y_TYPE_REF_CTCINVERSE_YX_FUNCTION_CONST)
     
@@ -0,0 +1,159 @@
+/** 
+ *  Codac binding (core)
+ * ----------------------------------------------------------------------------
+ *  \date       2025
+ *  \author     Simon Rohou
+ *  \copyright  Copyright 2025 Codac Team
+ *  \license    GNU Lesser General Public License (LGPL)
+ */
+
+#include <pybind11/pybind11.h>
+#include <pybind11/operators.h>
+#include <pybind11/stl.h>
+#include <pybind11/functional.h>
+#include <codac2_CompactPaving.h>
+#include "codac2_py_CompactPaving_docs.h" // Generated file from Doxygen XML (doxygen2docstring.py):
+
+using namespace std;
+using namespace codac2;
+namespace py = pybind11;
+using namespace pybind11::literals;
+
+
+template<typename P,typename... X>
+void export_compact_paving_base(py::class_<P>& c)
+{
+  c
+
+    .def("size", &CompactPaving<P,X...>::size,
+      INDEX_COMPACTPAVING_PX_SIZE_CONST)
+
+    .def("nb_nodes", &CompactPaving<P,X...>::nb_nodes,
+      SIZET_COMPACTPAVING_PX_NB_NODES_CONST)
+
+    .def("reserve", &CompactPaving<P,X...>::reserve,
+      VOID_COMPACTPAVING_PX_RESERVE_SIZET,
+      "nb_nodes"_a)
+
+    // The nodes are handles on the paving, which is kept alive with them
+    .def("tree", &CompactPaving<P,X...>::tree,
+      NODE__COMPACTPAVING_PX_TREE_CONST,
+      py::keep_alive<0,1>())
+
+    .def("boxes", (std::list<IntervalVector>(CompactPaving<P,X...>::*)(const typename CompactPaving<P,X...>::NodeValue_&) const) &CompactPaving<P,X...>::boxes,
+      LIST_INTERVALVECTOR_COMPACTPAVING_PX_BOXES_CONST_NODEVALUE__REF_CONST,
+      "node_value"_a)
+
+    .def("boxes", (std::list<IntervalVector>(CompactPaving<P,X...>::*)(const typename CompactPaving<P,X...>::NodeValue_&,const IntervalVector&) const) &CompactPaving<P,X...>::boxes,
+      LIST_INTERVALVECTOR_COMPACTPAVING_PX_BOXES_CONST_NODEVALUE__REF_CONST_INTERVALVECTOR_REF_CONST,
+      "node_value"_a, "x"_a)
+
+  ;
+}
+
+template<typename P>
+void export_compact_paving_node(py::module& m, const std::string& name)
+{
+  using N = CompactPavingNode<P>;
+
+  py::class_<N>(m, name.c_str(), COMPACTPAVINGNODE_MAIN)
+
+    .def("__bool__", [](const N& n) { return (bool)n; })
+
+    .def("index", &N::index,
+      NODEINDEX__COMPACTPAVINGNODE_P_INDEX_CONST)
+
+    .def("paving", &N::paving,
+      CONST_P_REF_COMPACTPAVINGNODE_P_PAVING_CONST,
+      py::return_value_policy::reference)
+
+    .def("boxes", &N::boxes,
+      TYPENAME_P_NODETUPLE__COMPACTPAVINGNODE_P_BOXES_CONST)
+
+    .def("hull", &N::hull,
+      INTERVALVECTOR_COMPACTPAVINGNODE_P_HULL_CONST)
+
+    .def("unknown", &N::unknown,
+      INTERVALVECTOR_COMPACTPAVINGNODE_P_UNKNOWN_CONST)
+
+    .def("top", &N::top,
+      COMPACTPAVINGNODE_P_COMPACTPAVINGNODE_P_TOP_CONST,
+      py::keep_alive<0,1>())
+
+    .def("left", &N::left,
+      COMPACTPAVINGNODE_P_COMPACTPAVINGNODE_P_LEFT_CONST,
+      py::keep_alive<0,1>())
+
+    .def("right", &N::right,
+      COMPACTPAVINGNODE_P_COMPACTPAVINGNODE_P_RIGHT_CONST,
+      py::keep_alive<0,1>())
+
+    .def("is_leaf", &N::is_leaf,
+      BOOL_COMPACTPAVINGNODE_P_IS_LEAF_CONST)
+
+    .def("visit", &N::visit,
+      VOID_COMPACTPAVINGNODE_P_VISIT_CONST_FUNCTION_BOOL_CONST_COMPACTPAVINGNODE_P_REF__REF_CONST,
+      "visitor"_a)
+
+    .def(py::self == py::self)
+
+  ;
+}
+
+void export_CompactPaving(py::module& m)
+{
+  export_compact_paving_node<CompactPavingOut>(m, "CompactPavingOut_Node");
+  export_compact_paving_node<CompactPavingInOut>(m, "CompactPavingInOut_Node");
+
+  py::class_<CompactPavingOut> exported_paving_out(m, "CompactPavingOut", COMPACTPAVINGOUT_MAIN);
+  export_compact_paving_base<CompactPavingOut,IntervalVector>(exported_paving_out);
+  exported_paving_out
+
+    .def(py::init<Index>(),
+      COMPACTPAVINGOUT_COMPACTPAVINGOUT_INDEX,
+      "n"_a)
+
+    .def(py::init<const IntervalVector&>(),
+      COMPACTPAVINGOUT_COMPACTPAVINGOUT_CONST_INTERVALVECTOR_REF,
+      "x"_a)
+
+    .def(py::init<const PavingOut&>(),
+      COMPACTPAVINGOUT_COMPACTPAVINGOUT_CONST_PAVINGOUT_REF,
+      "p"_a)
+
+    .def_readonly_static("outer", &CompactPavingOut::outer,
+      STATIC_CONST_NODEVALUE__COMPACTPAVINGOUT_OUTER)
+    .def_readonly_static("outer_complem", &CompactPavingOut::outer_complem,
+      STATIC_CONST_NODEVALUE__COMPACTPAVINGOUT_OUTER_COMPLEM)
+
+  ;
+
+  py::class_<CompactPavingInOut> exported_paving_inout(m, "CompactPavingInOut", COMPACTPAVINGINOUT_MAIN);
+  export_compact_paving_base<CompactPavingInOut,IntervalVector,IntervalVector>(exported_paving_inout);
+  exported_paving_inout
+
+    .def(py::init<Index>(),
+      COMPACTPAVINGINOUT_COMPACTPAVINGINOUT_INDEX,
+      "n"_a)
+
+    .def(py::init<const IntervalVector&>(),
+      COMPACTPAVINGINOUT_COMPACTPAVINGINOUT_CONST_INTERVALVECTOR_REF,
+      "x"_a)
+
+    .def(py::init<const PavingInOut&>(),
+      COMPACTPAVINGINOUT_COMPACTPAVINGINOUT_CONST_PAVINGINOUT_REF,
+      "p"_a)
+
+    .def_readonly_static("outer", &CompactPavingInOut::outer,
+      STATIC_CONST_NODEVALUE__COMPACTPAVINGINOUT_OUTER)
+    .def_readonly_static("outer_complem", &CompactPavingInOut::outer_complem,
+      STATIC_CONST_NODEVALUE__COMPACTPAVINGINOUT_OUTER_COMPLEM)
+    .def_readonly_static("inner", &CompactPavingInOut::inner,
+      STATIC_CONST_NODEVALUE__COMPACTPAVINGINOUT_INNER)
+    .def_readonly_static("bound", &CompactPavingInOut::bound,
+      STATIC_CONST_NODEVALUE__COMPACTPAVINGINOUT_BOUND)
+    .def_readonly_static("all", &CompactPavingInOut::all,
+      STATIC_CONST_NODEVALUE__COMPACTPAVINGINOUT_ALL)
+
+  ;
+}
@@ -116,6 +116,16 @@ void export_SlicedTube(py::module& m, const std::string& name)
         },
       INTERVAL_SLICEDTUBE_T_INVERT_CONST_T_REF_CONST_SLICEDTUBE_T_REF_CONST_INTERVAL_REF_CONST,
       "y"_a, "v_t"_a, "t"_a=Interval())
+
+    .def("enable_hull_index", &SlicedTube<T>::enable_hull_index,
+      VOID_SLICEDTUBE_T_ENABLE_HULL_INDEX_BOOL,
+      "enable"_a=true)
+
+    .def("has_hull_index", &SlicedTube<T>::has_hull_index,
+      BOOL_SLICEDTUBE_T_HAS_HULL_INDEX_CONST)
+
+    .def("update_hull_index", &SlicedTube<T>::update_hull_index,
+      VOID_SLICEDTUBE_T_UPDATE_HULL_INDEX)
     
     .def("set", (void (SlicedTube<T>::*)(const T&)) &SlicedTube<T>::set,
       VOID_SLICEDTUBE_T_SET_CONST_T_REF,
@@ -60,6 +60,14 @@ void export_TDomain(py::module& m)
       VOID_TDOMAIN_SAMPLE_CONST_INTERVAL_REF_DOUBLE_BOOL,
       "t0_tf"_a, "dt"_a, "with_gate"_a=false)
 
+    .def("truncate", [](TDomain& tdomain, double t) -> std::shared_ptr<TSlice>
+        {
+          auto it = tdomain.truncate(t);
+          return std::shared_ptr<TSlice>(&(*it), [](TSlice*){});
+        },
+      LIST_TSLICE_ITERATOR_TDOMAIN_TRUNCATE_DOUBLE,
+      "t"_a)
+
     .def("delete_gates", &TDomain::delete_gates,
       VOID_TDOMAIN_DELETE_GATES)
 
@@ -333,6 +333,23 @@ void export_AnalyticFunction(py::module& m, const std::string& export_name)
   bind_(exported, "eval", eval, T_DOMAIN_ANALYTICFUNCTION_T_EVAL_CONST_ARGS_REF_VARIADIC_CONST);
   bind_(exported, "diff", diff, AUTO_ANALYTICFUNCTION_T_DIFF_CONST_ARGS_REF_VARIADIC_CONST);
 
+  exported
+
+    // Batch evaluations, for functions of one argument
+    .def("eval_batch", [](const AnalyticFunction<T>& f, const EvalMode& m, const std::vector<Interval>& x) { return f.eval_batch(m,x); },
+      VECTOR_TYPENAME_T_DOMAIN_ANALYTICFUNCTION_T_EVAL_BATCH_CONST_EVALMODE_REF_CONST_VECTOR_D_REF_CONST, "m"_a, "x"_a)
+    .def("eval_batch", [](const AnalyticFunction<T>& f, const EvalMode& m, const std::vector<IntervalVector>& x) { return f.eval_batch(m,x); },
+      VECTOR_TYPENAME_T_DOMAIN_ANALYTICFUNCTION_T_EVAL_BATCH_CONST_EVALMODE_REF_CONST_VECTOR_D_REF_CONST, "m"_a, "x"_a)
+    .def("eval_batch", [](const AnalyticFunction<T>& f, const EvalMode& m, const std::vector<IntervalMatrix>& x) { return f.eval_batch(m,x); },
+      VECTOR_TYPENAME_T_DOMAIN_ANALYTICFUNCTION_T_EVAL_BATCH_CONST_EVALMODE_REF_CONST_VECTOR_D_REF_CONST, "m"_a, "x"_a)
+    .def("eval_batch", [](const AnalyticFunction<T>& f, const std::vector<Interval>& x) { return f.eval_batch(x); },
+      VECTOR_TYPENAME_T_DOMAIN_ANALYTICFUNCTION_T_EVAL_BATCH_CONST_VECTOR_D_REF_CONST, "x"_a)
+    .def("eval_batch", [](const AnalyticFunction<T>& f, const std::vector<IntervalVector>& x) { return f.eval_batch(x); },
+      VECTOR_TYPENAME_T_DOMAIN_ANALYTICFUNCTION_T_EVAL_BATCH_CONST_VECTOR_D_REF_CONST, "x"_a)
+    .def("eval_batch", [](const AnalyticFunction<T>& f, const std::vector<IntervalMatrix>& x) { return f.eval_batch(x); },
+      VECTOR_TYPENAME_T_DOMAIN_ANALYTICFUNCTION_T_EVAL_BATCH_CONST_VECTOR_D_REF_CONST, "x"_a)
+  ;
+
   if constexpr(std::is_same_v<T,ScalarType> || std::is_same_v<T,VectorType>)
   {
     exported
@@ -347,6 +364,19 @@ void export_AnalyticFunction(py::module& m, const std::string& export_name)
           },
         AUTO_ANALYTICFUNCTION_T_TUBE_EVAL_CONST_SLICEDTUBE_ARGS_REF_VARIADIC_CONST,
         "x1"_a)
+
+      .def("parallel_tube_eval", [](const AnalyticFunction<T>& f, const py::object& x1, std::size_t nb_threads) {
+
+            if(!is_instance<SlicedTube<typename T::Domain>>(x1)) {
+              assert_release("parallel_tube_eval: invalid tube type");
+            }
+
+            const auto& x1_ = cast<SlicedTube<typename T::Domain>>(x1);
+            py::gil_scoped_release release;
+            return f.parallel_tube_eval(nb_threads, x1_);
+          },
+        AUTO_ANALYTICFUNCTION_T_PARALLEL_TUBE_EVAL_SIZET_CONST_SLICEDTUBE_ARGS_REF_VARIADIC_CONST,
+        "x1"_a, "nb_threads"_a=0)
     ;
   }
 
@@ -66,4 +66,20 @@ void export_Polygon(py::module& m)
   ;
 
   py::implicitly_convertible<py::list,Polygon>();
+
+  py::class_<IndexedPolygon> exported_indexed(m, "IndexedPolygon", INDEXEDPOLYGON_MAIN);
+  exported_indexed
+
+    .def(py::init<const Polygon&>(),
+      INDEXEDPOLYGON_INDEXEDPOLYGON_CONST_POLYGON_REF,
+      "p"_a)
+
+    .def("polygon", &IndexedPolygon::polygon,
+      CONST_POLYGON_REF_INDEXEDPOLYGON_POLYGON_CONST)
+
+    .def("contains", &IndexedPolygon::contains,
+      BOOLINTERVAL_INDEXEDPOLYGON_CONTAINS_CONST_INTERVALVECTOR_REF_CONST,
+      "p"_a)
+
+  ;
 }
\ No newline at end of file
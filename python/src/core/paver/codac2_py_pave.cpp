@@ -34,6 +34,24 @@ void export_pave(py::module& m)
     PAVINGINOUT_PAVE_CONST_INTERVALVECTOR_REF_CONST_SEPBASE_REF_DOUBLE_BOOL,
     "x"_a, "s"_a, "eps"_a, "verbose"_a=false);
 
+  m.def("parallel_pave", (PavingOut (*)(const IntervalVector&,const CtcBase<IntervalVector>&,double,std::size_t,bool))&codac2::parallel_pave,
+    PAVINGOUT_PARALLEL_PAVE_CONST_INTERVALVECTOR_REF_CONST_CTCBASE_INTERVALVECTOR_REF_DOUBLE_SIZET_BOOL,
+    "x"_a, "c"_a, "eps"_a, "nb_threads"_a=0, "verbose"_a=false,
+    py::call_guard<py::gil_scoped_release>());
+
+  m.def("parallel_pave", (PavingInOut (*)(const IntervalVector&,const SepBase&,double,std::size_t,bool))&codac2::parallel_pave,
+    PAVINGINOUT_PARALLEL_PAVE_CONST_INTERVALVECTOR_REF_CONST_SEPBASE_REF_DOUBLE_SIZET_BOOL,
+    "x"_a, "s"_a, "eps"_a, "nb_threads"_a=0, "verbose"_a=false,
+    py::call_guard<py::gil_scoped_release>());
+
+  m.def("compact_pave", (CompactPavingOut (*)(const IntervalVector&,const CtcBase<IntervalVector>&,double,bool))&codac2::compact_pave,
+    COMPACTPAVINGOUT_COMPACT_PAVE_CONST_INTERVALVECTOR_REF_CONST_CTCBASE_INTERVALVECTOR_REF_DOUBLE_BOOL,
+    "x"_a, "c"_a, "eps"_a, "verbose"_a=false);
+
+  m.def("compact_pave", (CompactPavingInOut (*)(const IntervalVector&,const SepBase&,double,bool))&codac2::compact_pave,
+    COMPACTPAVINGINOUT_COMPACT_PAVE_CONST_INTERVALVECTOR_REF_CONST_SEPBASE_REF_DOUBLE_BOOL,
+    "x"_a, "s"_a, "eps"_a, "verbose"_a=false);
+
   m.def("regular_pave", &codac2::regular_pave,
     PAVINGINOUT_REGULAR_PAVE_CONST_INTERVALVECTOR_REF_CONST_FUNCTION_BOOLINTERVAL_CONST_INTERVALVECTOR_REF__REF_DOUBLE_BOOL,
     "x"_a, "test"_a, "eps"_a, "verbose"_a=false);
@@ -0,0 +1,140 @@
+/**
+ *  Codac binding (core)
+ * ----------------------------------------------------------------------------
+ *  \date       2025
+ *  \author     Simon Rohou
+ *  \copyright  Copyright 2025 Codac Team
+ *  \license    GNU Lesser General Public License (LGPL)
+ */
+
+#include <pybind11/pybind11.h>
+#include <pybind11/operators.h>
+#include <pybind11/stl.h>
+#include <codac2_ChunkedFile.h>
+#include "codac2_py_ChunkedFile_docs.h" // Generated file from Doxygen XML (doxygen2docstring.py):
+#include "codac2_py_cast.h"
+
+using namespace std;
+using namespace codac2;
+namespace py = pybind11;
+using namespace pybind11::literals;
+
+void export_ChunkedFile(py::module& m)
+{
+  py::enum_<ChunkedFileContent>(m, "ChunkedFileContent")
+
+    .value("SAMPLED_TRAJ", ChunkedFileContent::SAMPLED_TRAJ)
+    .value("SLICED_TUBE", ChunkedFileContent::SLICED_TUBE)
+  ;
+
+  py::enum_<ChunkedFileValueType>(m, "ChunkedFileValueType")
+
+    .value("SCALAR", ChunkedFileValueType::SCALAR)
+    .value("VECTOR", ChunkedFileValueType::VECTOR)
+    .value("MATRIX", ChunkedFileValueType::MATRIX)
+  ;
+
+  py::class_<ChunkedFileWriter> exported_writer(m, "ChunkedFileWriter", CHUNKEDFILEWRITER_MAIN);
+  exported_writer
+
+    .def(py::init<const string&,bool>(),
+      CHUNKEDFILEWRITER_CHUNKEDFILEWRITER_CONST_STRING_REF_BOOL,
+      "file_path"_a, "append"_a = false)
+
+    .def("write", [](ChunkedFileWriter& w, const SampledTraj<double>& x, size_t first)
+        {
+          w.write(x, first);
+        },
+      VOID_CHUNKEDFILEWRITER_WRITE_CONST_SAMPLEDTRAJ_T_REF_SIZET,
+      "x"_a, "first"_a = 0)
+
+    .def("write", [](ChunkedFileWriter& w, const SampledTraj<Vector>& x, size_t first)
+        {
+          w.write(x, first);
+        },
+      VOID_CHUNKEDFILEWRITER_WRITE_CONST_SAMPLEDTRAJ_T_REF_SIZET,
+      "x"_a, "first"_a = 0)
+
+    .def("write", [](ChunkedFileWriter& w, const SampledTraj<Matrix>& x, size_t first)
+        {
+          w.write(x, first);
+        },
+      VOID_CHUNKEDFILEWRITER_WRITE_CONST_SAMPLEDTRAJ_T_REF_SIZET,
+      "x"_a, "first"_a = 0)
+
+    .def("write", [](ChunkedFileWriter& w, const py::object& x, size_t first)
+        {
+          if(is_instance<SlicedTube<Interval>>(x))
+            w.write(cast<SlicedTube<Interval>>(x), first);
+
+          else if(is_instance<SlicedTube<IntervalVector>>(x))
+            w.write(cast<SlicedTube<IntervalVector>>(x), first);
+
+          else if(is_instance<SlicedTube<IntervalMatrix>>(x))
+            w.write(cast<SlicedTube<IntervalMatrix>>(x), first);
+
+          else {
+            assert_release("write: invalid tube type");
+          }
+        },
+      VOID_CHUNKEDFILEWRITER_WRITE_CONST_SLICEDTUBE_T_REF_SIZET,
+      "x"_a, "first"_a = 0)
+  ;
+
+  py::class_<ChunkedFileReader> exported_reader(m, "ChunkedFileReader", CHUNKEDFILEREADER_MAIN);
+  exported_reader
+
+    .def(py::init<const string&>(),
+      CHUNKEDFILEREADER_CHUNKEDFILEREADER_CONST_STRING_REF,
+      "file_path"_a)
+
+    .def("refresh", &ChunkedFileReader::refresh,
+      BOOL_CHUNKEDFILEREADER_REFRESH)
+
+    .def("content", &ChunkedFileReader::content,
+      CHUNKEDFILECONTENT_CHUNKEDFILEREADER_CONTENT_CONST)
+
+    .def("value_type", &ChunkedFileReader::value_type,
+      CHUNKEDFILEVALUETYPE_CHUNKEDFILEREADER_VALUE_TYPE_CONST)
+
+    .def("nb_chunks", &ChunkedFileReader::nb_chunks,
+      SIZET_CHUNKEDFILEREADER_NB_CHUNKS_CONST)
+
+    .def("nb_records", &ChunkedFileReader::nb_records,
+      SIZET_CHUNKEDFILEREADER_NB_RECORDS_CONST)
+
+    .def("tdomain", &ChunkedFileReader::tdomain,
+      INTERVAL_CHUNKEDFILEREADER_TDOMAIN_CONST)
+
+    // The type of the returned objects is given by the header of the file
+
+    .def("sampled_traj", [](const ChunkedFileReader& r, const Interval& t) -> py::object
+        {
+          switch(r.value_type())
+          {
+            case ChunkedFileValueType::SCALAR:
+              return py::cast(r.sampled_traj<double>(t));
+            case ChunkedFileValueType::VECTOR:
+              return py::cast(r.sampled_traj<Vector>(t));
+            default:
+              return py::cast(r.sampled_traj<Matrix>(t));
+          }
+        },
+      SAMPLEDTRAJ_T_CHUNKEDFILEREADER_SAMPLED_TRAJ_CONST_INTERVAL_REF_CONST,
+      "t"_a = Interval())
+
+    .def("sliced_tube", [](const ChunkedFileReader& r) -> py::object
+        {
+          switch(r.value_type())
+          {
+            case ChunkedFileValueType::SCALAR:
+              return py::cast(r.sliced_tube<Interval>());
+            case ChunkedFileValueType::VECTOR:
+              return py::cast(r.sliced_tube<IntervalVector>());
+            default:
+              return py::cast(r.sliced_tube<IntervalMatrix>());
+          }
+        },
+      SLICEDTUBE_T_CHUNKEDFILEREADER_SLICED_TUBE_CONST)
+  ;
+}
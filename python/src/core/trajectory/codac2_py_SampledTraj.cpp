@@ -121,7 +121,9 @@ py::class_<SampledTraj<T>> _export_SampledTraj(py::module& m, const string& clas
 
     .def("__iter__", [](const SampledTraj<T>& x)
         {
-          return py::make_iterator(x.begin(), x.end());
+          // The samples (t,x) are provided as copies of the values of the trajectory
+          using It = typename SampledTraj<T>::const_iterator;
+          return py::make_iterator<py::return_value_policy::copy,It,It,std::pair<double,T>>(x.begin(), x.end());
         },
         py::keep_alive<0, 1>()) // essential: keep object alive while iterator exists
 
@@ -147,6 +149,16 @@ py::class_<SampledTraj<T>> _export_SampledTraj(py::module& m, const string& clas
       SAMPLEDTRAJ_T_REF_SAMPLEDTRAJ_T_STRETCH_TDOMAIN_CONST_INTERVAL_REF,
       "tdomain"_a)
 
+    .def("reserve", &SampledTraj<T>::reserve,
+      VOID_SAMPLEDTRAJ_T_RESERVE_SIZET,
+      "n"_a)
+
+    .def("times", &SampledTraj<T>::times,
+      CONST_VECTOR_DOUBLE_REF_SAMPLEDTRAJ_T_TIMES_CONST)
+
+    .def("values", &SampledTraj<T>::values,
+      CONST_VECTOR_DOUBLE_REF_SAMPLEDTRAJ_T_VALUES_CONST)
+
     .def("__call__", [](const SampledTraj<T>& x, double t) -> T
         {
           return x(t);
@@ -161,10 +173,24 @@ py::class_<SampledTraj<T>> _export_SampledTraj(py::module& m, const string& clas
       VIRTUAL_WRAPPER_T_DOMAIN_SAMPLEDTRAJ_T_OPERATORCALL_CONST_INTERVAL_REF_CONST,
       "t"_a)
 
+    .def("invert", &SampledTraj<T>::invert,
+      INTERVAL_SAMPLEDTRAJ_T_INVERT_CONST_WRAPPER_T_DOMAIN_REF_CONST_INTERVAL_REF_CONST,
+      "y"_a, "t"_a=Interval())
+
     .def("set", &SampledTraj<T>::set,
       VOID_SAMPLEDTRAJ_T_SET_CONST_T_REF_DOUBLE,
       "xi"_a, "ti"_a)
 
+    .def("enable_hull_index", &SampledTraj<T>::enable_hull_index,
+      VOID_SAMPLEDTRAJ_T_ENABLE_HULL_INDEX_BOOL,
+      "enable"_a=true)
+
+    .def("has_hull_index", &SampledTraj<T>::has_hull_index,
+      BOOL_SAMPLEDTRAJ_T_HAS_HULL_INDEX_CONST)
+
+    .def("update_hull_index", &SampledTraj<T>::update_hull_index,
+      VOID_SAMPLEDTRAJ_T_UPDATE_HULL_INDEX)
+
     .def("as_function", &SampledTraj<T>::as_function,
       ANALYTICFUNCTION_TYPE_SAMPLEDTRAJ_T_AS_FUNCTION_CONST)
 
@@ -119,6 +119,16 @@ void export_Figure2D(py::module& m)
   
     .def("set_tdomain", &Figure2D::set_tdomain,
       VOID_FIGURE2D_SET_TDOMAIN_CONST_INTERVAL_REF)
+  
+    .def("set_lod_tolerance", &Figure2D::set_lod_tolerance,
+      VOID_FIGURE2D_SET_LOD_TOLERANCE_DOUBLE,
+      "tolerance"_a)
+  
+    .def("lod_tolerance", &Figure2D::lod_tolerance,
+      DOUBLE_FIGURE2D_LOD_TOLERANCE_CONST)
+  
+    .def("nb_lod_suppressed_shapes", &Figure2D::nb_lod_suppressed_shapes,
+      SIZET_FIGURE2D_NB_LOD_SUPPRESSED_SHAPES_CONST)
 
     // Geometric shapes
 
@@ -314,6 +324,26 @@ void export_Figure2D(py::module& m)
       VOID_FIGURE2D_DRAW_PAVING_CONST_PAVINGINOUT_REF_CONST_PAVINGSTYLE_REF,
       "p"_a, "draw_box"_a, "style"_a=PavingStyle::default_style())
 
+    .def("draw_paving", (void(Figure2D::*)(const CompactPavingOut&,const PavingStyle&))&Figure2D::draw_paving,
+      VOID_FIGURE2D_DRAW_PAVING_CONST_COMPACTPAVINGOUT_REF_CONST_PAVINGSTYLE_REF,
+      "p"_a, "style"_a=PavingStyle::default_style())
+
+    .def("draw_paving", (void(Figure2D::*)(const CompactPavingOut&,
+        const std::function<void(Figure2D&,const IntervalVector&,const StyleProperties&)>&,
+        const PavingStyle&))&Figure2D::draw_paving,
+      VOID_FIGURE2D_DRAW_PAVING_CONST_COMPACTPAVINGOUT_REF_CONST_FUNCTION_VOID_FIGURE2D_REFCONST_INTERVALVECTOR_REFCONST_STYLEPROPERTIES_REF__REF_CONST_PAVINGSTYLE_REF,
+      "p"_a, "draw_box"_a, "style"_a=PavingStyle::default_style())
+
+    .def("draw_paving", (void(Figure2D::*)(const CompactPavingInOut&,const PavingStyle&))&Figure2D::draw_paving,
+      VOID_FIGURE2D_DRAW_PAVING_CONST_COMPACTPAVINGINOUT_REF_CONST_PAVINGSTYLE_REF,
+      "p"_a, "style"_a=PavingStyle::default_style())
+
+    .def("draw_paving", (void(Figure2D::*)(const CompactPavingInOut&,
+        const std::function<void(Figure2D&,const IntervalVector&,const StyleProperties&)>&,
+        const PavingStyle&))&Figure2D::draw_paving,
+      VOID_FIGURE2D_DRAW_PAVING_CONST_COMPACTPAVINGINOUT_REF_CONST_FUNCTION_VOID_FIGURE2D_REFCONST_INTERVALVECTOR_REFCONST_STYLEPROPERTIES_REF__REF_CONST_PAVINGSTYLE_REF,
+      "p"_a, "draw_box"_a, "style"_a=PavingStyle::default_style())
+
 
     .def("pave", (void(Figure2D::*)(const IntervalVector& x0, const CtcBase<IntervalVector>& c, double eps,
         const PavingStyle&))&Figure2D::pave,
@@ -550,6 +580,28 @@ void export_Figure2D(py::module& m)
       STATIC_VOID_DEFAULTFIGURE_DRAW_PAVING_CONST_PAVINGINOUT_REF_CONST_PAVINGSTYLE_REF,
       "p"_a, "draw_box"_a, "style"_a=PavingStyle::default_style())
 
+    .def_static("draw_paving", (void(*)(const CompactPavingOut&,
+        const PavingStyle&))&DefaultFigure::draw_paving,
+      STATIC_VOID_DEFAULTFIGURE_DRAW_PAVING_CONST_COMPACTPAVINGOUT_REF_CONST_PAVINGSTYLE_REF,
+      "p"_a, "style"_a=PavingStyle::default_style())
+
+    .def_static("draw_paving", (void(*)(const CompactPavingOut&,
+        const std::function<void(Figure2D&,const IntervalVector&,const StyleProperties&)>& draw_box,
+        const PavingStyle&))&DefaultFigure::draw_paving,
+      STATIC_VOID_DEFAULTFIGURE_DRAW_PAVING_CONST_COMPACTPAVINGOUT_REF_CONST_FUNCTION_VOID_FIGURE2D_REFCONST_INTERVALVECTOR_REFCONST_STYLEPROPERTIES_REF__REF_CONST_PAVINGSTYLE_REF,
+      "p"_a, "draw_box"_a, "style"_a=PavingStyle::default_style())
+
+    .def_static("draw_paving", (void(*)(const CompactPavingInOut&,
+        const PavingStyle&))&DefaultFigure::draw_paving,
+      STATIC_VOID_DEFAULTFIGURE_DRAW_PAVING_CONST_COMPACTPAVINGINOUT_REF_CONST_PAVINGSTYLE_REF,
+      "p"_a, "style"_a=PavingStyle::default_style())
+
+    .def_static("draw_paving", (void(*)(const CompactPavingInOut&,
+        const std::function<void(Figure2D&,const IntervalVector&,const StyleProperties&)>& draw_box,
+        const PavingStyle&))&DefaultFigure::draw_paving,
+      STATIC_VOID_DEFAULTFIGURE_DRAW_PAVING_CONST_COMPACTPAVINGINOUT_REF_CONST_FUNCTION_VOID_FIGURE2D_REFCONST_INTERVALVECTOR_REFCONST_STYLEPROPERTIES_REF__REF_CONST_PAVINGSTYLE_REF,
+      "p"_a, "draw_box"_a, "style"_a=PavingStyle::default_style())
+
 
     .def_static("pave", (void (*)(const IntervalVector& x0, const CtcBase<IntervalVector>& c, double eps,
         const PavingStyle&))&DefaultFigure::pave,
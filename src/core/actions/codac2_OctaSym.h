@@ -75,7 +75,7 @@ namespace codac2
       SampledTraj<T> operator()(const SampledTraj<T>& x) const
       {
         auto y = x;
-        for(auto& [ti,yi] : y)
+        for(auto&& [ti,yi] : y)
           yi = (*this)(yi);
         return y;
       }
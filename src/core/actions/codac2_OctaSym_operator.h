@@ -102,6 +102,49 @@ namespace codac2
         std::get<0>(this->_x)->bwd_eval(v);
       }
 
+      void compile(AnalyticTape& t) const
+      {
+        std::get<0>(this->_x)->compile(t);
+        t.add_step(*this, 1);
+      }
+
+      void fwd_eval_step(ValuesSlots& v, const Index* s, [[maybe_unused]] Index total_input_size, bool natural_eval) const
+      {
+        if(natural_eval)
+          AnalyticExpr<VectorType>::init_value(
+            v, s[0], OctaSymOp::fwd_natural(_s, AnalyticExpr<VectorType>::value(v, s[1])));
+        else
+          AnalyticExpr<VectorType>::init_value(
+            v, s[0], OctaSymOp::fwd_centered(_s, AnalyticExpr<VectorType>::value(v, s[1])));
+      }
+
+      void bwd_eval_step(ValuesSlots& v, const Index* s) const
+      {
+        OctaSymOp::bwd(_s, AnalyticExpr<VectorType>::value(v, s[0]).a, AnalyticExpr<VectorType>::value(v, s[1]).a);
+      }
+
+      void fwd_eval_batch_step(ValuesSlots& v, const Index* s, Index n, [[maybe_unused]] Index total_input_size, bool natural_eval) const
+      {
+        auto& x1 = AnalyticExpr<VectorType>::batch_value(v, s[1]);
+        if(natural_eval)
+          AnalyticExpr<VectorType>::init_batch_value(
+            v, s[0], n, [&](Index k) { return OctaSymOp::fwd_natural(_s, x1.get(k)); });
+        else
+          AnalyticExpr<VectorType>::init_batch_value(
+            v, s[0], n, [&](Index k) { return OctaSymOp::fwd_centered(_s, x1.get(k)); });
+      }
+
+      void bwd_eval_batch_step(ValuesSlots& v, const Index* s) const
+      {
+        bwd_batch([&](auto& y, auto& x1) { OctaSymOp::bwd(_s, y, x1); },
+          AnalyticExpr<VectorType>::batch_value(v, s[0]), AnalyticExpr<VectorType>::batch_value(v, s[1]));
+      }
+
+      bool is_same_operation(const AnalyticExprBase& e) const
+      {
+        return dynamic_cast<const AnalyticOperationExpr<OctaSymOp,VectorType,VectorType>&>(e)._s == _s;
+      }
+
       std::pair<Index,Index> output_shape() const {
         return { _s.size(), 1 };
       }
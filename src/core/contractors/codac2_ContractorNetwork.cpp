@@ -0,0 +1,183 @@
+/** 
+ *  codac2_ContractorNetwork.cpp
+ * ----------------------------------------------------------------------------
+ *  \date       2025
+ *  \author     Simon Rohou
+ *  \copyright  Copyright 2025 Codac Team
+ *  \license    GNU Lesser General Public License (LGPL)
+ */
+
+#include <chrono>
+#include "codac2_ContractorNetwork.h"
+
+using namespace std;
+using namespace codac2;
+
+ContractorNetwork::DomainRef::DomainRef(Interval& x)
+  : _begin(reinterpret_cast<uintptr_t>(&x)), _end(_begin+sizeof(Interval)),
+    _measure([&x]() { Measure m; add_to_measure(m, x); return m; })
+{ }
+
+ContractorNetwork::DomainRef::DomainRef(IntervalVector& x)
+  : _begin(reinterpret_cast<uintptr_t>(x.data())), _end(_begin+x.size()*sizeof(Interval)),
+    _measure([&x]() { Measure m; add_to_measure(m, x); return m; })
+{ }
+
+ContractorNetwork::DomainRef::DomainRef(const Subvector& x)
+  : _begin(reinterpret_cast<uintptr_t>(x.x.data()+x.start_id)),
+    _end(reinterpret_cast<uintptr_t>(x.x.data()+x.end_id+1)),
+    _measure([x]()
+      {
+        Measure m;
+        for(Index i = x.start_id ; i <= x.end_id ; i++)
+          add_to_measure(m, x.x[i]);
+        return m;
+      })
+{ }
+
+bool ContractorNetwork::DomainRef::overlaps(const DomainRef& x) const
+{
+  return _begin < x._end && x._begin < _end;
+}
+
+bool ContractorNetwork::DomainRef::operator==(const DomainRef& x) const
+{
+  return _begin == x._begin && _end == x._end;
+}
+
+ContractorNetwork::Measure ContractorNetwork::DomainRef::measure() const
+{
+  return _measure();
+}
+
+ContractorNetwork::ContractorNetwork(double ratio)
+  : _r(ratio)
+{
+  assert_release(ratio >= 0. && ratio < 1.);
+}
+
+ContractorNetwork::Subvector ContractorNetwork::subvector(IntervalVector& x, Index start_id, Index end_id)
+{
+  assert_release(end_id >= 0 && start_id >= 0);
+  assert_release(end_id < x.size() && start_id <= end_id);
+  return { x, start_id, end_id };
+}
+
+size_t ContractorNetwork::add(const function<void()>& f,
+  const vector<DomainRef>& read, const vector<DomainRef>& written)
+{
+  Contractor c { f, {}, {} };
+  for(const auto& xi : read)
+    c.read.push_back(domain_id(xi));
+  for(const auto& xi : written)
+    c.written.push_back(domain_id(xi));
+
+  size_t k = _ctcs.size();
+  _ctcs.push_back(c);
+  _stats.push_back({});
+  _queued.push_back(false);
+
+  for(size_t i = 0 ; i < _domains.size() ; i++)
+    for(size_t j : c.read)
+      if(_domains[i].overlaps(_domains[j]))
+      {
+        _readers[i].push_back(k);
+        break;
+      }
+
+  enqueue(k);
+  return k;
+}
+
+size_t ContractorNetwork::domain_id(const DomainRef& x)
+{
+  for(size_t i = 0 ; i < _domains.size() ; i++)
+    if(_domains[i] == x)
+      return i;
+
+  // New domain: the existing contractors reading an overlapping domain depend on it
+  vector<size_t> readers;
+  for(size_t k = 0 ; k < _ctcs.size() ; k++)
+    for(size_t j : _ctcs[k].read)
+      if(_domains[j].overlaps(x))
+      {
+        readers.push_back(k);
+        break;
+      }
+
+  _domains.push_back(x);
+  _readers.push_back(readers);
+  return _domains.size()-1;
+}
+
+size_t ContractorNetwork::nb_ctc() const
+{
+  return _ctcs.size();
+}
+
+size_t ContractorNetwork::nb_dom() const
+{
+  return _domains.size();
+}
+
+void ContractorNetwork::enqueue(size_t i)
+{
+  if(!_queued[i])
+  {
+    _queued[i] = true;
+    _queue.push_back(i);
+  }
+}
+
+void ContractorNetwork::trigger_all_contractors()
+{
+  for(size_t i = 0 ; i < _ctcs.size() ; i++)
+    enqueue(i);
+}
+
+void ContractorNetwork::contract()
+{
+  vector<Measure> m;
+
+  while(!_queue.empty())
+  {
+    size_t k = _queue.front();
+    _queue.pop_front();
+    _queued[k] = false;
+    const Contractor& c = _ctcs[k];
+
+    m.clear();
+    for(size_t i : c.written)
+      m.push_back(_domains[i].measure());
+
+    auto t_start = chrono::steady_clock::now();
+    c.f();
+    _stats[k].nb_calls++;
+    _stats[k].time += chrono::duration<double>(chrono::steady_clock::now()-t_start).count();
+
+    for(size_t i = 0 ; i < c.written.size() ; i++)
+    {
+      Measure mi = _domains[c.written[i]].measure();
+
+      if(mi.empty)
+      {
+        for(size_t j : _queue)
+          _queued[j] = false;
+        _queue.clear();
+        return;
+      }
+
+      if(mi.nb_unbounded < m[i].nb_unbounded
+        || (mi.nb_unbounded == m[i].nb_unbounded && mi.diam < (1.-_r)*m[i].diam))
+        for(size_t j : _readers[c.written[i]])
+          if(j != k)
+            enqueue(j);
+    }
+  }
+}
+
+const ContractorNetwork::Stats& ContractorNetwork::stats(size_t i) const
+{
+  assert_release(i < _stats.size());
+  return _stats[i];
+}
@@ -0,0 +1,315 @@
+/**
+ *  \file codac2_ContractorNetwork.h
+ * ----------------------------------------------------------------------------
+ *  \date       2025
+ *  \author     Simon Rohou
+ *  \copyright  Copyright 2025 Codac Team
+ *  \license    GNU Lesser General Public License (LGPL)
+ */
+
+#pragma once
+
+#include <deque>
+#include <vector>
+#include <cstdint>
+#include <functional>
+#include "codac2_Ctc.h"
+#include "codac2_SlicedTube.h"
+
+namespace codac2
+{
+  /**
+   * \class ContractorNetwork
+   * \brief Propagation of contractions over a network of contractors and domains.
+   *
+   * Each contractor is registered with the domains it reads and the domains it writes.
+   * The contractors are called from a queue, following an AC3-like algorithm: after a call,
+   * only the other contractors reading a domain that has been significantly contracted are
+   * queued again. The propagation ends when the queue is empty, or when a domain becomes empty.
+   * Contractors can be added between two propagations: they are then queued.
+   *
+   * A domain is significantly contracted when it becomes empty, when one of its unbounded
+   * components becomes bounded, or when the sum of the diameters of its bounded components
+   * (over all the slices, for a tube) is reduced by more than the fixed point ratio.
+   *
+   * Domains are referenced by the network: they must not be destroyed nor resized while
+   * the network is used. Domains sharing memory, such as a vector and a subvector of it,
+   * are dependent.
+   */
+  class ContractorNetwork
+  {
+    public:
+
+      /**
+       * \brief Reference to the components of an interval vector between two indices
+       * (included), to be used as a domain of the network
+       */
+      struct Subvector
+      {
+        IntervalVector& x;
+        Index start_id, end_id;
+      };
+
+      /**
+       * \brief Size of a domain, used to detect significant contractions
+       */
+      struct Measure
+      {
+        bool empty = false;
+        size_t nb_unbounded = 0; // number of unbounded components
+        double diam = 0.; // sum of the diameters of the bounded components
+      };
+
+      /**
+       * \brief Reference to a domain of the network
+       *
+       * Possible domains are ``Interval``, ``IntervalVector``, ``Subvector``,
+       * ``SlicedTube<Interval>`` and ``SlicedTube<IntervalVector>`` objects.
+       */
+      class DomainRef
+      {
+        public:
+
+          DomainRef(Interval& x);
+          DomainRef(IntervalVector& x);
+          DomainRef(const Subvector& x);
+
+          template<typename T>
+            requires (std::is_same_v<T,Interval> || std::is_same_v<T,IntervalVector>)
+          DomainRef(SlicedTube<T>& x)
+            : _begin(reinterpret_cast<std::uintptr_t>(&x)), _end(_begin+sizeof(x)),
+              _measure([&x]()
+                {
+                  Measure m;
+                  for(const auto& s : x)
+                    add_to_measure(m, s.codomain());
+                  return m;
+                })
+          { }
+
+          /**
+           * \brief Tests if the two domains share memory
+           *
+           * \param x other domain
+           * \return ``true`` if the domains overlap
+           */
+          bool overlaps(const DomainRef& x) const;
+
+          /**
+           * \brief Tests if the two domains are the same
+           *
+           * \param x other domain
+           * \return ``true`` if the domains occupy the same memory
+           */
+          bool operator==(const DomainRef& x) const;
+
+          /**
+           * \brief Computes the current size of the domain
+           *
+           * \return measure of the domain
+           */
+          Measure measure() const;
+
+        protected:
+
+          std::uintptr_t _begin, _end; // memory occupied by the domain
+          std::function<Measure()> _measure;
+      };
+
+      /**
+       * \brief Statistics of the calls to a contractor
+       */
+      struct Stats
+      {
+        size_t nb_calls = 0;
+        double time = 0.; // total time spent in the contractor, in seconds
+      };
+
+      /**
+       * \brief Creates an empty network
+       *
+       * \param ratio fixed point ratio: a domain is significantly contracted when its size
+       *        is reduced by more than this ratio
+       */
+      explicit ContractorNetwork(double ratio = 0.1);
+
+      /**
+       * \brief Returns a reference to the components \f$i\f$ to \f$j\f$ of an interval vector,
+       * to be used as a domain of the network
+       *
+       * \param x interval vector
+       * \param start_id index of the first component
+       * \param end_id index of the last component
+       * \return reference to the subvector
+       */
+      static Subvector subvector(IntervalVector& x, Index start_id, Index end_id);
+
+      /**
+       * \brief Adds a contractor applied on some domains, read and written by the contractor
+       *
+       * The contractor is queued. If all the domains are tubes, the contractor is applied
+       * with ``contract_tube()``.
+       *
+       * \param c contractor (copied) or shared pointer to a contractor
+       * \param x domains (``Interval``, ``IntervalVector``, ``Subvector`` or ``SlicedTube`` objects)
+       * \return rank of the contractor in the network
+       */
+      template<typename C,typename... X>
+        requires (sizeof...(X) > 0 && !std::is_invocable_v<C>)
+      size_t add(const C& c, X&&... x)
+      {
+        static_assert(IsCtcBaseOrPtr<C,typename Arg<std::decay_t<X>>::Type...>,
+          "the contractor does not match the domains");
+        static_assert(((std::is_lvalue_reference_v<X> || std::is_same_v<std::decay_t<X>,Subvector>) && ...),
+          "the domains must be lvalues");
+        static_assert((Arg<std::decay_t<X>>::is_tube && ...) || (!Arg<std::decay_t<X>>::is_tube && ...),
+          "the domains must be either all tubes or no tubes");
+
+        std::shared_ptr<CtcBase<typename Arg<std::decay_t<X>>::Type...>> c_;
+        if constexpr(std::is_base_of_v<CtcBase<typename Arg<std::decay_t<X>>::Type...>,C>)
+          c_ = c.copy();
+        else
+          c_ = c;
+
+        std::vector<DomainRef> d { DomainRef(x)... };
+
+        return add([c_,args = std::make_tuple(Arg<std::decay_t<X>>(x)...)]() mutable
+          {
+            std::apply([&c_](auto&... a)
+              {
+                if constexpr((Arg<std::decay_t<X>>::is_tube && ...))
+                  c_->contract_tube(a.value()...);
+                else
+                  c_->contract(a.value()...);
+                (a.update(), ...);
+              }, args);
+          },
+          d, d);
+      }
+
+      /**
+       * \brief Adds a contraction procedure, with the domains it reads and writes
+       *
+       * The procedure is queued.
+       *
+       * \param f contraction procedure
+       * \param read domains read by the procedure: it is queued again when one of
+       *        them is significantly contracted
+       * \param written domains written by the procedure
+       * \return rank of the procedure in the network
+       */
+      size_t add(const std::function<void()>& f,
+        const std::vector<DomainRef>& read, const std::vector<DomainRef>& written);
+
+      /**
+       * \brief Returns the number of contractors of the network
+       *
+       * \return number of contractors
+       */
+      size_t nb_ctc() const;
+
+      /**
+       * \brief Returns the number of domains of the network
+       *
+       * \return number of domains
+       */
+      size_t nb_dom() const;
+
+      /**
+       * \brief Queues all the contractors of the network
+       */
+      void trigger_all_contractors();
+
+      /**
+       * \brief Calls the queued contractors until the queue is empty, or until a domain
+       * becomes empty
+       */
+      void contract();
+
+      /**
+       * \brief Returns the statistics of the calls to a contractor
+       *
+       * \param i rank of the contractor
+       * \return statistics
+       */
+      const Stats& stats(size_t i) const;
+
+    protected:
+
+      // Domain given to a contractor, with the type expected by the contractor
+      template<typename X,typename = void>
+      struct Arg
+      {
+        using Type = X;
+        static constexpr bool is_tube = false;
+
+        Arg(X& x_) : x(x_) { }
+        X& value() { return x; }
+        void update() { }
+
+        X& x;
+      };
+
+      template<typename T,typename V>
+      struct Arg<SlicedTube<T>,V>
+      {
+        using Type = T;
+        static constexpr bool is_tube = true;
+
+        Arg(SlicedTube<T>& x_) : x(x_) { }
+        SlicedTube<T>& value() { return x; }
+        void update() { }
+
+        SlicedTube<T>& x;
+      };
+
+      template<typename V>
+      struct Arg<Subvector,V>
+      {
+        using Type = IntervalVector;
+        static constexpr bool is_tube = false;
+
+        Arg(const Subvector& x_) : x(x_) { }
+        IntervalVector& value() { v = x.x.subvector(x.start_id,x.end_id); return v; }
+        void update() { x.x.segment(x.start_id,x.end_id-x.start_id+1) = v; }
+
+        Subvector x;
+        IntervalVector v = IntervalVector(1);
+      };
+
+      template<typename D>
+      static void add_to_measure(Measure& m, const D& x)
+      {
+        if constexpr(std::is_same_v<D,Interval>)
+        {
+          if(x.is_empty())
+            m.empty = true;
+          else if(x.is_unbounded())
+            m.nb_unbounded++;
+          else
+            m.diam += x.diam();
+        }
+
+        else
+          for(Index i = 0 ; i < x.size() ; i++)
+            add_to_measure(m, x[i]);
+      }
+
+      size_t domain_id(const DomainRef& x);
+      void enqueue(size_t i);
+
+      struct Contractor
+      {
+        std::function<void()> f;
+        std::vector<size_t> read, written; // ranks of the domains
+      };
+
+      const double _r;
+      std::vector<Contractor> _ctcs;
+      std::vector<Stats> _stats;
+      std::vector<DomainRef> _domains;
+      std::vector<std::vector<size_t>> _readers; // for each domain, contractors reading a domain overlapping it
+      std::deque<size_t> _queue;
+      std::vector<bool> _queued;
+  };
+}
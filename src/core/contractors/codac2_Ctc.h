@@ -21,6 +21,19 @@ namespace codac2
   template<typename T>
   class SlicedTube;
 
+  /**
+   * \class CtcBase
+   * \brief Base class of the contractors.
+   *
+   * \note Thread safety: the method ``contract()`` is ``const`` and may be called
+   * concurrently on different domains, for instance by ``parallel_pave()``.
+   * Implementations must therefore not modify any state shared between calls
+   * (mutable members, static or global variables) without synchronization,
+   * and the sub-contractors they hold must satisfy the same requirement.
+   * Contractors relying on a global pseudo-random generator (such as
+   * ``CtcCtcBoundary``, reseeding ``std::rand``) remain sound when called
+   * concurrently, but their results may then depend on the thread scheduling.
+   */
   template<typename... X>
   class CtcBase
   {
@@ -46,6 +59,12 @@ namespace codac2
       virtual void contract_tube(SlicedTube<X>&... x) const;
       // -> is defined in codac2_SlicedTube.h
 
+      // Parallel version: the slices are contracted by nb_threads threads (0 for the number
+      // of hardware threads), with the same result as contract_tube(). See the thread-safety
+      // requirements above.
+      void parallel_contract_tube(std::size_t nb_threads, SlicedTube<X>&... x) const;
+      // -> is defined in codac2_SlicedTube.h
+
       virtual std::shared_ptr<CtcBase<X...>> copy() const = 0;
 
     protected:
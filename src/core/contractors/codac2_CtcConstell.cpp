@@ -21,8 +21,5 @@ CtcConstell::CtcConstell(const std::vector<IntervalVector>& M)
 void CtcConstell::contract(IntervalVector& x) const
 {
   assert_release(x.size() == this->size());
-  IntervalVector u = IntervalVector::empty(this->size());
-  for(const auto& mi : _M)
-    u |= x & mi;
-  x = u;
+  x = _M.hull_of_intersections(x);
 }
\ No newline at end of file
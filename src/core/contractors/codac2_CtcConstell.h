@@ -12,11 +12,16 @@
 #include <vector>
 #include "codac2_Ctc.h"
 #include "codac2_IntervalVector.h"
+#include "codac2_BoxTree.h"
 
 namespace codac2
 {
   /**
    * \class CtcConstell
+   * \brief Contracts a box on the hull of its intersections with the boxes of a constellation.
+   *
+   * The boxes of the constellation are indexed in a ``BoxTree`` when the contractor is
+   * created: a contraction only visits the boxes intersecting the contracted box.
    */
   class CtcConstell : public Ctc<CtcConstell,IntervalVector>
   {
@@ -31,6 +36,6 @@ namespace codac2
 
     protected:
 
-      const std::vector<IntervalVector> _M;
+      const BoxTree _M;
   };
 }
\ No newline at end of file
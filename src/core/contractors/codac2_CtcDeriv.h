@@ -9,11 +9,15 @@
 
 #pragma once
 
+#include <deque>
 #include <numeric>
+#include <unordered_set>
+#include <utility>
 #include "codac2_Ctc.h"
 #include "codac2_TimePropag.h"
 #include "codac2_ConvexPolygon.h"
 #include "codac2_TDomain.h"
+#include "codac2_parallel.h"
 
 namespace codac2
 {
@@ -43,7 +47,7 @@ namespace codac2
         
         T input = x.input_gate();
         T output = x.output_gate();
-        T envelope = x.codomain();
+        T envelope = std::as_const(x).codomain();
 
         if constexpr(std::is_same_v<T,Interval>)
           contract(x.t0_tf(), envelope, input, output, v.codomain(), _time_propag, _fast_mode);
@@ -62,11 +66,11 @@ namespace codac2
             contract(x.t0_tf(), envelope[i], input[i], output[i], v.codomain()[i], _time_propag, _fast_mode);
         }
 
-        auto x_next = x.next_slice();
+        auto x_next = x.next_slice_ptr();
         if(x_next && x_next->is_gate())
           x_next->set(output, false);
 
-        auto x_prev = x.prev_slice();
+        auto x_prev = x.prev_slice_ptr();
         if(x_prev && x_prev->is_gate())
           x_prev->set(input, false);
 
@@ -82,27 +86,282 @@ namespace codac2
         auto it_beg = x.tdomain()->sample(t.lb(),true);
         auto it_end = x.tdomain()->sample(t.ub(),true);
 
+        // The sweeps follow the links between adjacent slices,
+        // the slices of x and v being defined on the same tslices
+        Slice<T> *x_beg = x.slice(it_beg).get(), *x_end = x.slice(it_end).get();
+        const Slice<T> *v_beg = v.slice(it_beg).get(), *v_end = v.slice(it_end).get();
+
         if((_time_propag & TimePropag::FWD) == TimePropag::FWD)
         {
-          for(auto it = it_beg ; it != std::next(it_end) ; it++)
+          Slice<T>* sx = x_beg;
+          const Slice<T>* sv = v_beg;
+
+          while(true)
           {
-            auto sx = x.slice(it);
             if(!sx->is_gate())
-              this->contract(*sx, *v.slice(it), ctc_indices);
+              this->contract(*sx, *sv, ctc_indices);
+            if(sx == x_end)
+              break;
+            sx = sx->next_slice_ptr();
+            sv = sv->next_slice_ptr();
           }
         }
 
         if((_time_propag & TimePropag::BWD) == TimePropag::BWD)
         {
-          for(auto it = it_end ; it != std::prev(it_beg) ; it--)
+          Slice<T>* sx = x_end;
+          const Slice<T>* sv = v_end;
+
+          while(true)
           {
-            auto sx = x.slice(it);
             if(!sx->is_gate())
-              this->contract(*sx, *v.slice(it), ctc_indices);
+              this->contract(*sx, *sv, ctc_indices);
+            if(sx == x_beg)
+              break;
+            sx = sx->prev_slice_ptr();
+            sv = sv->prev_slice_ptr();
+          }
+        }
+      }
+
+      /**
+       * \brief Contraction of the tube \f$\llbracket x\rrbracket(\cdot)\f$ computed on several threads.
+       *
+       * The slices are split into chunks of adjacent slices, separated by single non-gate slices.
+       * The chunks are first contracted in parallel by forward/backward sweeps, the separating
+       * slices being left unchanged. The chunks are then reconciled: each separating slice is
+       * contracted, and its contraction is propagated to the adjacent slices (through gates
+       * if any) until it has no more effect.
+       *
+       * \note The result is guaranteed, since it is only obtained by contractions of slices,
+       * but it may slightly differ from the one of ``contract()`` (the contractions are not
+       * performed in the same order). The reconciliation is serial: when the contraction of a
+       * chunk has an effect over the following ones (for instance from an initial condition
+       * without other constraints), it is as long as a serial sweep.
+       *
+       * \param x tube to be contracted
+       * \param v derivative tube such that \f$\dot{x}(\cdot)\in\llbracket v\rrbracket(\cdot)\f$
+       * \param nb_threads number of threads, ``0`` for the number of hardware threads
+       * \param ctc_indices dimensions to be contracted (all the dimensions if empty)
+       */
+      template<typename T>
+      inline void parallel_contract(SlicedTube<T>& x, const SlicedTube<T>& v, std::size_t nb_threads = 0, const std::vector<Index>& ctc_indices = {}) const
+        requires std::is_same_v<T,Interval> || std::is_same_v<T,IntervalVector>
+      {
+        assert_release(TDomain::are_same(x.tdomain(), v.tdomain()));
+        Interval t = x.tdomain()->t0_tf() & _tdomain;
+        auto it_beg = x.tdomain()->sample(t.lb(),true);
+        auto it_end = x.tdomain()->sample(t.ub(),true);
+
+        if(nb_threads == 0)
+          nb_threads = default_nb_threads();
+
+        // Slices to be contracted, indexed for the split into chunks
+        std::vector<Slice<T>*> sx;
+        std::vector<const Slice<T>*> sv;
+        const Slice<T>* x_end = x.slice(it_end).get();
+        Slice<T>* sx_ = x.slice(it_beg).get();
+        const Slice<T>* sv_ = v.slice(it_beg).get();
+
+        while(true)
+        {
+          sx.push_back(sx_);
+          sv.push_back(sv_);
+          if(sx_ == x_end)
+            break;
+          sx_ = sx_->next_slice_ptr();
+          sv_ = sv_->next_slice_ptr();
+        }
+
+        // Separating slices: they must not be gates, as the gates
+        // are modified by the contractions of their adjacent slices
+        Index n = sx.size();
+        std::vector<Index> sep;
+        for(Index k = 1 ; k < (Index)nb_threads ; k++)
+        {
+          Index i = std::max(k*n/(Index)nb_threads, sep.empty() ? 0 : sep.back()+1);
+          while(i < n && sx[i]->is_gate())
+            i++;
+          if(i < n)
+            sep.push_back(i);
+        }
+
+        std::list<std::pair<Index,Index>> chunks;
+        for(size_t k = 0 ; k <= sep.size() ; k++)
+          chunks.push_back({ k == 0 ? 0 : sep[k-1]+1, k == sep.size() ? n : sep[k] });
+
+        work_stealing_process(std::move(chunks),
+          [&](const std::pair<Index,Index>& c, const auto&)
+          {
+            auto [a,b] = c;
+
+            if((_time_propag & TimePropag::FWD) == TimePropag::FWD)
+              for(Index i = a ; i < b ; i++)
+                if(!sx[i]->is_gate())
+                  this->contract(*sx[i], *sv[i], ctc_indices);
+
+            if((_time_propag & TimePropag::BWD) == TimePropag::BWD)
+              for(Index i = b-1 ; i >= a ; i--)
+                if(!sx[i]->is_gate())
+                  this->contract(*sx[i], *sv[i], ctc_indices);
+          },
+          nb_threads);
+
+        // Reconciliation, from the separating slices
+        std::deque<Index> queue(sep.begin(), sep.end());
+        std::vector<bool> queued(n, false);
+        for(const auto& i : sep)
+          queued[i] = true;
+
+        auto push = [&](Index i)
+        {
+          if(i >= 0 && i < n && !sx[i]->is_gate() && !queued[i])
+          {
+            queued[i] = true;
+            queue.push_back(i);
+          }
+        };
+
+        while(!queue.empty())
+        {
+          Index i = queue.front();
+          queue.pop_front();
+          queued[i] = false;
+
+          T codomain = std::as_const(*sx[i]).codomain();
+          T input = sx[i]->input_gate(), output = sx[i]->output_gate();
+          this->contract(*sx[i], *sv[i], ctc_indices);
+          bool modified = !(std::as_const(*sx[i]).codomain() == codomain);
+
+          if(i > 0)
+          {
+            if(!sx[i-1]->is_gate())
+            {
+              if(modified)
+                push(i-1);
+            }
+
+            else if(!(std::as_const(*sx[i-1]).codomain() == input))
+              push(i-2);
+          }
+
+          if(i < n-1)
+          {
+            if(!sx[i+1]->is_gate())
+            {
+              if(modified)
+                push(i+1);
+            }
+
+            else if(!(std::as_const(*sx[i+1]).codomain() == output))
+              push(i+2);
           }
         }
       }
 
+      /**
+       * \brief Incremental contraction of the tube \f$\llbracket x\rrbracket(\cdot)\f$: only the
+       * slices modified since the previous incremental contraction (see ``SliceBase::is_modified()``),
+       * and the slices adjacent to a modified gate, are contracted. Each contraction is then
+       * propagated to the adjacent slices, until it has no more effect. The tube is then
+       * at a fixpoint of the slice contractions.
+       *
+       * \note The tube \f$\llbracket v\rrbracket(\cdot)\f$ is assumed unchanged since the previous
+       * contraction of \f$\llbracket x\rrbracket(\cdot)\f$. Unlike the other contraction methods,
+       * this method does not sample the temporal domain: only the slices included in the
+       * restricted temporal domain (see ``restrict_tdomain()``) are contracted.
+       *
+       * \param x tube to be contracted
+       * \param v derivative tube such that \f$\dot{x}(\cdot)\in\llbracket v\rrbracket(\cdot)\f$
+       * \param ctc_indices dimensions to be contracted (all the dimensions if empty)
+       * \return number of distinct slices of \f$\llbracket x\rrbracket(\cdot)\f$ that have been contracted
+       */
+      template<typename T>
+      inline Index contract_incremental(SlicedTube<T>& x, const SlicedTube<T>& v, const std::vector<Index>& ctc_indices = {}) const
+        requires std::is_same_v<T,Interval> || std::is_same_v<T,IntervalVector>
+      {
+        assert_release(TDomain::are_same(x.tdomain(), v.tdomain()));
+
+        // Slices to be contracted, with their derivative slice
+        std::deque<std::pair<Slice<T>*,const Slice<T>*>> queue;
+        std::unordered_set<const Slice<T>*> queued, touched;
+
+        auto push = [&](Slice<T>* sx, const Slice<T>* sv)
+        {
+          if(sx && !sx->is_gate() && sx->t0_tf().is_subset(_tdomain) && queued.insert(sx).second)
+            queue.push_back({ sx, sv });
+        };
+
+        // A modified slice is contracted, as well as its adjacent slices when there
+        // is no gate in between. A modified gate leads to the contraction of its
+        // adjacent slices.
+        const Slice<T>* sv = v.first_slice().get();
+        for(Slice<T>* sx = x.first_slice().get() ; sx ; sx = sx->next_slice_ptr(), sv = sv->next_slice_ptr())
+        {
+          if(!sx->is_modified())
+            continue;
+
+          sx->set_modified(false);
+          Slice<T>* sx_prev = sx->prev_slice_ptr();
+          Slice<T>* sx_next = sx->next_slice_ptr();
+
+          if(!sx->is_gate())
+            push(sx, sv);
+          if(sx->is_gate() || (sx_prev && !sx_prev->is_gate()))
+            push(sx_prev, sv->prev_slice_ptr());
+          if(sx->is_gate() || (sx_next && !sx_next->is_gate()))
+            push(sx_next, sv->next_slice_ptr());
+        }
+
+        // Propagation until the contractions have no more effect: the slice
+        // beyond a contracted gate, or an adjacent slice without gate in between
+        // when the codomain has been contracted, is then contracted
+        while(!queue.empty())
+        {
+          auto [sx,sv] = queue.front();
+          queue.pop_front();
+          queued.erase(sx);
+
+          this->contract(*sx, *sv, ctc_indices);
+          touched.insert(sx);
+
+          bool modified = sx->is_modified();
+          sx->set_modified(false);
+
+          if(Slice<T>* sx_prev = sx->prev_slice_ptr())
+          {
+            if(!sx_prev->is_gate())
+            {
+              if(modified)
+                push(sx_prev, sv->prev_slice_ptr());
+            }
+
+            else if(sx_prev->is_modified())
+            {
+              sx_prev->set_modified(false);
+              push(sx_prev->prev_slice_ptr(), sv->prev_slice_ptr()->prev_slice_ptr());
+            }
+          }
+
+          if(Slice<T>* sx_next = sx->next_slice_ptr())
+          {
+            if(!sx_next->is_gate())
+            {
+              if(modified)
+                push(sx_next, sv->next_slice_ptr());
+            }
+
+            else if(sx_next->is_modified())
+            {
+              sx_next->set_modified(false);
+              push(sx_next->next_slice_ptr(), sv->next_slice_ptr()->next_slice_ptr());
+            }
+          }
+        }
+
+        return touched.size();
+      }
+
       static ConvexPolygon polygon_slice(
         const Interval& t, const Interval& envelope,
         const Interval& input, const Interval& proj_input,
@@ -52,59 +52,59 @@ namespace codac2
 
           // Sampling the tube with the creation of two gates
           auto it_t_beg = x.tdomain()->sample(t.lb(),true);
-          auto it_t = it_t_beg;
           auto it_t_end = std::next(x.tdomain()->sample(t.ub(),true));
 
-          // For each t in [t]
-          while(it_t != it_t_end)
+          // Each gate of [t] is set to the union of the values of all the gates of [t]
+          // (intersected with z), transported to its time by integrating v over the
+          // slices in between. As the transport of a union is the union of the transports
+          // (the rounded sums being monotonic), the values coming from the gates after
+          // and before each gate are accumulated by a backward and a forward sweep,
+          // instead of transporting each value from each gate.
+
+          // Backward sweep: union of the values coming from the gates at or after each gate
+          std::vector<T> from_after;
+          T y = x.empty_value();
+
+          for(auto it_t = std::prev(it_t_end) ; ; it_t--)
           {
             if(it_t->is_gate())
             {
-              T slices_union = x.empty_value();
-
-              // For each t1 in [t]
-              auto it_t1 = x.tdomain()->sample(t.lb(),true);
-              auto it_t1_end = it_t_end;
-              while(it_t1 != it_t1_end)
-              {
-                if(it_t1->is_gate())
-                {
-                  T y1 = x(it_t1->lb()) & z;
-
-                  if(!y1.is_empty())
-                  {
-                    // Transporting y1 to t
-                    auto it_t1_t = it_t1;
-                    auto it_t1_t_end = it_t;
-                    while(it_t1_t != it_t1_t_end)
-                    {
-                      if(!it_t1_t->is_gate())
-                      {
-                        // /!\ .diam() method is not reliable (floating point result)
-                        // -> We need to compute the diameter with intervals
-                        Interval d = Interval(it_t1_t->ub())-Interval(it_t1_t->lb());
-                        if(it_t1->lb() > it_t->lb())
-                          d *= -1; // going backward
-                        y1 += d*v.slice(it_t1_t)->codomain();
-                      }
-
-                      if(it_t1->lb() < it_t->lb())
-                        it_t1_t++;
-                      else
-                        it_t1_t--;
-                    }
-
-                    slices_union |= y1;
-                  }
-                }
-
-                it_t1++;
-              }
-
-              x.slice(it_t)->set(slices_union);
+              y |= x(it_t->lb()) & z;
+              from_after.push_back(y);
+            }
+
+            else
+            {
+              // /!\ .diam() method is not reliable (floating point result)
+              // -> We need to compute the diameter with intervals
+              Interval d = Interval(it_t->ub())-Interval(it_t->lb());
+              d *= -1; // going backward
+              y += d*v.slice(it_t)->codomain();
             }
 
-            it_t++;
+            if(it_t == it_t_beg)
+              break;
+          }
+
+          // Forward sweep: union of the values coming from the gates before each gate,
+          // the gates being contracted in time order (a contracted gate is then
+          // transported to the next ones)
+          auto it_from_after = from_after.rbegin();
+          y = x.empty_value();
+
+          for(auto it_t = it_t_beg ; it_t != it_t_end ; it_t++)
+          {
+            if(it_t->is_gate())
+            {
+              x.slice(it_t)->set(y | *(it_from_after++));
+              y |= x(it_t->lb()) & z;
+            }
+
+            else
+            {
+              Interval d = Interval(it_t->ub())-Interval(it_t->lb());
+              y += d*v.slice(it_t)->codomain();
+            }
           }
 
           CtcDeriv ctc_deriv(TimePropag::FWD_BWD, true);
@@ -10,6 +10,7 @@
 #pragma once
 
 #include <map>
+#include <vector>
 #include "codac2_AnalyticFunction.h"
 #include "codac2_Ctc.h"
 #include "codac2_CtcWrapper.h"
@@ -54,15 +55,19 @@ namespace codac2
 
       void contract_(const CtcBase<Y>& ctc_y, X&... x) const
       {
-        ValuesMap v;
-        // Setting user values into a map before the tree evaluation
-        _f.fill_from_args(v, x...);
+        // The compiled evaluation plan of the function is used,
+        // with values reused from a previous contraction if any
+        const AnalyticTape& t = _f.tape();
+        auto v = t.values();
+
+        // Setting user values into their slots before the tree evaluation
+        _f.fill_from_args(*v, x...);
 
         // Forward/backward algorithm:
 
           // [1/4] Forward evaluation
-          _f.expr()->fwd_eval(v, _f.args().total_size(), !_with_centered_form);
-          auto& val_expr = _f.expr()->value(v);
+          t.fwd_eval(*v, _f.args().total_size(), !_with_centered_form);
+          auto& val_expr = AnalyticExpr<typename ExprType<Y>::Type>::value(*v, t.root_slot());
 
           if(_is_not_in && !val_expr.def_domain)
             return; // <-- iota: if the input x is outside the definition 
@@ -79,51 +84,101 @@ namespace codac2
           // expression (enabled by default). This step must be processed before the
           // backward part of the FwdBwd algorithm (the .m, .a values must not be
           // changed before the centered evaluation).
-          if(_with_centered_form && val_expr.def_domain && !val_expr.da.is_unbounded() && val_expr.da.size() != 0)
+          contract_centered_form_(val_expr, x...);
+          
+        // [4/4] Backward evaluation
+        t.bwd_eval(*v); // backward from the root to the leaves
+        _f.intersect_from_args(*v, x...); // updating input values
+      }
+
+      /**
+       * \brief Contracts a batch of boxes, for contractors on one argument.
+       * The forward and backward evaluations of the function are run once for
+       * all the boxes (see ``AnalyticFunction::eval_batch``), each box being
+       * contracted as with ``contract()``.
+       *
+       * \param x boxes to be contracted
+       */
+      void contract_batch(std::vector<std::tuple_element_t<0,std::tuple<X...>>>& x) const
+        requires (sizeof...(X) == 1)
+      {
+        using X0 = std::tuple_element_t<0,std::tuple<X...>>;
+        const CtcBase<Y>& ctc_y = *_ctc_y.front();
+        const AnalyticTape& t = _f.tape();
+        auto v = t.batch_values();
+        _f.fill_batch_from_args(*v, x, !_with_centered_form);
+
+        // [1/4] Forward evaluation, for all the boxes
+        t.fwd_eval_batch(*v, x.size(), _f.args().total_size(), !_with_centered_form);
+        auto& val_expr = AnalyticExpr<typename ExprType<Y>::Type>::batch_value(*v, t.root_slot());
+
+        // [2/4] and [3/4] Top contraction and centered form, for each box
+        std::vector<bool> disabled(x.size(), false);
+        for(size_t k = 0 ; k < x.size() ; k++)
+        {
+          if(_is_not_in && !val_expr.def_domain[k])
           {
-            // todo: the above condition !val_expr.da.is_unbounded() should not be necesary,
-            // possible bug in MulOp in case of unbounded domain?
-            using X0 = std::tuple_element_t<0, std::tuple<X...>>;
+            disabled[k] = true;
+            continue;
+          }
+
+          auto yk = val_expr.get(k);
+          ctc_y.contract(yk.a);
+          contract_centered_form_(yk, x[k]);
+          val_expr.set(k, yk);
+        }
+
+        // [4/4] Backward evaluation, for all the boxes
+        t.bwd_eval_batch(*v);
+        const auto& val_x = AnalyticExpr<typename ExprType<X0>::Type>::batch_value(*v, 0);
+        for(size_t k = 0 ; k < x.size() ; k++)
+          if(!disabled[k])
+            x[k] &= val_x.a(k);
+      }
+
+      const AnalyticFunction<typename ExprType<Y>::Type>& function() const
+      {
+        return _f;
+      }
+
+    protected:
 
-            if constexpr(sizeof...(X) == 1 && std::is_same_v<X0,IntervalVector>)
+      void contract_centered_form_(typename ExprType<Y>::Type& val_expr, X&... x) const
+      {
+        if(_with_centered_form && val_expr.def_domain && !val_expr.da.is_unbounded() && val_expr.da.size() != 0)
+        {
+          // todo: the above condition !val_expr.da.is_unbounded() should not be necesary,
+          // possible bug in MulOp in case of unbounded domain?
+          using X0 = std::tuple_element_t<0, std::tuple<X...>>;
+
+          if constexpr(sizeof...(X) == 1 && std::is_same_v<X0,IntervalVector>)
+          {
+            X0& x_ = std::get<0>(std::tie(x...));
+            X0 x_mid = X0(x_.mid());
+
+            assert(val_expr.a.size() == val_expr.m.size());
+            IntervalVector fm { val_expr.a - val_expr.m };
+
+            if constexpr(std::is_same_v<Y,IntervalMatrix>)
             {
-              X0& x_ = std::get<0>(std::tie(x...));
-              X0 x_mid = X0(x_.mid());
-
-              assert(val_expr.a.size() == val_expr.m.size());
-              IntervalVector fm { val_expr.a - val_expr.m };
-
-              if constexpr(std::is_same_v<Y,IntervalMatrix>)
-              {
-                std::cout << "CtcInverse: matrices expressions not (yet) supported with centered form" << std::endl;
-              }
-
-              else
-              {
-                IntervalVector p = x_ - x_mid;
-                MulOp::bwd(fm, val_expr.da, p);
-                x_ &= p + x_mid;
-              }
+              std::cout << "CtcInverse: matrices expressions not (yet) supported with centered form" << std::endl;
             }
 
             else
             {
-              // Centered form not (yet) implemented for multi-nonvector-arguments
+              IntervalVector p = x_ - x_mid;
+              MulOp::bwd(fm, val_expr.da, p);
+              x_ &= p + x_mid;
             }
           }
-          
-        // [4/4] Backward evaluation
-        _f.expr()->bwd_eval(v); // recursive backward from the root to the leaves
-        _f.intersect_from_args(v, x...); // updating input values
-      }
 
-      const AnalyticFunction<typename ExprType<Y>::Type>& function() const
-      {
-        return _f;
+          else
+          {
+            // Centered form not (yet) implemented for multi-nonvector-arguments
+          }
+        }
       }
 
-    protected:
-
       const AnalyticFunction<typename ExprType<Y>::Type> _f;
       const Collection<CtcBase<Y>> _ctc_y;
       bool _with_centered_form;
@@ -30,10 +30,6 @@ namespace codac2
   void CtcPointCloud::contract(IntervalVector& x) const
   {
     assert_release(this->size() == x.size());
-    auto u = IntervalVector::empty(x.size());
-
-    for(const auto& pi : _p)
-      u |= x & pi;
-    x = u;
+    x = _p.hull_of_intersections(x);
   }
 }
\ No newline at end of file
@@ -11,6 +11,7 @@
 
 #include "codac2_Ctc.h"
 #include "codac2_IntervalVector.h"
+#include "codac2_BoxTree.h"
 
 namespace codac2
 {
@@ -23,6 +24,6 @@ namespace codac2
 
     protected:
 
-      const std::vector<IntervalVector> _p;
+      const BoxTree _p; // the points are indexed for visiting only those intersecting x
   };
 }
\ No newline at end of file
@@ -17,23 +17,51 @@ using namespace std;
 
 namespace codac2
 {
+  CtcPolygonBoundary::CtcPolygonBoundary(const shared_ptr<const IndexedPolygon>& p)
+    : Ctc<CtcPolygonBoundary,IntervalVector>(2), _p(p),
+      _ctc_edges([&p]
+      {
+        vector<CtcSegment> ctc_edges;
+        ctc_edges.reserve(p->polygon().size());
+        for(const auto& edge_i : p->polygon().edges())
+          ctc_edges.push_back(CtcSegment(edge_i[0],edge_i[1]));
+        return ctc_edges;
+      }())
+  { }
+
+  void CtcPolygonBoundary::contract(IntervalVector& x) const
+  {
+    assert_release(x.size() == 2);
+
+    // The contraction on an edge whose box is disjoint from x is empty
+    auto result = IntervalVector::empty(2);
+    IntervalVector saved_x(x);
+
+    _p->visit_edges(x, [&](size_t i)
+    {
+      saved_x = x;
+      _ctc_edges[i].contract(saved_x);
+      result |= saved_x;
+    });
+
+    x = result;
+  }
+
   CtcPolygon::CtcPolygon(const Polygon& p)
+    : CtcPolygon(make_shared<const IndexedPolygon>(p))
+  { }
+
+  CtcPolygon::CtcPolygon(const shared_ptr<const IndexedPolygon>& p)
     : CtcCtcBoundary(
 
       // Contractor on the boundary
-      [p]
-      {
-        CtcUnion<IntervalVector> ctc_segments(2);
-        for(const auto& edge_i : p.edges())
-          ctc_segments |= CtcSegment(edge_i[0],edge_i[1]);
-        return ctc_segments;
-      }(),
+      CtcPolygonBoundary(p),
 
       // Tests if a point of a box is inside the polygon
       [p](const Vector& x) -> BoolInterval
       {
         assert_release(x.size() == 2);
-        return p.contains(x);
+        return p->contains(x);
       }
     )
   { }
@@ -12,14 +12,40 @@
 #include "codac2_Polygon.h"
 #include "codac2_CtcCtcBoundary.h"
 #include "codac2_CtcUnion.h"
+#include "codac2_CtcSegment.h"
 
 namespace codac2
 {
+  /**
+   * \class CtcPolygonBoundary
+   * \brief Contractor on the edges of a polygon.
+   *
+   * The result is the union of the contractions of the box on each edge (as with
+   * a ``CtcUnion`` of ``CtcSegment``), only the edges whose bounding boxes intersect
+   * the box being considered.
+   */
+  class CtcPolygonBoundary : public Ctc<CtcPolygonBoundary,IntervalVector>
+  {
+    public:
+
+      CtcPolygonBoundary(const std::shared_ptr<const IndexedPolygon>& p);
+      void contract(IntervalVector& x) const;
+
+    protected:
+
+      const std::shared_ptr<const IndexedPolygon> _p;
+      const std::vector<CtcSegment> _ctc_edges;
+  };
+
   class CtcPolygon : public CtcCtcBoundary
   {
     public:
 
       CtcPolygon(const Polygon& p);
       void contract(IntervalVector& x) const;
+
+    protected:
+
+      CtcPolygon(const std::shared_ptr<const IndexedPolygon>& p);
   };
 }
\ No newline at end of file
@@ -17,9 +17,10 @@ using namespace codac2;
 void CtcSegment::contract(IntervalVector& x) const
 {
   assert_release(x.size() == 2 && "only 2d segments are supported");
-  IntervalVector a(_ab[0]), b(_ab[1]); // variables that may be contracted
+  // Fixed-size variables (that may be contracted): no heap allocation
+  IntervalVector_<2> a(_ab[0]), b(_ab[1]);
   x &= a | b; // boxed domain of the segment
-  IntervalVector c = a-x, d = b-a;
+  IntervalVector_<2> c = a-x, d = b-a;
   DetOp::bwd(0.,d,c);
   SubOp::bwd(c[0],a[0],x[0]);
   SubOp::bwd(c[1],a[1],x[1]);
@@ -50,12 +50,12 @@ namespace codac2
       template<typename X_> // single type
       void contract_impl(X_& x) const
       {
-        auto result = x;
+        auto result = x, saved_x = x;
         result.set_empty();
 
         for(const auto& ci : _ctcs)
         {
-          auto saved_x = x;
+          saved_x = x; // same size: the storage is reused
           ci->contract(saved_x);
           result |= saved_x;
         }
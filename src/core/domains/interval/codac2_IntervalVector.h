@@ -42,4 +42,41 @@ namespace codac2
       return os;
     }
   }
+
+  /**
+   * \brief Alias for a fixed-size column vector of intervals.
+   *
+   * The ``N`` components are stored in the object itself: copies, bisections or
+   * intersections of such boxes do not involve any heap allocation, which is
+   * relevant in low dimensions (for instance, 2d boxes handled in the contractors
+   * on segments or polygons). The methods of ``IntervalVector`` are available.
+   *
+   * This type alias corresponds to ``Eigen::Matrix<Interval,N,1>``. It can be
+   * converted into an ``IntervalVector`` (and conversely, provided that the sizes match).
+   *
+   * \tparam N number of components
+   */
+  template<int N>
+  using IntervalVector_ = Eigen::Matrix<Interval,N,1>;
+
+  /**
+   * \brief Stream output operator for ``IntervalVector_<N>`` objects.
+   *
+   * \param os The output stream to write to.
+   * \param x The interval vector whose contents are to be printed.
+   * \return A reference to the modified output stream.
+   */
+  template<int N>
+    requires (N != Dynamic)
+  inline std::ostream& operator<<(std::ostream& os, const IntervalVector_<N>& x)
+  {
+    if(x.is_empty())
+      return os << "[ empty " << x.size() << "d vector ]";
+
+    else
+    {
+      os << x.format(codac_vector_fmt());
+      return os;
+    }
+  }
 }
\ No newline at end of file
@@ -0,0 +1,91 @@
+/** 
+ *  codac2_CompactPaving.cpp
+ * ----------------------------------------------------------------------------
+ *  \date       2025
+ *  \author     Simon Rohou
+ *  \copyright  Copyright 2025 Codac Team
+ *  \license    GNU Lesser General Public License (LGPL)
+ */
+
+#include "codac2_CompactPaving.h"
+
+using namespace std;
+using namespace codac2;
+
+namespace codac2
+{
+  // CompactPavingOut class
+
+    CompactPavingOut::CompactPavingOut(Index n)
+      : CompactPavingOut(IntervalVector(n))
+    {
+      assert_release(n > 0);
+    }
+
+    CompactPavingOut::CompactPavingOut(const IntervalVector& x)
+      : CompactPaving<CompactPavingOut,IntervalVector>(x)
+    { }
+
+    CompactPavingOut::CompactPavingOut(const PavingOut& p)
+      : CompactPaving<CompactPavingOut,IntervalVector>(p)
+    { }
+
+    const CompactPavingOut::NodeValue_ CompactPavingOut::outer =
+      [](const CompactPavingOut::Node_& n)
+    {
+      return PavingOut::outer_value(n);
+    };
+
+    const CompactPavingOut::NodeValue_ CompactPavingOut::outer_complem =
+      [](const CompactPavingOut::Node_& n)
+    {
+      return PavingOut::outer_complem_value(n);
+    };
+
+
+  // CompactPavingInOut class
+
+    CompactPavingInOut::CompactPavingInOut(Index n)
+      : CompactPavingInOut(IntervalVector(n))
+    {
+      assert_release(n > 0);
+    }
+
+    CompactPavingInOut::CompactPavingInOut(const IntervalVector& x)
+      : CompactPaving<CompactPavingInOut,IntervalVector,IntervalVector>(x)
+    { }
+
+    CompactPavingInOut::CompactPavingInOut(const PavingInOut& p)
+      : CompactPaving<CompactPavingInOut,IntervalVector,IntervalVector>(p)
+    { }
+
+    const CompactPavingInOut::NodeValue_ CompactPavingInOut::outer =
+      [](const CompactPavingInOut::Node_& n)
+    {
+      return PavingInOut::outer_value(n);
+    };
+
+    const CompactPavingInOut::NodeValue_ CompactPavingInOut::outer_complem =
+      [](const CompactPavingInOut::Node_& n)
+    {
+      return PavingInOut::outer_complem_value(n);
+    };
+
+    const CompactPavingInOut::NodeValue_ CompactPavingInOut::inner =
+      [](const CompactPavingInOut::Node_& n)
+    {
+      return PavingInOut::inner_value(n);
+    };
+
+    const CompactPavingInOut::NodeValue_ CompactPavingInOut::bound =
+      [](const CompactPavingInOut::Node_& n)
+    {
+      return PavingInOut::bound_value(n);
+    };
+
+    const CompactPavingInOut::NodeValue_ CompactPavingInOut::all =
+      [](const CompactPavingInOut::Node_& n)
+    {
+      return PavingInOut::all_value(n);
+    };
+}
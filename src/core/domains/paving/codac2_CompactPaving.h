@@ -0,0 +1,456 @@
+/**
+ *  \file codac2_CompactPaving.h
+ * ----------------------------------------------------------------------------
+ *  \date       2025
+ *  \author     Simon Rohou
+ *  \copyright  Copyright 2025 Codac Team
+ *  \license    GNU Lesser General Public License (LGPL)
+ */
+
+#pragma once
+
+#include <list>
+#include <cmath>
+#include <vector>
+#include <limits>
+#include <cstdint>
+#include <functional>
+#include "codac2_Paving.h"
+
+namespace codac2
+{
+  template<typename P>
+  class CompactPavingNode;
+
+  /**
+   * \class CompactPaving
+   * \brief Compact storage of a paving: the nodes of the binary tree are stored in a
+   * contiguous arena and linked by 32-bit indices, while the bounds of their boxes
+   * are stored in a flat buffer of doubles.
+   *
+   * Compared to the ``Paving`` class (one heap-allocated ``PavingNode`` per node, shared
+   * pointers between nodes), this representation avoids most of the memory allocations
+   * during the paving process, and the destruction of the tree does not depend on
+   * its number of nodes. Nodes are accessed through lightweight ``CompactPavingNode``
+   * handles providing the same interface as ``PavingNode`` (boxes are returned by value).
+   */
+  template<typename P,typename... X>
+    requires (std::is_same_v<X,IntervalVector> && ...)
+  class CompactPaving : public Domain
+  {
+    public:
+
+      using Node_ = CompactPavingNode<P>;
+      using NodeTuple_ = std::tuple<X...>;
+      using NodeValue_ = std::function<std::list<IntervalVector>(const Node_&)>;
+      using NodeIndex_ = std::uint32_t;
+
+      static constexpr NodeIndex_ none = std::numeric_limits<NodeIndex_>::max();
+
+      /**
+       * \brief Creates a compact paving made of one root node, for which
+       * all the boxes are initialized with \p x
+       *
+       * \param x initial box
+       */
+      CompactPaving(const IntervalVector& x)
+        : _n(x.size())
+      {
+        assert_release(x.size() > 0);
+        add_node(none, init_tuple(x));
+      }
+
+      /**
+       * \brief Creates a compact copy of a paving made of ``PavingNode`` objects
+       *
+       * \param p paving to be copied
+       */
+      template<typename Q>
+      explicit CompactPaving(const Paving<Q,X...>& p)
+        : _n(p.size())
+      {
+        std::list<std::pair<std::shared_ptr<const PavingNode<Q>>,NodeIndex_>> l { { p.tree(), none } };
+
+        while(!l.empty())
+        {
+          auto [pn,top] = l.front();
+          l.pop_front();
+
+          NodeIndex_ i = add_node(top, pn->boxes());
+          if(top != none)
+            (_nodes[top].left == none ? _nodes[top].left : _nodes[top].right) = i;
+
+          if(pn->left()) l.push_back({ pn->left(), i });
+          if(pn->right()) l.push_back({ pn->right(), i });
+        }
+      }
+
+      /**
+       * \brief Returns the dimension of the boxes of this paving
+       *
+       * \return the dimension
+       */
+      inline Index size() const
+      {
+        return _n;
+      }
+
+      /**
+       * \brief Returns the number of nodes stored in this paving
+       *
+       * \return the number of nodes
+       */
+      inline std::size_t nb_nodes() const
+      {
+        return _nodes.size();
+      }
+
+      /**
+       * \brief Preallocates memory for \p nb_nodes nodes
+       *
+       * \param nb_nodes expected number of nodes
+       */
+      inline void reserve(std::size_t nb_nodes)
+      {
+        _nodes.reserve(nb_nodes);
+        _bounds.reserve(nb_nodes*node_stride());
+      }
+
+      /**
+       * \brief Returns a handle on the root node of the tree
+       *
+       * \return root node
+       */
+      inline Node_ tree() const
+      {
+        return Node_(static_cast<const P*>(this), 0);
+      }
+
+      inline std::list<IntervalVector> boxes(const NodeValue_& node_value) const
+      {
+        return boxes(node_value, IntervalVector(size()));
+      }
+
+      inline std::list<IntervalVector> boxes(const NodeValue_& node_value, const IntervalVector& intersecting_box) const
+      {
+        std::list<IntervalVector> l;
+
+        tree().visit([&]
+          (const Node_& n)
+          {
+            for(const auto& bi : node_value(n))
+              if(bi.intersects(intersecting_box))
+                l.push_back(bi);
+            return n.hull().intersects(intersecting_box);
+          });
+
+        return l;
+      }
+
+      /**
+       * \brief Returns the \p k-th box of the node \p i
+       *
+       * \param i index of the node
+       * \param k index of the box in the node tuple
+       * \return the box
+       */
+      IntervalVector box(NodeIndex_ i, std::size_t k) const
+      {
+        assert(i < _nodes.size() && k < sizeof...(X));
+        const double *b = &_bounds[i*node_stride() + k*2*_n];
+
+        if(std::isnan(b[0])) // empty box
+          return IntervalVector::empty(_n);
+
+        IntervalVector x(_n);
+        for(Index j = 0 ; j < _n ; j++)
+          x[j] = Interval(b[j],b[_n+j]);
+        return x;
+      }
+
+      /**
+       * \brief Sets the \p k-th box of the node \p i
+       *
+       * \param i index of the node
+       * \param k index of the box in the node tuple
+       * \param x new box
+       */
+      void set_box(NodeIndex_ i, std::size_t k, const IntervalVector& x)
+      {
+        assert(i < _nodes.size() && k < sizeof...(X));
+        assert(x.size() == _n);
+        double *b = &_bounds[i*node_stride() + k*2*_n];
+
+        if(x.is_empty())
+          std::fill(b, b+2*_n, std::numeric_limits<double>::quiet_NaN());
+
+        else
+          for(Index j = 0 ; j < _n ; j++)
+          {
+            b[j] = x[j].lb();
+            b[_n+j] = x[j].ub();
+          }
+      }
+
+      /**
+       * \brief Returns the boxes of the node \p i
+       *
+       * \param i index of the node
+       * \return the tuple of boxes
+       */
+      NodeTuple_ node_boxes(NodeIndex_ i) const
+      {
+        return node_boxes(i, std::index_sequence_for<X...>());
+      }
+
+      /**
+       * \brief Sets the boxes of the node \p i
+       *
+       * \param i index of the node
+       * \param x the tuple of boxes
+       */
+      void set_node_boxes(NodeIndex_ i, const NodeTuple_& x)
+      {
+        set_node_boxes(i, x, std::index_sequence_for<X...>());
+      }
+
+      /**
+       * \brief Bisects the leaf \p i: the bisection of its unknown part
+       * (intersection of its boxes) initializes the boxes of the two new children
+       *
+       * \param i index of the node
+       * \param bisect_fnc bisection function
+       */
+      void bisect(NodeIndex_ i,
+        const std::function<std::pair<IntervalVector,IntervalVector>(const IntervalVector&)>& bisect_fnc
+          = [](const IntervalVector& x) { return x.bisect_largest(); })
+      {
+        assert_release(i < _nodes.size() && is_leaf(i) && "only leaves can be bisected");
+        assert_release(_nodes.size()+2 < none && "maximum number of nodes reached");
+
+        bool bisectable_node = true;
+        std::apply([&](auto &&... xs) { ((bisectable_node &= xs.is_bisectable()), ...); }, node_boxes(i));
+        assert_release(bisectable_node);
+
+        auto p = bisect_fnc(Node_(static_cast<const P*>(this), i).unknown());
+        NodeIndex_ l = add_node(i, init_tuple(p.first));
+        NodeIndex_ r = add_node(i, init_tuple(p.second));
+        _nodes[i].left = l;
+        _nodes[i].right = r;
+      }
+
+      inline bool is_leaf(NodeIndex_ i) const
+      {
+        return _nodes[i].left == none && _nodes[i].right == none;
+      }
+
+      inline NodeIndex_ top(NodeIndex_ i) const
+      {
+        return _nodes[i].top;
+      }
+
+      inline NodeIndex_ left(NodeIndex_ i) const
+      {
+        return _nodes[i].left;
+      }
+
+      inline NodeIndex_ right(NodeIndex_ i) const
+      {
+        return _nodes[i].right;
+      }
+
+    protected:
+
+      inline static NodeTuple_ init_tuple(const IntervalVector& x)
+      {
+        return std::make_tuple(((X)x)...);
+      }
+
+      struct NodeLinks_
+      {
+        NodeIndex_ top, left, right;
+      };
+
+      // For each node: sizeof...(X) boxes, each stored as n lower bounds followed by n upper bounds
+      inline std::size_t node_stride() const
+      {
+        return sizeof...(X)*2*_n;
+      }
+
+      NodeIndex_ add_node(NodeIndex_ top, const NodeTuple_& x)
+      {
+        NodeIndex_ i = (NodeIndex_)_nodes.size();
+        _nodes.push_back({ top, none, none });
+        _bounds.resize(_bounds.size()+node_stride());
+        set_node_boxes(i, x);
+        return i;
+      }
+
+      template<std::size_t... K>
+      NodeTuple_ node_boxes(NodeIndex_ i, std::index_sequence<K...>) const
+      {
+        return std::make_tuple(box(i,K)...);
+      }
+
+      template<std::size_t... K>
+      void set_node_boxes(NodeIndex_ i, const NodeTuple_& x, std::index_sequence<K...>)
+      {
+        (set_box(i, K, std::get<K>(x)), ...);
+      }
+
+      const Index _n;
+      std::vector<NodeLinks_> _nodes;
+      std::vector<double> _bounds;
+  };
+
+  /**
+   * \class CompactPavingNode
+   * \brief Lightweight handle on a node of a ``CompactPaving``.
+   *
+   * The handle provides the same interface as a ``std::shared_ptr<const PavingNode<P>>``
+   * (including ``operator->`` and the comparison with another node), so that the same
+   * algorithms can be written for both representations. A default-constructed (null)
+   * handle is returned by ``top()``, ``left()``, ``right()`` when the related node does not exist.
+   */
+  template<typename P>
+  class CompactPavingNode
+  {
+    public:
+
+      using NodeIndex_ = std::uint32_t;
+
+      CompactPavingNode(const P* paving = nullptr, NodeIndex_ i = P::none)
+        : _paving(paving), _i(i)
+      { }
+
+      explicit operator bool() const
+      {
+        return _paving && _i != P::none;
+      }
+
+      const CompactPavingNode<P>* operator->() const
+      {
+        return this;
+      }
+
+      bool operator==(const CompactPavingNode<P>& n) const = default;
+
+      NodeIndex_ index() const
+      {
+        return _i;
+      }
+
+      const P& paving() const
+      {
+        return *_paving;
+      }
+
+      typename P::NodeTuple_ boxes() const
+      {
+        return _paving->node_boxes(_i);
+      }
+
+      IntervalVector hull() const
+      {
+        auto x = boxes();
+        IntervalVector h = std::get<0>(x);
+        std::apply([&](auto &&... xs) { ((h |= xs), ...); }, x);
+        return h;
+      }
+
+      IntervalVector unknown() const
+      {
+        auto x = boxes();
+        IntervalVector h = std::get<0>(x);
+        std::apply([&](auto &&... xs) { ((h &= xs), ...); }, x);
+        return h;
+      }
+
+      CompactPavingNode<P> top() const
+      {
+        return CompactPavingNode<P>(_paving, _paving->top(_i));
+      }
+
+      CompactPavingNode<P> left() const
+      {
+        return CompactPavingNode<P>(_paving, _paving->left(_i));
+      }
+
+      CompactPavingNode<P> right() const
+      {
+        return CompactPavingNode<P>(_paving, _paving->right(_i));
+      }
+
+      bool is_leaf() const
+      {
+        return _paving->is_leaf(_i);
+      }
+
+      // Same traversal as PavingNode::visit(), including the
+      // special case of the redundant first level of the tree.
+      // The traversal is iterative (no recursion depth limitation).
+
+      void visit(const std::function<bool(const CompactPavingNode<P>&)>& visitor) const
+      {
+        std::vector<NodeIndex_> s { _i };
+
+        while(!s.empty())
+        {
+          CompactPavingNode<P> n(_paving, s.back());
+          s.pop_back();
+
+          if(!n.top() && !n.right() && n.left() && n.left().boxes() == n.boxes())
+            s.push_back(n.left().index());
+
+          else if(visitor(n))
+          {
+            if(n.right()) s.push_back(n.right().index());
+            if(n.left()) s.push_back(n.left().index());
+          }
+        }
+      }
+
+    protected:
+
+      const P* _paving;
+      NodeIndex_ _i;
+  };
+
+
+  class CompactPavingOut;
+  using CompactPavingOut_Node = CompactPavingNode<CompactPavingOut>;
+
+  /**
+   * \class CompactPavingOut
+   * \brief Compact version of ``PavingOut``
+   */
+  class CompactPavingOut : public CompactPaving<CompactPavingOut,IntervalVector>
+  {
+    public:
+
+      CompactPavingOut(Index n);
+      CompactPavingOut(const IntervalVector& x);
+      explicit CompactPavingOut(const PavingOut& p);
+
+      static const NodeValue_ outer, outer_complem;
+  };
+
+
+  class CompactPavingInOut;
+  using CompactPavingInOut_Node = CompactPavingNode<CompactPavingInOut>;
+
+  /**
+   * \class CompactPavingInOut
+   * \brief Compact version of ``PavingInOut``
+   */
+  class CompactPavingInOut : public CompactPaving<CompactPavingInOut,IntervalVector,IntervalVector>
+  {
+    public:
+
+      CompactPavingInOut(Index n);
+      CompactPavingInOut(const IntervalVector& x);
+      explicit CompactPavingInOut(const PavingInOut& p);
+
+      static const NodeValue_ outer, outer_complem, inner, bound, all;
+  };
+}
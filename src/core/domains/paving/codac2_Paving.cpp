@@ -40,38 +40,13 @@ namespace codac2
     const PavingOut::NodeValue_ PavingOut::outer =
       [](PavingOut::Node_ n)
     {
-      list<IntervalVector> l;
-      if(n->is_leaf())
-        l.push_back(get<0>(n->boxes()));
-      return l;
+      return PavingOut::outer_value(n);
     };
 
     const PavingOut::NodeValue_ PavingOut::outer_complem =
       [](PavingOut::Node_ n)
     {
-      if(n->top())
-      {
-        if(!n->top()->top())
-        {
-          if(n->top()->left() == n)
-            return get<0>(n->top()->boxes()).diff(get<0>(n->boxes()));
-
-          else
-            return list<IntervalVector>();
-        }
-
-        else
-        {
-          auto top_subboxes = get<0>(n->top()->boxes()).bisect_largest();
-          if(n->top()->left() == n)
-            return top_subboxes.first.diff(get<0>(n->boxes()));
-          else
-            return top_subboxes.second.diff(get<0>(n->boxes()));
-        }
-      }
-
-      else
-        return list<IntervalVector>();
+      return PavingOut::outer_complem_value(n);
     };
 
 
@@ -100,40 +75,30 @@ namespace codac2
     const PavingInOut::NodeValue_ PavingInOut::outer =
       [](PavingInOut::Node_ n)
     {
-      auto l = n->hull().diff(get<1>(n->boxes()));
-      if(n->is_leaf())
-        l.push_back(n->unknown());
-      return l;
+      return PavingInOut::outer_value(n);
     };
 
     const PavingInOut::NodeValue_ PavingInOut::outer_complem =
       [](PavingInOut::Node_ n)
     {
-      return n->hull().diff(get<0>(n->boxes()));
+      return PavingInOut::outer_complem_value(n);
     };
 
     const PavingInOut::NodeValue_ PavingInOut::inner =
       [](PavingInOut::Node_ n)
     {
-      return n->hull().diff(get<1>(n->boxes()));
+      return PavingInOut::inner_value(n);
     };
 
     const PavingInOut::NodeValue_ PavingInOut::bound =
       [](PavingInOut::Node_ n)
     {
-      list<IntervalVector> l;
-      if(n->is_leaf())
-        l.push_back(n->unknown());
-      return l;
+      return PavingInOut::bound_value(n);
     };
 
     const PavingInOut::NodeValue_ PavingInOut::all =
       [](PavingInOut::Node_ n)
     {
-      auto l = n->hull().diff(get<1>(n->boxes()));
-      l.splice(l.end(), n->hull().diff(get<0>(n->boxes())));
-      if(n->is_leaf())
-        l.push_back(n->unknown());
-      return l;
+      return PavingInOut::all_value(n);
     };
 }
\ No newline at end of file
@@ -10,7 +10,11 @@
 #pragma once
 
 #include <map>
+#include <algorithm>
+#include <deque>
+#include <vector>
 #include <memory>
+#include <unordered_map>
 #include "codac2_PavingNode.h"
 
 namespace codac2
@@ -85,39 +89,84 @@ namespace codac2
 
       inline std::list<ConnectedSubset_> connected_subsets(const IntervalVector& x0, const NodeValue_& node_value) const
       {
-        std::list<IntervalVector> l_boxes = boxes(node_value, x0);
-        [[maybe_unused]] Index nb_boxes = l_boxes.size();
+        // The boxes are first listed in the visiting order of the tree, and the range of
+        // the boxes provided by each node is stored, so that the neighbours of a box can
+        // then be obtained by a pruned traversal of the tree, without re-evaluating the
+        // node values. The subsets are then built by a breadth-first search over the
+        // neighbourhood relation, which provides the same subsets (and the same order
+        // of the boxes) as a search over the list of boxes, in quasi-linear time.
+        // Equal boxes (possibly provided several times by the node values) are merged
+        // into one entry of their subset.
+
+        std::vector<IntervalVector> v_boxes;
+        std::unordered_map<const PavingNode<P>*,std::pair<std::size_t,std::size_t>> node_boxes;
+
+        this->tree()->visit([&]
+          (Node_ n)
+          {
+            std::size_t first = v_boxes.size();
+            for(const auto& bi : node_value(n))
+              if(bi.intersects(x0))
+                v_boxes.push_back(bi);
+            node_boxes[n.get()] = { first, v_boxes.size() };
+            return n->hull().intersects(x0);
+          });
+
+        auto neighbours = [&](const IntervalVector& x)
+        {
+          std::vector<std::size_t> v;
+          this->tree()->visit([&]
+            (Node_ n)
+            {
+              auto it = node_boxes.find(n.get());
+              if(it == node_boxes.end())
+                return false;
+              for(std::size_t j = it->second.first ; j < it->second.second ; j++)
+                if(v_boxes[j].intersects(x))
+                  v.push_back(j);
+              return n->hull().intersects(x);
+            });
+          return v;
+        };
+
         std::list<ConnectedSubset_> l_subsets;
+        std::vector<bool> visited(v_boxes.size(), false);
 
-        while(!l_boxes.empty())
+        for(std::size_t i = 0 ; i < v_boxes.size() ; i++)
         {
-          auto current_box = l_boxes.front();
-          l_subsets.push_back({ current_box });
-          l_boxes.pop_front();
+          if(visited[i])
+            continue;
 
-          std::list<IntervalVector> l_neighbouring_boxes_to_visit { current_box };
+          visited[i] = true;
+          l_subsets.push_back({ v_boxes[i] });
+          std::deque<std::size_t> l_neighbouring_boxes_to_visit { i };
 
           do
           {
-            current_box = l_neighbouring_boxes_to_visit.front();
+            std::size_t k = l_neighbouring_boxes_to_visit.front();
             l_neighbouring_boxes_to_visit.pop_front();
 
-            for(const auto& ni : boxes(node_value, current_box))
-            {
-              if(std::find(l_boxes.begin(), l_boxes.end(), ni) != l_boxes.end())
+            // Equal boxes intersect the same boxes: they are all obtained here
+            std::vector<std::size_t> new_neighbours;
+
+            for(const auto& j : neighbours(v_boxes[k]))
+              if(!visited[j])
               {
-                l_boxes.remove(ni);
-                l_neighbouring_boxes_to_visit.push_back(ni);
-                l_subsets.back().push_back(ni);
+                visited[j] = true;
+                if(v_boxes[j] == v_boxes[k] || std::any_of(new_neighbours.begin(), new_neighbours.end(),
+                    [&](std::size_t l) { return v_boxes[l] == v_boxes[j]; }))
+                  continue; // already in the subset
+
+                new_neighbours.push_back(j);
+                l_neighbouring_boxes_to_visit.push_back(j);
+                l_subsets.back().push_back(v_boxes[j]);
               }
-            }
 
           } while(!l_neighbouring_boxes_to_visit.empty());
         }
 
-        assert(l_boxes.empty() && "all the nodes should have been visited");
-        assert([&]() -> bool { Index s = 0; for(const auto& si : l_subsets) s += si.size(); return s == nb_boxes; } ()
-          && "the total number of boxes should match the sum of number of boxes of each subset");
+        assert(std::all_of(visited.begin(), visited.end(), [](bool v) { return v; })
+          && "all the boxes should have been visited");
 
         return l_subsets;
       }
@@ -168,6 +217,46 @@ namespace codac2
       }
 
       static const NodeValue_ outer, outer_complem;
+
+      // Node values, generic with respect to the node representation
+      // (std::shared_ptr<const PavingNode<P>> or CompactPavingNode<P>)
+
+      template<typename N>
+      static std::list<IntervalVector> outer_value(const N& n)
+      {
+        std::list<IntervalVector> l;
+        if(n->is_leaf())
+          l.push_back(std::get<0>(n->boxes()));
+        return l;
+      }
+
+      template<typename N>
+      static std::list<IntervalVector> outer_complem_value(const N& n)
+      {
+        if(n->top())
+        {
+          if(!n->top()->top())
+          {
+            if(n->top()->left() == n)
+              return std::get<0>(n->top()->boxes()).diff(std::get<0>(n->boxes()));
+
+            else
+              return std::list<IntervalVector>();
+          }
+
+          else
+          {
+            auto top_subboxes = std::get<0>(n->top()->boxes()).bisect_largest();
+            if(n->top()->left() == n)
+              return top_subboxes.first.diff(std::get<0>(n->boxes()));
+            else
+              return top_subboxes.second.diff(std::get<0>(n->boxes()));
+          }
+        }
+
+        else
+          return std::list<IntervalVector>();
+      }
   };
 
 
@@ -185,5 +274,48 @@ namespace codac2
       std::list<PavingInOut::ConnectedSubset_> connected_subsets(const IntervalVector& x0, const PavingInOut::NodeValue_& node_value = PavingInOut::outer) const;
 
       static const NodeValue_ outer, outer_complem, inner, bound, all;
+
+      // Node values, generic with respect to the node representation
+      // (std::shared_ptr<const PavingNode<P>> or CompactPavingNode<P>)
+
+      template<typename N>
+      static std::list<IntervalVector> outer_value(const N& n)
+      {
+        auto l = n->hull().diff(std::get<1>(n->boxes()));
+        if(n->is_leaf())
+          l.push_back(n->unknown());
+        return l;
+      }
+
+      template<typename N>
+      static std::list<IntervalVector> outer_complem_value(const N& n)
+      {
+        return n->hull().diff(std::get<0>(n->boxes()));
+      }
+
+      template<typename N>
+      static std::list<IntervalVector> inner_value(const N& n)
+      {
+        return n->hull().diff(std::get<1>(n->boxes()));
+      }
+
+      template<typename N>
+      static std::list<IntervalVector> bound_value(const N& n)
+      {
+        std::list<IntervalVector> l;
+        if(n->is_leaf())
+          l.push_back(n->unknown());
+        return l;
+      }
+
+      template<typename N>
+      static std::list<IntervalVector> all_value(const N& n)
+      {
+        auto l = n->hull().diff(std::get<1>(n->boxes()));
+        l.splice(l.end(), n->hull().diff(std::get<0>(n->boxes())));
+        if(n->is_leaf())
+          l.push_back(n->unknown());
+        return l;
+      }
   };
 }
\ No newline at end of file
@@ -9,6 +9,7 @@
 
 #pragma once
 
+#include <utility>
 #include "codac2_SliceBase.h"
 #include "codac2_ConvexPolygon.h"
 #include "codac2_CtcDeriv.h"
@@ -47,7 +48,13 @@ namespace codac2
 
       inline virtual std::shared_ptr<SliceBase> copy() const
       {
-        return std::make_shared<Slice>(*this, this->_tube);
+        tube().invalidate_hull_index();
+        return tube().make_slice(*this, this->_tube);
+      }
+
+      inline virtual void detach()
+      {
+        tube().invalidate_hull_index();
       }
 
       inline Index size() const
@@ -57,6 +64,7 @@ namespace codac2
 
       inline T& codomain()
       {
+        tube().invalidate_hull_index();
         return (T&)(*this);
       }
 
@@ -94,31 +102,58 @@ namespace codac2
           static_cast<const Slice<T>&>(*this).next_slice());
       }
 
+      // Raw accessors to the adjacent slices, without shared ownership,
+      // for sweeps over the slices of a tube
+
+      inline const Slice<T>* prev_slice_ptr() const
+      {
+        return static_cast<const Slice<T>*>(_prev);
+      }
+
+      inline Slice<T>* prev_slice_ptr()
+      {
+        return static_cast<Slice<T>*>(_prev);
+      }
+
+      inline const Slice<T>* next_slice_ptr() const
+      {
+        return static_cast<const Slice<T>*>(_next);
+      }
+
+      inline Slice<T>* next_slice_ptr()
+      {
+        return static_cast<Slice<T>*>(_next);
+      }
+
       inline T input_gate() const
       {
-        if(!prev_slice())
+        const Slice<T>* prev = prev_slice_ptr();
+
+        if(!prev)
           return codomain();
 
         else
         {
-          if(prev_slice()->is_gate())
-            return prev_slice()->codomain();
+          if(prev->is_gate())
+            return prev->codomain();
           else
-            return codomain() & prev_slice()->codomain();
+            return codomain() & prev->codomain();
         }
       }
 
       inline T output_gate() const
       {
-        if(!next_slice())
+        const Slice<T>* next = next_slice_ptr();
+
+        if(!next)
           return codomain();
 
         else
         {
-          if(next_slice()->is_gate())
-            return next_slice()->codomain();
+          if(next->is_gate())
+            return next->codomain();
           else
-            return codomain() & next_slice()->codomain();
+            return codomain() & next->codomain();
         }
       }
 
@@ -159,14 +194,20 @@ namespace codac2
       inline void set(const T& x, bool propagate = true)
       {
         assert_release(x.size() == this->size());
-        codomain() = x;
+        if(!(std::as_const(*this).codomain() == x))
+        {
+          codomain() = x;
+          _modified = true;
+        }
         if(propagate)
           update_adjacent_codomains();
       }
 
       inline void init()
       {
+        tube().invalidate_hull_index();
         this->T::init();
+        _modified = true;
         // Nothing to propagate to adjacent codomains
       }
 
@@ -405,29 +446,44 @@ namespace codac2
 
       inline void set_empty(bool propagate)
       {
-        this->T::set_empty();
+        if(!this->T::is_empty())
+        {
+          tube().invalidate_hull_index();
+          this->T::set_empty();
+          _modified = true;
+        }
         if(propagate)
           update_adjacent_codomains();
       }
 
+      inline void intersect(const T& x)
+      {
+        T y = std::as_const(*this).codomain() & x;
+        if(!(y == std::as_const(*this).codomain()))
+        {
+          codomain() = y;
+          _modified = true;
+        }
+      }
+
       inline void update_adjacent_codomains()
       {
-        if(prev_slice())
+        if(Slice<T>* prev = prev_slice_ptr())
         {
-          assert(prev_slice()->size() == this->size());
+          assert(prev->size() == this->size());
           if(is_gate())
-            codomain() &= prev_slice()->codomain();
-          else if(prev_slice()->is_gate())
-            prev_slice()->codomain() &= codomain();
+            intersect(std::as_const(*prev).codomain());
+          else if(prev->is_gate())
+            prev->intersect(std::as_const(*this).codomain());
         }
 
-        if(next_slice())
+        if(Slice<T>* next = next_slice_ptr())
         {
-          assert(next_slice()->size() == this->size());
+          assert(next->size() == this->size());
           if(is_gate())
-            codomain() &= next_slice()->codomain();
-          else if(next_slice()->is_gate())
-            next_slice()->codomain() &= codomain();
+            intersect(std::as_const(*next).codomain());
+          else if(next->is_gate())
+            next->intersect(std::as_const(*this).codomain());
         }
       }
   };
@@ -32,15 +32,25 @@ namespace codac2
 
   std::shared_ptr<const SliceBase> SliceBase::prev_slice() const
   {
-    if(&(*_tube.first_slice()) == this)
+    if(!_prev)
       return nullptr;
-    return prev(_it_tslice)->slices().at(&_tube);
+    return _prev->_it_tslice->slice(&_tube);
   }
 
   std::shared_ptr<const SliceBase> SliceBase::next_slice() const
   {
-     if(&(*_tube.last_slice()) == this)
-       return nullptr;
-     return next(_it_tslice)->slices().at(&_tube);
+    if(!_next)
+      return nullptr;
+    return _next->_it_tslice->slice(&_tube);
+  }
+
+  bool SliceBase::is_modified() const
+  {
+    return _modified;
+  }
+
+  void SliceBase::set_modified(bool modified)
+  {
+    _modified = modified;
   }
 }
\ No newline at end of file
@@ -28,18 +28,36 @@ namespace codac2
       virtual void init() = 0;
       virtual void set_empty() = 0;
 
+      // Called when the slice is removed from the temporal domain. The slice is
+      // destroyed (and its memory reused by the tube) when it is no longer referenced.
+      virtual void detach() = 0;
+
       const Interval& t0_tf() const;
       const TSlice& tslice() const;
 
       std::shared_ptr<const SliceBase> prev_slice() const;
       std::shared_ptr<const SliceBase> next_slice() const;
 
+      // Modification flag, raised when the codomain is changed by the set methods
+      // (or when the slice is created), and cleared by incremental propagations
+      // such as CtcDeriv::contract_incremental
+      bool is_modified() const;
+      void set_modified(bool modified = true);
+
 
     protected:
         
       const SlicedTubeBase& _tube;
       std::list<TSlice>::iterator _it_tslice;
 
+      // Adjacent slices of the same tube, in time order (nullptr at the bounds)
+      SliceBase* _prev = nullptr;
+      SliceBase* _next = nullptr;
+
+      bool _modified = true;
+
       friend class TDomain;
+      template<typename T>
+      friend class SlicedTube;
   };
 }
\ No newline at end of file
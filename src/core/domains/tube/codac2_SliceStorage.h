@@ -0,0 +1,124 @@
+/**
+ *  \file codac2_SliceStorage.h
+ * ----------------------------------------------------------------------------
+ *  \date       2025
+ *  \author     Simon Rohou
+ *  \copyright  Copyright 2025 Codac Team
+ *  \license    GNU Lesser General Public License (LGPL)
+ */
+
+#pragma once
+
+#include <memory>
+#include <mutex>
+#include <vector>
+#include <utility>
+#include <algorithm>
+
+namespace codac2
+{
+  /**
+   * \class SliceStorage
+   * \brief Memory of the slices of a tube, allocated by chunks of contiguous objects.
+   *
+   * The slices of a tube are created in time order when the tube is built: they are
+   * then stored in a single chunk, as a contiguous array. Slices created afterwards
+   * (by a sampling of the temporal domain) are stored in additional chunks.
+   *
+   * Slices are neither copyable nor movable: they are built in place and are never
+   * relocated. Each slice is owned by its own ``std::shared_ptr`` (see ``make()``): it is
+   * destroyed when its last reference is dropped (for instance when it is removed from
+   * the temporal domain and no longer referenced elsewhere), and its memory is then reused
+   * for the next slices, which bounds the memory of a tube over a sliding temporal window.
+   * The pointers keep the storage alive, so that the storage is freed after its last slice.
+   */
+  template<typename S>
+  class SliceStorage
+  {
+    public:
+
+      SliceStorage() = default;
+
+      SliceStorage(const SliceStorage&) = delete;
+      SliceStorage& operator=(const SliceStorage&) = delete;
+
+      ~SliceStorage()
+      {
+        // All the slices have been destroyed by their owners
+        std::allocator<S> alloc;
+        for(auto& c : _chunks)
+          alloc.deallocate(c.data, c.capacity);
+      }
+
+      /**
+       * \brief Builds a new slice in the storage, owned by the returned pointer
+       *
+       * When the last reference to the slice is dropped, the slice is destroyed
+       * and its memory is reused by the next slices of the storage.
+       *
+       * \param storage the storage of the slice
+       * \param args arguments of the constructor of the slice
+       * \return pointer to the new slice
+       */
+      template<typename... Args>
+      static std::shared_ptr<S> make(const std::shared_ptr<SliceStorage<S>>& storage, Args&&... args)
+      {
+        return std::shared_ptr<S>(storage->emplace(std::forward<Args>(args)...),
+          [storage](S* s) { storage->release(s); });
+      }
+
+      /**
+       * \brief Ensures that the next ``n`` slices will be stored contiguously
+       *
+       * \param n number of slices to be created
+       */
+      void reserve(size_t n)
+      {
+        if(_chunks.empty() || _chunks.back().capacity - _chunks.back().size < n)
+          _chunks.push_back({ std::allocator<S>().allocate(n), 0, n });
+      }
+
+    protected:
+
+      template<typename... Args>
+      S* emplace(Args&&... args)
+      {
+        {
+          std::lock_guard<std::mutex> lock(_free_mutex);
+          if(!_free.empty()) // memory of a released slice
+          {
+            S* s = std::construct_at(_free.back(), std::forward<Args>(args)...);
+            _free.pop_back();
+            return s;
+          }
+        }
+
+        if(_chunks.empty() || _chunks.back().size == _chunks.back().capacity)
+          reserve(std::max<size_t>(16, _chunks.empty() ? 0 : _chunks.back().capacity/2));
+
+        Chunk& c = _chunks.back();
+        S* s = std::construct_at(c.data + c.size, std::forward<Args>(args)...);
+        c.size++;
+        return s;
+      }
+
+      // Called when the last reference to the slice is dropped, possibly from another thread
+      void release(S* s)
+      {
+        std::destroy_at(s);
+        std::lock_guard<std::mutex> lock(_free_mutex);
+        _free.push_back(s);
+      }
+
+      struct Chunk
+      {
+        S* data;
+        size_t size;
+        size_t capacity;
+      };
+
+      std::vector<Chunk> _chunks;
+      std::vector<S*> _free; // memory of the destroyed slices
+      std::mutex _free_mutex;
+  };
+}
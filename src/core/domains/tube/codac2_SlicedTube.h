@@ -9,10 +9,17 @@
 
 #pragma once
 
+#include <atomic>
+#include <mutex>
+#include <optional>
+#include <utility>
 #include "codac2_SlicedTubeBase.h"
+#include "codac2_SliceStorage.h"
+#include "codac2_TubeHullIndex.h"
 #include "codac2_AnalyticFunction.h"
 #include "codac2_Tube_operator.h"
 #include "codac2_CtcDeriv.h"
+#include "codac2_parallel.h"
 
 namespace codac2
 {
@@ -25,11 +32,7 @@ namespace codac2
         const T& codomain)
         : SlicedTubeBase(tdomain)
       {
-        for(auto it = _tdomain->begin(); it != _tdomain->end(); ++it)
-          it->_slices.insert({
-            this,
-            std::make_shared<Slice<T>>(*this, it, codomain)
-          });
+        create_slices([&codomain](const TSlice&) { return codomain; });
       }
 
       explicit SlicedTube(const std::shared_ptr<TDomain>& tdomain,
@@ -39,11 +42,7 @@ namespace codac2
         assert_release(f.args().size() == 1
           && "function's inputs must be limited to one system variable");
       
-        for(auto it = _tdomain->begin(); it != _tdomain->end(); ++it)
-          it->_slices.insert({
-            this,
-            std::make_shared<Slice<T>>(*this, it, f.eval((Interval)*it))
-          });
+        create_slices([&f](const TSlice& t) { return f.eval((Interval)t); });
       }
 
       template<typename V>
@@ -52,21 +51,13 @@ namespace codac2
         const SampledTraj<V>& f)
         : SlicedTubeBase(tdomain)
       {
-        for(auto it = _tdomain->begin(); it != _tdomain->end(); ++it)
-          it->_slices.insert({
-            this,
-            std::make_shared<Slice<T>>(*this, it, f((Interval)*it))
-          });
+        create_slices([&f](const TSlice& t) { return f((Interval)t); });
       }
 
       SlicedTube(const SlicedTube<T>& x)
         : SlicedTubeBase(x.tdomain())
       {
-        for(auto it = _tdomain->begin(); it != _tdomain->end(); ++it)
-          it->_slices.insert({
-            this,
-            std::make_shared<Slice<T>>(*x.slice(it), *this)
-          });
+        create_slices([&x](const TSlice& t) { return x.slice_ref(t).codomain(); });
       }
 
       inline SlicedTube& operator=(const SlicedTube& x)
@@ -74,7 +65,7 @@ namespace codac2
         assert_release(_tdomain == x._tdomain);
 
         for(auto it = _tdomain->begin(); it != _tdomain->end(); ++it)
-          slice(it)->set(x.slice(it)->codomain(), false);
+          slice_ref(*it).set(x.slice_ref(*it).codomain(), false);
 
         return *this;
       }
@@ -134,7 +125,7 @@ namespace codac2
       inline std::shared_ptr<const Slice<T>> slice(const std::list<TSlice>::const_iterator& it) const
       {
         return std::static_pointer_cast<const Slice<T>>(
-          it->slices().at(this));
+          it->slice(this));
       }
       
       inline std::shared_ptr<Slice<T>> slice(const std::list<TSlice>::reverse_iterator& it)
@@ -146,7 +137,7 @@ namespace codac2
       inline std::shared_ptr<const Slice<T>> slice(const std::list<TSlice>::const_reverse_iterator& it) const
       {
         return std::static_pointer_cast<const Slice<T>>(
-          it->slices().at(this));
+          it->slice(this));
       }
       
       inline std::shared_ptr<Slice<T>> slice(std::shared_ptr<TSlice> ptr)
@@ -196,7 +187,9 @@ namespace codac2
         assert(it != _tdomain->end());
         T codomain = apply_eval(it, t & *it);
 
-        while(it != std::next(_tdomain->tslice(t.ub())))
+        // The slices overlapped by t are enumerated from the first one
+        const auto it_end = std::next(t.is_degenerated() ? it : _tdomain->tslice(t.ub()));
+        while(it != it_end)
         {
           if(it->lb() == t.ub()) break;
           codomain |= apply_eval(it, t & *it);
@@ -210,7 +203,7 @@ namespace codac2
       {
         return eval_common(t,
           [this](auto it, const Interval& t_) {
-            return slice(it)->operator()(t_);
+            return slice_ref(*it)(t_);
           });
       }
 
@@ -219,7 +212,7 @@ namespace codac2
       {
         return eval_common(t,
           [this,&v](auto it, const Interval& t_) {
-            return slice(it)->operator()(t_, *v.slice(it));
+            return slice_ref(*it)(t_, v.slice_ref(*it));
           });
       }
 
@@ -312,11 +305,11 @@ namespace codac2
         // todo: faster implementation with iterators
         for(auto& s : *this)
           if(!s.is_gate())
-            s.set(T(s.codomain()).inflate(rad), false);
+            s.set(T(std::as_const(s).codomain()).inflate(rad), false);
 
         for(auto& s : *this)
           if(s.is_gate())
-            s.set(T(s.codomain()).inflate(rad), false);
+            s.set(T(std::as_const(s).codomain()).inflate(rad), false);
 
         return *this;
       }
@@ -330,11 +323,11 @@ namespace codac2
 
         for(auto& s : *this)
           if(!s.is_gate())
-            s.set(T(s.codomain()).inflate(rad(s.t0_tf()).ub()), false);
+            s.set(T(std::as_const(s).codomain()).inflate(rad(s.t0_tf()).ub()), false);
 
         for(auto& s : *this)
           if(s.is_gate())
-            s.set(T(s.codomain()).inflate(rad(s.t0_tf()).ub()), false);
+            s.set(T(std::as_const(s).codomain()).inflate(rad(s.t0_tf()).ub()), false);
 
         return *this;
       }
@@ -344,7 +337,7 @@ namespace codac2
         assert_release(i >= 0 && i < size());
         SlicedTube<Interval> xi(tdomain(), Interval());
         for(auto it = tdomain()->begin() ; it != tdomain()->end() ; it++)
-          xi.slice(it)->codomain() = slice(it)->codomain()[i];
+          xi.slice(it)->set(slice(it)->codomain()[i], false);
         return xi;
       }
 
@@ -353,7 +346,7 @@ namespace codac2
         assert_release(i >= 0 && i <= j && j < size());
         SlicedTube<IntervalVector> xij(tdomain(), IntervalVector(j-i+1));
         for(auto it = tdomain()->begin() ; it != tdomain()->end() ; it++)
-          xij.slice(it)->codomain() = slice(it)->codomain().subvector(i,j);
+          xij.slice(it)->set(slice(it)->codomain().subvector(i,j), false);
         return xij;
       }
 
@@ -381,7 +374,7 @@ namespace codac2
         while(it_this != _tdomain->end())
         {
           auto s = slice(it_this);
-          s->set(s->codomain() & x.slice(it_x)->codomain());
+          s->set(std::as_const(*s).codomain() & x.slice(it_x)->codomain());
           it_this++; it_x++;
         }
 
@@ -424,6 +417,31 @@ namespace codac2
         Interval t_ = t & _tdomain->t0_tf();
 
         assert(!t_.is_empty() && !t_.is_unbounded());
+
+        if(const TubeHullIndex<T>* h_ = hull_index())
+        {
+          // Only the first and the last slices of [t] reaching [y] are inverted
+          const TubeHullIndex<T>& h = *h_;
+          const size_t i = h.rank(_tdomain->tslice(t_.lb())), j = h.lower_rank(t_.ub());
+
+          for(size_t k = h.first(i,j,y) ; k < j ; k = h.first(k+1,j,y))
+            if(!(invert = apply_invert(h.tslice(k), t & *h.tslice(k))).is_empty())
+              break;
+
+          if(!invert.is_empty())
+            for(size_t k = h.last(i,j,y) ; k < j ; k = h.last(i,k,y))
+            {
+              Interval invert_k = apply_invert(h.tslice(k), t & *h.tslice(k));
+              if(!invert_k.is_empty())
+              {
+                invert |= invert_k;
+                break;
+              }
+            }
+
+          return invert;
+        }
+
         for(auto it = _tdomain->tslice(t_.lb()) ;
           it != _tdomain->end() && it->lb() < t_.ub() ; it++)
         {
@@ -553,6 +571,40 @@ namespace codac2
           });
       }
 
+      // Hull index: when enabled, the inversions of the tube (see invert()) only visit the
+      // first and the last slices of [t] reaching [y], found in O(log n) instead of a scan
+      // over the slices of [t]. The index is a copy of the slices: it is outdated once a slice
+      // is modified, created or removed, and then built again by the next inversion (or by
+      // update_hull_index()). The index is not copied with the tube.
+
+      void enable_hull_index(bool enable = true)
+      {
+        _hull_index_enabled = enable;
+
+        if(!enable)
+        {
+          _hull_index.reset();
+          _hull_index_valid = false;
+        }
+
+        else if(!_hull_index)
+        {
+          _hull_index.emplace(*this);
+          _hull_index_valid = true;
+        }
+      }
+
+      // True if the index is enabled and up to date
+      bool has_hull_index() const
+      {
+        return _hull_index_enabled && _hull_index_valid.load(std::memory_order_acquire);
+      }
+
+      void update_hull_index()
+      {
+        hull_index();
+      }
+
       // Integral related methods
 
       T integral(const Interval& t) const;
@@ -592,6 +644,81 @@ namespace codac2
       }
 
 
+    protected:
+
+      template<typename F>
+      inline void create_slices(const F& codomain)
+      {
+        // The slices are created in time order in a contiguous block of the storage
+        _storage->reserve(_tdomain->nb_tslices());
+        SliceBase* prev = nullptr;
+
+        for(auto it = _tdomain->begin() ; it != _tdomain->end() ; ++it)
+        {
+          auto s = make_slice(*this, it, codomain(*it));
+          s->_prev = prev;
+          if(prev)
+            prev->_next = s.get();
+          prev = s.get();
+          it->_slices.push_back({ this, s });
+        }
+      }
+
+      template<typename... Args>
+      inline std::shared_ptr<Slice<T>> make_slice(Args&&... args) const
+      {
+        // The memory of the slice is reused once the slice is no longer referenced
+        return SliceStorage<Slice<T>>::make(_storage, std::forward<Args>(args)...);
+      }
+
+      inline const Slice<T>& slice_ref(const TSlice& t) const
+      {
+        return static_cast<const Slice<T>&>(*t.slice(this));
+      }
+
+      inline Slice<T>& slice_ref(const TSlice& t)
+      {
+        return static_cast<Slice<T>&>(*t.slice(this));
+      }
+
+      // Called by the slices when they are modified (possibly from several threads)
+      inline void invalidate_hull_index() const
+      {
+        if(_hull_index_valid.load(std::memory_order_relaxed))
+          _hull_index_valid.store(false, std::memory_order_relaxed);
+      }
+
+      // Index of the tube, built again if outdated, or nullptr if not enabled. The index
+      // may be built by concurrent inversions, but not during a modification of the tube.
+      const TubeHullIndex<T>* hull_index() const
+      {
+        if(!_hull_index_enabled)
+          return nullptr;
+
+        if(!_hull_index_valid.load(std::memory_order_acquire))
+        {
+          std::lock_guard<std::mutex> lock(_hull_index_mutex);
+          if(!_hull_index_valid.load(std::memory_order_relaxed))
+          {
+            _hull_index.emplace(*this);
+            _hull_index_valid.store(true, std::memory_order_release);
+          }
+        }
+
+        return &*_hull_index;
+      }
+
+      const std::shared_ptr<SliceStorage<Slice<T>>> _storage
+        = std::make_shared<SliceStorage<Slice<T>>>();
+
+      bool _hull_index_enabled = false;
+      mutable std::optional<TubeHullIndex<T>> _hull_index;
+      mutable std::atomic<bool> _hull_index_valid { false };
+      mutable std::mutex _hull_index_mutex;
+
+      friend class Slice<T>;
+
+
     public:
 
       using base_container = std::list<TSlice>;
@@ -603,9 +730,9 @@ namespace codac2
           iterator(SlicedTube& x, base_container::iterator it)
             : base_container::iterator(it), _x(x) { }
 
-          std::shared_ptr<Slice<T>> operator->()
+          Slice<T>* operator->()
           {
-            return _x.slice(*this);
+            return &_x.slice_ref(base_container::iterator::operator*());
           }
 
           Slice<T>& operator*()
@@ -628,9 +755,9 @@ namespace codac2
           reverse_iterator(SlicedTube& x, base_container::reverse_iterator it)
             : base_container::reverse_iterator(it), _x(x) { }
 
-          std::shared_ptr<Slice<T>> operator->()
+          Slice<T>* operator->()
           {
-            return _x.slice(*this);
+            return &_x.slice_ref(base_container::reverse_iterator::operator*());
           }
 
           Slice<T>& operator*()
@@ -653,9 +780,9 @@ namespace codac2
           const_iterator(const SlicedTube& x, base_container::const_iterator it)
             : base_container::const_iterator(it), _x(x) { }
 
-          std::shared_ptr<const Slice<T>> operator->()
+          const Slice<T>* operator->()
           {
-            return _x.slice(*this);
+            return &_x.slice_ref(base_container::const_iterator::operator*());
           }
 
           const Slice<T>& operator*()
@@ -678,9 +805,9 @@ namespace codac2
           const_reverse_iterator(const SlicedTube& x, base_container::const_reverse_iterator it)
             : base_container::const_reverse_iterator(it), _x(x) { }
 
-          std::shared_ptr<const Slice<T>> operator->()
+          const Slice<T>* operator->()
           {
-            return _x.slice(*this);
+            return &_x.slice_ref(base_container::const_reverse_iterator::operator*());
           }
 
           const Slice<T>& operator*()
@@ -711,12 +838,38 @@ namespace codac2
 
   // Ctc
 
+  // The codomains of the slices are contracted on copies, so that a slice is only
+  // updated (and marked as modified, see SliceBase::is_modified()) if contracted
+  template<typename... X>
+  inline void contract_slices(const CtcBase<X...>& c, Slice<X>*... s)
+  {
+    std::tuple<X...> y { std::as_const(*s).codomain()... };
+    std::apply([&](auto&... yi) {
+        c.contract(yi...);
+        (s->set(yi,false), ...);
+      }, y);
+  }
+
   template<typename... X>
   inline void CtcBase<X...>::contract_tube(SlicedTube<X>&... x) const
   {
-    auto tdomain = std::get<0>(std::make_tuple(x...));
-    for(auto it = tdomain.begin() ; it != tdomain.end() ; it++)
-      contract((x.slice(it)->codomain())...);
+    // Simultaneous sweep over the slices of the tubes (sharing the same tdomain)
+    auto s = std::make_tuple(x.first_slice().get()...);
+    while(std::get<0>(s))
+      std::apply([this](auto&... si) {
+        contract_slices(*this, si...);
+        ((si = si->next_slice_ptr()), ...);
+      }, s);
+  }
+
+  template<typename... X>
+  inline void CtcBase<X...>::parallel_contract_tube(std::size_t nb_threads, SlicedTube<X>&... x) const
+  {
+    // The slices are contracted independently
+    parallel_slices_process([this](auto*... si) {
+        contract_slices(*this, si...);
+      },
+      nb_threads, x.first_slice().get()...);
   }
 }
 
@@ -25,7 +25,7 @@ namespace codac2
       inline ~SlicedTubeBase()
       {
         for(auto& s : *_tdomain)
-          s._slices.erase(this);
+          std::erase_if(s._slices, [this](const auto& si) { return si.first == this; });
       }
 
       inline size_t nb_slices() const
@@ -35,16 +35,12 @@ namespace codac2
 
       inline std::shared_ptr<const SliceBase> first_slice() const
       {
-        const auto& slices = _tdomain->front().slices();
-        assert(slices.find(this) != slices.end());
-        return slices.at(this);
+        return _tdomain->front().slice(this);
       }
 
       inline std::shared_ptr<const SliceBase> last_slice() const
       {
-        const auto& slices = _tdomain->back().slices();
-        assert(slices.find(this) != slices.end());
-        return slices.at(this);
+        return _tdomain->back().slice(this);
       }
   };
 }
\ No newline at end of file
@@ -19,7 +19,9 @@ namespace codac2
 {
   TDomain::TDomain(const Interval& t0_tf)
     : std::list<TSlice>({ TSlice(t0_tf) })
-  { }
+  {
+    index_tslices();
+  }
 
   TDomain::TDomain(const Interval& t0_tf, double dt, bool with_gates)
   {
@@ -39,6 +41,8 @@ namespace codac2
 
     if(with_gates)
       this->push_back(TSlice(t0_tf.ub()));
+
+    index_tslices();
   }
 
   Interval TDomain::t0_tf() const
@@ -99,13 +103,18 @@ namespace codac2
     if(!t0_tf().contains(t))
       return this->end();
 
-    list<TSlice>::iterator it;
-    for(it = this->begin(); it != this->end(); ++it)
-    {
-      if((it->is_gate() && it->lb() == t) // gate
-        || (it->lb() <= t && it->ub() > t)) // slice
-        return it;
-    }
+    // Last lower bound lower or equal to t
+    auto it_index = _index.upper_bound(t);
+    assert(it_index != _index.begin());
+    list<TSlice>::iterator it = std::prev(it_index)->second;
+
+    if(it->is_gate() && it->lb() != t)
+      it++; // the slice starting at the same time
+
+    if(it != this->end()
+      && ((it->is_gate() && it->lb() == t) // gate
+        || (it->lb() <= t && it->ub() > t))) // slice
+      return it;
 
     it = this->end(); it--;
     return it;
@@ -125,11 +134,10 @@ namespace codac2
 
       TSlice ts(*it, Interval(t, t0_tf().lb())); // duplicate with different tdomain
       it = this->insert(it, ts);
+      _index[it->lb()] = it; // first tslice of the tdomain, possibly a new gate at t0
+      link_slices(it);
       for(auto& [k,s] : it->_slices)
-      {
-        s->_it_tslice = it;
         s->init(); // reinitialization to unbounded set
-      }
 
       if(with_gates)
       {
@@ -147,11 +155,10 @@ namespace codac2
       it = this->end();
       TSlice ts(*std::prev(it), Interval(t0_tf().ub(),t)); // duplicate with different tdomain
       it = this->insert(it, ts);
+      _index.emplace_hint(_index.end(), it->lb(), it); // no effect if a gate already starts at this time
+      link_slices(it);
       for(auto& [k,s] : it->_slices)
-      {
-        s->_it_tslice = it;
         s->init(); // reinitialization to unbounded set
-      }
 
       if(with_gates)
         return sample(t, true); // recursive
@@ -179,8 +186,8 @@ namespace codac2
       // From C++ insert() doc: the container is extended by inserting new elements before the element at the specified position
       ++it; // we will insert the new tslice before the next TSlice [t.ub(),..]
       it = this->insert(it, ts); // then, it points to the newly inserted element
-      for(auto& [k,s] : it->_slices) // adding the new iterator pointer to the new slices
-        s->_it_tslice = it;
+      _index.emplace(it->lb(), it); // no effect if the new gate starts at this time
+      link_slices(it); // adding the new iterator pointer to the new slices
       
       // In case the sampling includes the creation of a gate, the method is called again at same t
       if(new_gate_added)
@@ -200,14 +207,83 @@ namespace codac2
       sample(std::min(t0_tf.ub(),t), with_gates);
   }
 
+  list<TSlice>::iterator TDomain::truncate(double t)
+  {
+    assert_release(t0_tf().contains(t));
+
+    // The gate at t encloses the values of the tubes at t: it summarizes
+    // the removed part of the tubes for the next contractions
+    list<TSlice>::iterator it_gate = sample(t, true);
+    assert(it_gate->is_gate() && it_gate->lb() == t);
+
+    while(this->begin() != it_gate)
+      erase_tslice(this->begin());
+
+    _index.erase(_index.begin(), _index.lower_bound(t));
+    return it_gate;
+  }
+
   void TDomain::delete_gates()
   {
     list<TSlice>::iterator it = this->begin();
     while(it != this->end())
     {
-      if(it->is_gate()) this->erase(it++);
+      if(it->is_gate())
+        it = erase_tslice(it);
       else ++it;
     }
+
+    index_tslices();
+  }
+
+  list<TSlice>::iterator TDomain::erase_tslice(list<TSlice>::iterator it)
+  {
+    // The time index is not updated
+    for(auto& [k,s] : it->_slices)
+    {
+      if(s->_prev) s->_prev->_next = s->_next;
+      if(s->_next) s->_next->_prev = s->_prev;
+      s->_prev = s->_next = nullptr;
+      s->detach(); // memory reused by the next slices of the tube, once no longer referenced
+    }
+
+    return this->erase(it);
+  }
+
+  void TDomain::link_slices(list<TSlice>::iterator it)
+  {
+    // The tubes are stored in the same order in all the tslices
+    auto it_prev = it == this->begin() ? this->end() : std::prev(it);
+    auto it_next = std::next(it);
+
+    for(size_t i = 0 ; i < it->_slices.size() ; i++)
+    {
+      SliceBase* s = it->_slices[i].second.get();
+      s->_it_tslice = it;
+
+      s->_prev = it_prev == this->end() ? nullptr : it_prev->_slices[i].second.get();
+      assert(!s->_prev || it_prev->_slices[i].first == it->_slices[i].first);
+      if(s->_prev)
+      {
+        s->_prev->_next = s;
+        s->_prev->_modified = true; // possibly split
+      }
+
+      s->_next = it_next == this->end() ? nullptr : it_next->_slices[i].second.get();
+      assert(!s->_next || it_next->_slices[i].first == it->_slices[i].first);
+      if(s->_next)
+      {
+        s->_next->_prev = s;
+        s->_next->_modified = true;
+      }
+    }
+  }
+
+  void TDomain::index_tslices()
+  {
+    _index.clear();
+    for(auto it = this->begin() ; it != this->end() ; it++)
+      _index.emplace(it->lb(), it); // only the first tslice of each lower bound
   }
 
   ostream& operator<<(ostream& os, const TDomain& x)
@@ -9,6 +9,7 @@
 
 #pragma once
 
+#include <map>
 #include <list>
 #include <memory>
 #include "codac2_TSlice.h"
@@ -33,12 +34,23 @@ namespace codac2
       std::list<TSlice>::iterator tslice(double t); // returns it on last slice if t==t_f, not end
       std::list<TSlice>::iterator sample(double t, bool with_gate = false);
       void sample(const Interval& t0_tf, double dt, bool with_gates = false);
+      std::list<TSlice>::iterator truncate(double t); // removes the tslices before t, returns the gate at t
       void delete_gates();
 
       friend std::ostream& operator<<(std::ostream& os, const TDomain& x);
       static bool are_same(const std::shared_ptr<const TDomain>& tdom1, const std::shared_ptr<const TDomain>& tdom2);
 
     protected:
+
+      void index_tslices();
+      void link_slices(std::list<TSlice>::iterator it);
+      std::list<TSlice>::iterator erase_tslice(std::list<TSlice>::iterator it);
+
+      // Time index: for each lower bound, iterator on the first tslice starting
+      // at this bound (a gate, if any, is before the slice starting at the same time).
+      // It provides a O(log n) lookup in tslice(t), and is maintained by the methods
+      // modifying the list of tslices.
+      std::map<double,std::list<TSlice>::iterator> _index;
       
       friend std::shared_ptr<TDomain> create_tdomain(const Interval&);
       friend std::shared_ptr<TDomain> create_tdomain(const Interval&,double,bool);
@@ -7,6 +7,8 @@
  *  \license    GNU Lesser General Public License (LGPL)
  */
 
+#include <cassert>
+#include <algorithm>
 #include "codac2_Interval.h"
 #include "codac2_TSlice.h"
 #include "codac2_SliceBase.h"
@@ -22,8 +24,9 @@ namespace codac2
   TSlice::TSlice(const TSlice& tslice, const Interval& tdomain)
     : TSlice(tdomain)
   {
+    _slices.reserve(tslice._slices.size());
     for(const auto&[k,s] : tslice._slices)
-      _slices.insert({ k, s->copy() });
+      _slices.push_back({ k, s->copy() });
   }
 
   bool TSlice::is_gate() const
@@ -31,11 +34,19 @@ namespace codac2
     return this->is_degenerated();
   }
 
-  const map<const SlicedTubeBase*,shared_ptr<SliceBase>>& TSlice::slices() const
+  const vector<pair<const SlicedTubeBase*,shared_ptr<SliceBase>>>& TSlice::slices() const
   {
     return _slices;
   }
 
+  const shared_ptr<SliceBase>& TSlice::slice(const SlicedTubeBase* tube) const
+  {
+    auto it = std::find_if(_slices.begin(), _slices.end(),
+      [tube](const auto& s) { return s.first == tube; });
+    assert(it != _slices.end());
+    return it->second;
+  }
+
   bool TSlice::operator==(const TSlice& x) const
   {
     return Interval::operator==(x);
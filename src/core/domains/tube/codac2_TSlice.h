@@ -9,7 +9,7 @@
 
 #pragma once
 
-#include <map>
+#include <vector>
 #include <memory>
 
 namespace codac2
@@ -25,13 +25,16 @@ namespace codac2
       explicit TSlice(const Interval& tdomain);
       TSlice(const TSlice& tslice, const Interval& tdomain); // performs a deep copy on slices
       bool is_gate() const;
-      const std::map<const SlicedTubeBase*,std::shared_ptr<SliceBase>>& slices() const;
+      const std::vector<std::pair<const SlicedTubeBase*,std::shared_ptr<SliceBase>>>& slices() const;
+      const std::shared_ptr<SliceBase>& slice(const SlicedTubeBase* tube) const;
       bool operator==(const TSlice& x) const;
       bool operator==(const Interval& x) const;
 
     protected:
 
-      std::map<const SlicedTubeBase*,std::shared_ptr<SliceBase>> _slices;
+      // Slices of the tubes defined over this tslice. The tubes are few, and they
+      // are stored in the same order in all the tslices of a TDomain.
+      std::vector<std::pair<const SlicedTubeBase*,std::shared_ptr<SliceBase>>> _slices;
 
       friend class TDomain;
       friend class SlicedTubeBase;
@@ -0,0 +1,189 @@
+/**
+ *  \file codac2_TubeHullIndex.h
+ * ----------------------------------------------------------------------------
+ *  \date       2025
+ *  \author     Simon Rohou
+ *  \copyright  Copyright 2025 Codac Team
+ *  \license    GNU Lesser General Public License (LGPL)
+ */
+
+#pragma once
+
+#include <list>
+#include <vector>
+#include <utility>
+#include <algorithm>
+#include "codac2_Interval.h"
+#include "codac2_TSlice.h"
+
+namespace codac2
+{
+  template<typename T>
+  class SlicedTube;
+
+  /**
+   * \class TubeHullIndex
+   * \brief Index of the slices of a tube, for the search of the slices whose envelopes
+   * intersect a set over a range of slices.
+   *
+   * The envelope of each slice (the hull of its codomain and of its input and output gates)
+   * is stored in time order in the leaves of a segment tree, each node enclosing the hull of
+   * its children. The first (or the last) slice of a range whose envelope intersects \f$[y]\f$
+   * is found by a descent in the tree, without exploring the subtrees whose hulls do not
+   * intersect \f$[y]\f$. This is done in \f$\mathcal{O}(\log n)\f$ for \f$n\f$ slices, unless
+   * many hulls of vector values intersect \f$[y]\f$ while their slices do not.
+   *
+   * The gates of the tube have empty leaves: they are never returned. The index is a copy
+   * of the envelopes of the slices when it is built: it has to be built again after any
+   * modification of the tube.
+   */
+  template<typename T>
+  class TubeHullIndex
+  {
+    public:
+
+      /**
+       * \brief Builds the index of the slices of a tube
+       *
+       * \param x tube
+       */
+      explicit TubeHullIndex(const SlicedTube<T>& x)
+      {
+        _dim = x.first_slice()->codomain().size();
+
+        for(auto it = x.tdomain()->begin() ; it != x.tdomain()->end() ; ++it)
+          _tslices.push_back(it);
+
+        while(_cap < _tslices.size())
+          _cap *= 2;
+
+        _h.assign(2*_cap*_dim, Interval::empty());
+        for(size_t k = 0 ; k < _tslices.size() ; k++)
+          if(!_tslices[k]->is_gate())
+          {
+            auto s = x.slice(std::list<TSlice>::const_iterator(_tslices[k]));
+            T e = s->codomain() | s->input_gate() | s->output_gate();
+            std::copy(data(e), data(e)+_dim, _h.begin()+(_cap+k)*_dim);
+          }
+
+        for(size_t i = _cap-1 ; i > 0 ; i--)
+          for(size_t k = 0 ; k < _dim ; k++)
+            _h[i*_dim+k] = _h[2*i*_dim+k] | _h[(2*i+1)*_dim+k];
+      }
+
+      /**
+       * \brief Number of indexed tslices, gates included
+       *
+       * \return number of tslices
+       */
+      size_t nb_tslices() const
+      {
+        return _tslices.size();
+      }
+
+      /**
+       * \brief Iterator on the \f$k\f$-th tslice of the tube, in time order
+       *
+       * \param k rank of the tslice
+       * \return iterator on the tslice
+       */
+      const std::list<TSlice>::iterator& tslice(size_t k) const
+      {
+        assert(k < _tslices.size());
+        return _tslices[k];
+      }
+
+      /**
+       * \brief Rank of a tslice of the tube
+       *
+       * \param it iterator on the tslice
+       * \return rank of the tslice
+       */
+      size_t rank(const std::list<TSlice>::iterator& it) const
+      {
+        // A gate is before the slice starting at the same time
+        auto key = [](const std::list<TSlice>::iterator& i) {
+          return std::make_pair(i->lb(), !i->is_gate());
+        };
+
+        return std::lower_bound(_tslices.begin(), _tslices.end(), it,
+          [&key](const auto& a, const auto& b) { return key(a) < key(b); }) - _tslices.begin();
+      }
+
+      /**
+       * \brief Rank of the first tslice starting at or after \f$t\f$
+       *
+       * \param t time
+       * \return rank of the tslice, or the number of tslices if none
+       */
+      size_t lower_rank(double t) const
+      {
+        return std::lower_bound(_tslices.begin(), _tslices.end(), t,
+          [](const std::list<TSlice>::iterator& a, double t_) { return a->lb() < t_; }) - _tslices.begin();
+      }
+
+      /**
+       * \brief Rank of the first slice \f$k\f$, \f$i\leqslant k<j\f$, whose envelope
+       * intersects \f$[y]\f$
+       *
+       * \param i rank of the first tslice
+       * \param j rank following the last tslice
+       * \param y set of values
+       * \return rank of the slice, or the number of tslices if none
+       */
+      size_t first(size_t i, size_t j, const T& y) const
+      {
+        return find(1, 0, _cap, i, j, data(y), true);
+      }
+
+      /**
+       * \brief Rank of the last slice \f$k\f$, \f$i\leqslant k<j\f$, whose envelope
+       * intersects \f$[y]\f$
+       *
+       * \param i rank of the first tslice
+       * \param j rank following the last tslice
+       * \param y set of values
+       * \return rank of the slice, or the number of tslices if none
+       */
+      size_t last(size_t i, size_t j, const T& y) const
+      {
+        return find(1, 0, _cap, i, j, data(y), false);
+      }
+
+    protected:
+
+      static const Interval* data(const T& x)
+      {
+        if constexpr(std::is_same_v<T,Interval>)
+          return &x;
+        else
+          return x.data();
+      }
+
+      // First (or last) slice of ranks i<=k<j in the subtree of the node p,
+      // covering the tslices of ranks a<=k<b, nb_tslices() if none
+      size_t find(size_t p, size_t a, size_t b, size_t i, size_t j, const Interval* y, bool first) const
+      {
+        if(b <= i || a >= j || a >= _tslices.size())
+          return _tslices.size();
+
+        for(size_t k = 0 ; k < _dim ; k++)
+          if(!_h[p*_dim+k].intersects(y[k]))
+            return _tslices.size();
+
+        if(b == a+1)
+          return a;
+
+        const size_t m = (a+b)/2;
+        size_t k = first ? find(2*p, a, m, i, j, y, first) : find(2*p+1, m, b, i, j, y, first);
+        if(k == _tslices.size())
+          k = first ? find(2*p+1, m, b, i, j, y, first) : find(2*p, a, m, i, j, y, first);
+        return k;
+      }
+
+      std::vector<std::list<TSlice>::iterator> _tslices; // tslices of the tube, in time order
+      std::vector<Interval> _h; // nodes of the segment tree, the leaves being stored from the node _cap
+      size_t _cap = 1;
+      size_t _dim = 1; // number of components of the values
+  };
+}
@@ -37,12 +37,10 @@ namespace codac2
       };
     }
 
-    static void bwd(
-      [[maybe_unused]] const TU& x1,
-      [[maybe_unused]] const typename Type::Domain& y,
-      [[maybe_unused]] Interval& x2)
+    static void bwd(const TU& x1, const typename Type::Domain& y, Interval& x2)
     {
-      // todo
+      // The time is contracted by the inversion of the tube
+      x2 &= x1.invert(y, x2);
     }
   };
 
@@ -54,6 +52,15 @@ namespace codac2
     public:
 
       AnalyticOperationExpr(const TU& x1, const ScalarExpr& x2)
+        : AnalyticOperationExpr([&x1]() {
+            // The copy of the tube is indexed for the inversions of TubeOp::bwd
+            auto x1_ = std::make_shared<TU>(x1);
+            x1_->enable_hull_index();
+            return std::shared_ptr<const TU>(x1_);
+          }(), x2)
+      { }
+
+      AnalyticOperationExpr(const std::shared_ptr<const TU>& x1, const ScalarExpr& x2)
         : OperationExprBase<AnalyticExpr<ScalarType>>(x2), _x1(x1)
       { }
 
@@ -70,17 +77,53 @@ namespace codac2
       T fwd_eval(ValuesMap& v, Index total_input_size, bool natural_eval) const
       {
         return AnalyticExpr<T>::init_value(
-          v, TubeOp<TU>::fwd(_x1, std::get<0>(this->_x)->fwd_eval(v, total_input_size, natural_eval)));
+          v, TubeOp<TU>::fwd(*_x1, std::get<0>(this->_x)->fwd_eval(v, total_input_size, natural_eval)));
       }
       
       void bwd_eval(ValuesMap& v) const
       {
-        TubeOp<TU>::bwd(_x1, AnalyticExpr<T>::value(v).a, std::get<0>(this->_x)->value(v).a);
+        TubeOp<TU>::bwd(*_x1, AnalyticExpr<T>::value(v).a, std::get<0>(this->_x)->value(v).a);
         std::get<0>(this->_x)->bwd_eval(v);
       }
 
+      void compile(AnalyticTape& t) const
+      {
+        std::get<0>(this->_x)->compile(t);
+        t.add_step(*this, 1);
+      }
+
+      void fwd_eval_step(ValuesSlots& v, const Index* s, [[maybe_unused]] Index total_input_size, [[maybe_unused]] bool natural_eval) const
+      {
+        AnalyticExpr<T>::init_value(
+          v, s[0], TubeOp<TU>::fwd(*_x1, AnalyticExpr<ScalarType>::value(v, s[1])));
+      }
+
+      void bwd_eval_step(ValuesSlots& v, const Index* s) const
+      {
+        TubeOp<TU>::bwd(*_x1, AnalyticExpr<T>::value(v, s[0]).a, AnalyticExpr<ScalarType>::value(v, s[1]).a);
+      }
+
+      void fwd_eval_batch_step(ValuesSlots& v, const Index* s, Index n, [[maybe_unused]] Index total_input_size, [[maybe_unused]] bool natural_eval) const
+      {
+        auto& x1 = AnalyticExpr<ScalarType>::batch_value(v, s[1]);
+        AnalyticExpr<T>::init_batch_value(
+          v, s[0], n, [&](Index k) { return TubeOp<TU>::fwd(*_x1, x1.get(k)); });
+      }
+
+      void bwd_eval_batch_step(ValuesSlots& v, const Index* s) const
+      {
+        bwd_batch([&](auto& y, auto& x1) { TubeOp<TU>::bwd(*_x1, y, x1); },
+          AnalyticExpr<T>::batch_value(v, s[0]), AnalyticExpr<ScalarType>::batch_value(v, s[1]));
+      }
+
+      bool is_same_operation(const AnalyticExprBase& e) const
+      {
+        // Copies of the expression share the same tube
+        return dynamic_cast<const AnalyticOperationExpr<TubeOp<TU>,T,S>&>(e)._x1 == _x1;
+      }
+
       std::pair<Index,Index> output_shape() const {
-        return _x1.shape();
+        return _x1->shape();
       }
 
       virtual bool belongs_to_args_list(const FunctionArgsList& args) const
@@ -101,6 +144,8 @@ namespace codac2
 
     protected:
 
-      const TU _x1;
+      // The tube is shared (and not modified) by the copies of the expression,
+      // which are then built without copying its data
+      const std::shared_ptr<const TU> _x1;
   };
 }
@@ -10,19 +10,48 @@
 #pragma once
 
 #include <map>
+#include <array>
+#include <algorithm>
+#include <tuple>
 #include <memory>
 #include <utility>
+#include <type_traits>
 #include "codac2_ExprBase.h"
 #include "codac2_Domain.h"
 #include "codac2_FunctionArgsList.h"
 #include "codac2_AnalyticType.h"
+#include "codac2_AnalyticTape.h"
+#include "codac2_interval_kernels.h"
 
 namespace codac2
 {
   using ValuesMap = std::map<ExprID,std::shared_ptr<AnalyticTypeBase>>;
 
+  class AnalyticExprBase : public ExprBase
+  {
+    public:
+
+      // Compiled evaluation (see AnalyticTape)
+
+      virtual void compile(AnalyticTape& t) const = 0;
+      virtual void fwd_eval_step(ValuesSlots& v, const Index* s, Index total_input_size, bool natural_eval) const = 0;
+      virtual void bwd_eval_step(ValuesSlots& v, const Index* s) const = 0;
+      virtual void fwd_eval_batch_step(ValuesSlots& v, const Index* s, Index n, Index total_input_size, bool natural_eval) const = 0;
+      virtual void bwd_eval_batch_step(ValuesSlots& v, const Index* s) const = 0;
+
+      /**
+       * \brief Tests if this node computes the same operation as ``e``, assuming that ``e``
+       * is of the same type and that their operands have the same values. The two nodes
+       * then share the same value in a compiled expression (see AnalyticTape).
+       *
+       * \param e node of the same type
+       * \return ``true`` if the two nodes compute the same value from their operands
+       */
+      virtual bool is_same_operation(const AnalyticExprBase& e) const = 0;
+  };
+
   template<typename T>
-  class AnalyticExpr : public ExprBase
+  class AnalyticExpr : public AnalyticExprBase
   {
     public:
 
@@ -58,11 +87,117 @@ namespace codac2
         return *p;
       }
 
+      static const T& init_value(ValuesSlots& v, Index i, T&& x)
+      {
+        auto& p = v[i];
+
+        if(!p)
+          p = std::make_unique<T>(std::move(x));
+
+        else
+        {
+          assert(dynamic_cast<T*>(p.get()) && "Type mismatch in ValuesSlots for this slot");
+          *static_cast<T*>(p.get()) = std::move(x);
+        }
+
+        return *static_cast<T*>(p.get());
+      }
+
+      static T& value(ValuesSlots& v, Index i)
+      {
+        assert(v[i] && "argument cannot be found");
+        assert(dynamic_cast<T*>(v[i].get()) && "Type mismatch in ValuesSlots for this slot");
+        return *static_cast<T*>(v[i].get());
+      }
+
+      static AnalyticTypeBatch<T>& init_batch_value(ValuesSlots& v, Index i)
+      {
+        auto& p = v[i];
+
+        if(!p)
+          p = std::make_unique<AnalyticTypeBatch<T>>();
+        assert(dynamic_cast<AnalyticTypeBatch<T>*>(p.get()) && "Type mismatch in ValuesSlots for this slot");
+        return *static_cast<AnalyticTypeBatch<T>*>(p.get());
+      }
+
+      template<typename F>
+      static void init_batch_value(ValuesSlots& v, Index i, Index n, const F& f)
+      {
+        auto& y = init_batch_value(v, i);
+
+        if(n == 0)
+          y.resize(0, 0, 0, 0);
+
+        for(Index k = 0 ; k < n ; k++)
+        {
+          T yk = f(k);
+          if(k == 0) // the shape of the values is the same for all the inputs
+            y.resize(n, yk);
+          y.set(k, yk);
+        }
+      }
+
+      static AnalyticTypeBatch<T>& batch_value(ValuesSlots& v, Index i)
+      {
+        assert(v[i] && "argument cannot be found");
+        assert(dynamic_cast<AnalyticTypeBatch<T>*>(v[i].get()) && "Type mismatch in ValuesSlots for this slot");
+        return *static_cast<AnalyticTypeBatch<T>*>(v[i].get());
+      }
+
       virtual bool belongs_to_args_list(const FunctionArgsList& args) const = 0;
       virtual std::string str(bool in_parentheses = false) const = 0;
       virtual bool is_str_leaf() const = 0;
   };
 
+  // Value of the I-th operand of a batch backward evaluation, or of its first
+  // occurrence when the operand appears several times (same slot) in the operation
+  template<std::size_t I,std::size_t J = 0,typename Tuple,typename Ids>
+  auto& bwd_batch_operand(Tuple& a, const Ids& id)
+  {
+    if constexpr(J == I)
+      return std::get<I>(a);
+
+    else
+    {
+      if constexpr(std::is_same_v<std::tuple_element_t<I,Tuple>,std::tuple_element_t<J,Tuple>>)
+        if(id[J] == id[I])
+          return std::get<J>(a);
+      return bwd_batch_operand<I,J+1>(a, id);
+    }
+  }
+
+  /**
+   * \brief Backward evaluation of an operation over a batch of inputs: for each input,
+   * the values of the operands are gathered, contracted by ``f`` and written back.
+   * An operand appearing several times in the operation (for instance in ``x*x``) is
+   * contracted as a single value, as in the evaluation of a single input.
+   *
+   * \param f backward operation, called with the values of the operands
+   * \param x batch values of the operands
+   */
+  template<typename F,typename... B>
+  void bwd_batch(const F& f, B&... x)
+  {
+    const std::array<const AnalyticTypeBase*,sizeof...(B)> id { &x... };
+    const auto b = std::tie(x...);
+
+    for(Index k = 0 ; k < std::get<0>(b).n ; k++)
+    {
+      std::tuple<typename B::Domain...> a { x.a(k)... };
+
+      [&]<std::size_t... I>(std::index_sequence<I...>)
+      {
+        f(bwd_batch_operand<I>(a, id)...);
+        // Written back in reverse order, so that the first occurrences are written last
+        (std::get<sizeof...(B)-1-I>(b).set_a(k, std::get<sizeof...(B)-1-I>(a)), ...);
+      }(std::index_sequence_for<B...>());
+    }
+  }
+
+  struct AddOp;
+  struct SubOp;
+  struct MulOp;
+
   template<typename C,typename Y,typename... X>
   class AnalyticOperationExpr : public AnalyticExpr<Y>, public OperationExprBase<AnalyticExpr<X>...>
   {
@@ -117,6 +252,41 @@ namespace codac2
         }, this->_x);
       }
 
+      void compile(AnalyticTape& t) const
+      {
+        std::apply([&t](auto &&... x)
+        {
+          (x->compile(t), ...);
+        }, this->_x);
+
+        t.add_step(*this, sizeof...(X));
+      }
+
+      void fwd_eval_step(ValuesSlots& v, const Index* s, [[maybe_unused]] Index total_input_size, bool natural_eval) const
+      {
+        fwd_eval_step_(v, s, natural_eval, std::index_sequence_for<X...>());
+      }
+
+      void bwd_eval_step(ValuesSlots& v, const Index* s) const
+      {
+        bwd_eval_step_(v, s, std::index_sequence_for<X...>());
+      }
+
+      void fwd_eval_batch_step(ValuesSlots& v, const Index* s, Index n, [[maybe_unused]] Index total_input_size, bool natural_eval) const
+      {
+        fwd_eval_batch_step_(v, s, n, natural_eval, std::index_sequence_for<X...>());
+      }
+
+      void bwd_eval_batch_step(ValuesSlots& v, const Index* s) const
+      {
+        bwd_eval_batch_step_(v, s, std::index_sequence_for<X...>());
+      }
+
+      bool is_same_operation([[maybe_unused]] const AnalyticExprBase& e) const
+      {
+        return true; // the operation is entirely defined by C
+      }
+
       virtual std::string str(bool in_parentheses = false) const
       {
         std::string s = std::apply([](auto &&... x) {
@@ -151,5 +321,225 @@ namespace codac2
 
         return b;
       }
+
+    protected:
+
+      template<std::size_t... I>
+      void fwd_eval_step_(ValuesSlots& v, const Index* s, bool natural_eval, std::index_sequence<I...>) const
+      {
+        if(natural_eval)
+          AnalyticExpr<Y>::init_value(v, s[0],
+            C::fwd_natural(AnalyticExpr<X>::value(v, s[I+1])...));
+
+        else
+          AnalyticExpr<Y>::init_value(v, s[0],
+            C::fwd_centered(AnalyticExpr<X>::value(v, s[I+1])...));
+      }
+
+      template<std::size_t... I>
+      void bwd_eval_step_(ValuesSlots& v, const Index* s, std::index_sequence<I...>) const
+      {
+        C::bwd(AnalyticExpr<Y>::value(v, s[0]).a, AnalyticExpr<X>::value(v, s[I+1]).a...);
+      }
+
+      template<std::size_t... I>
+      void fwd_eval_batch_step_(ValuesSlots& v, const Index* s, Index n, bool natural_eval, std::index_sequence<I...>) const
+      {
+        // Element-wise operations are computed on the arrays of bounds of the whole batch
+        if constexpr(is_elementwise_batch_op())
+          if(natural_eval || centered_batch_available(AnalyticExpr<X>::batch_value(v, s[I+1])...))
+          {
+            elementwise_batch_fwd(AnalyticExpr<Y>::init_batch_value(v, s[0]), natural_eval,
+              AnalyticExpr<X>::batch_value(v, s[I+1])...);
+            return;
+          }
+
+        auto x = std::tie(AnalyticExpr<X>::batch_value(v, s[I+1])...);
+
+        if(natural_eval)
+          AnalyticExpr<Y>::init_batch_value(v, s[0], n,
+            [&x](Index k) { return C::fwd_natural(std::get<I>(x).get(k)...); });
+
+        else
+          AnalyticExpr<Y>::init_batch_value(v, s[0], n,
+            [&x](Index k) { return C::fwd_centered(std::get<I>(x).get(k)...); });
+      }
+
+      template<std::size_t... I>
+      void bwd_eval_batch_step_(ValuesSlots& v, const Index* s, std::index_sequence<I...>) const
+      {
+        if constexpr(is_elementwise_batch_op() && !std::is_same_v<C,MulOp>)
+          elementwise_batch_bwd(AnalyticExpr<Y>::batch_value(v, s[0]), AnalyticExpr<X>::batch_value(v, s[I+1])...);
+
+        else
+          bwd_batch([](auto& y, auto&... x) { C::bwd(y, x...); },
+            AnalyticExpr<Y>::batch_value(v, s[0]), AnalyticExpr<X>::batch_value(v, s[I+1])...);
+      }
+
+      static constexpr bool is_elementwise_batch_op()
+      {
+        constexpr bool same_types = (std::is_same_v<X,Y> && ...);
+        if constexpr(std::is_same_v<C,AddOp> || std::is_same_v<C,SubOp>)
+          return same_types && sizeof...(X) <= 2;
+        else if constexpr(std::is_same_v<C,MulOp>)
+          return same_types && sizeof...(X) == 2 && std::is_same_v<Y,ScalarType>;
+        else
+          return false;
+      }
+
+      static bool centered_batch_available(const AnalyticTypeBatch<X>&... x)
+      {
+        // Otherwise, the centered form is not available for some inputs
+        // and the operation is evaluated input by input
+        const Index c = std::get<0>(std::tie(x...)).da_cols;
+        return c != 0 && ((x.da_cols == c
+          && std::all_of(x.has_da.begin(), x.has_da.end(), [](char b) { return b; })) && ...);
+      }
+
+      // Values of the operation, computed on arrays of bounds (x2 is not used by unary operations)
+      static void fwd_bounds(const double* x1_lb, const double* x1_ub, const double* x2_lb, const double* x2_ub,
+        double* y_lb, double* y_ub, Index m)
+      {
+        if constexpr(sizeof...(X) == 1)
+        {
+          if constexpr(std::is_same_v<C,AddOp>)
+          {
+            std::copy(x1_lb, x1_lb+m, y_lb);
+            std::copy(x1_ub, x1_ub+m, y_ub);
+          }
+
+          else // unary minus
+            for(Index i = 0 ; i < m ; i++)
+            {
+              y_lb[i] = -x1_ub[i];
+              y_ub[i] = -x1_lb[i];
+            }
+        }
+
+        else if constexpr(std::is_same_v<C,AddOp>)
+          IntervalKernels::add(x1_lb, x1_ub, x2_lb, x2_ub, y_lb, y_ub, m);
+        else if constexpr(std::is_same_v<C,SubOp>)
+          IntervalKernels::sub(x1_lb, x1_ub, x2_lb, x2_ub, y_lb, y_ub, m);
+        else
+          IntervalKernels::mul(x1_lb, x1_ub, x2_lb, x2_ub, y_lb, y_ub, m);
+      }
+
+      static void elementwise_batch_fwd(AnalyticTypeBatch<Y>& y, bool natural_eval, const AnalyticTypeBatch<X>&... x)
+      {
+        const auto& x1 = std::get<0>(std::tie(x...));
+        const auto& x2 = std::get<sizeof...(X)-1>(std::tie(x...));
+        assert(x1.n == x2.n && x1.size() == x2.size());
+
+        y.resize(x1.n, x1.rows, x1.cols, natural_eval ? 0 : x1.da_cols);
+        const Index m = y.size()*y.n;
+
+        fwd_bounds(x1.a_lb.data(), x1.a_ub.data(), x2.a_lb.data(), x2.a_ub.data(), y.a_lb.data(), y.a_ub.data(), m);
+
+        if(!natural_eval)
+        {
+          fwd_bounds(x1.m_lb.data(), x1.m_ub.data(), x2.m_lb.data(), x2.m_ub.data(), y.m_lb.data(), y.m_ub.data(), m);
+
+          if constexpr(std::is_same_v<C,MulOp>)
+          {
+            // Derivatives x1.da*x2.a+x1.a*x2.da of scalar values, column by column
+            std::vector<double> t1_lb(y.n), t1_ub(y.n), t2_lb(y.n), t2_ub(y.n);
+            for(Index j = 0 ; j < y.da_cols ; j++)
+            {
+              const Index o = j*y.n;
+              IntervalKernels::mul(x1.da_lb.data()+o, x1.da_ub.data()+o, x2.a_lb.data(), x2.a_ub.data(), t1_lb.data(), t1_ub.data(), y.n);
+              IntervalKernels::mul(x1.a_lb.data(), x1.a_ub.data(), x2.da_lb.data()+o, x2.da_ub.data()+o, t2_lb.data(), t2_ub.data(), y.n);
+              IntervalKernels::add(t1_lb.data(), t1_ub.data(), t2_lb.data(), t2_ub.data(), y.da_lb.data()+o, y.da_ub.data()+o, y.n);
+            }
+          }
+
+          else
+            fwd_bounds(x1.da_lb.data(), x1.da_ub.data(), x2.da_lb.data(), x2.da_ub.data(),
+              y.da_lb.data(), y.da_ub.data(), m*y.da_cols);
+        }
+
+        for(Index k = 0 ; k < y.n ; k++)
+          y.def_domain[k] = x1.def_domain[k] && x2.def_domain[k];
+      }
+
+      // x &= y on arrays of bounds
+      static void inter_bounds(double* x_lb, double* x_ub, const double* y_lb, const double* y_ub, Index m)
+      {
+        for(Index i = 0 ; i < m ; i++)
+        {
+          x_lb[i] = std::max(x_lb[i], y_lb[i]);
+          x_ub[i] = std::min(x_ub[i], y_ub[i]);
+          if(x_lb[i] > x_ub[i])
+          {
+            x_lb[i] = oo;
+            x_ub[i] = -oo;
+          }
+        }
+      }
+
+      // Components of x set empty where the components of e are empty
+      static void propagate_empty_bounds(const double* e_lb, const double* e_ub, double* x_lb, double* x_ub, Index m)
+      {
+        for(Index i = 0 ; i < m ; i++)
+          if(e_lb[i] > e_ub[i])
+          {
+            x_lb[i] = oo;
+            x_ub[i] = -oo;
+          }
+      }
+
+      // Same contractions as AddOp::bwd and SubOp::bwd, for all the inputs. Operands appearing
+      // twice in the operation share the same arrays, as in the evaluation of a single input.
+      static void elementwise_batch_bwd(const AnalyticTypeBatch<Y>& y, AnalyticTypeBatch<X>&... x)
+      {
+        auto& x1 = std::get<0>(std::tie(x...));
+        const Index m = y.size()*y.n;
+        std::vector<double> t_lb(m), t_ub(m);
+
+        if constexpr(sizeof...(X) == 1)
+        {
+          if constexpr(std::is_same_v<C,SubOp>) // unary minus: 0 must belong to y+x1, then x1 &= -y
+          {
+            IntervalKernels::add(y.a_lb.data(), y.a_ub.data(), x1.a_lb.data(), x1.a_ub.data(), t_lb.data(), t_ub.data(), m);
+            for(Index i = 0 ; i < m ; i++)
+            {
+              if(t_lb[i] > 0. || t_ub[i] < 0.) // also true for the empty set
+              {
+                x1.a_lb[i] = oo;
+                x1.a_ub[i] = -oo;
+              }
+
+              else
+              {
+                x1.a_lb[i] = std::max(x1.a_lb[i], -y.a_ub[i]);
+                x1.a_ub[i] = std::min(x1.a_ub[i], -y.a_lb[i]);
+                if(x1.a_lb[i] > x1.a_ub[i])
+                {
+                  x1.a_lb[i] = oo;
+                  x1.a_ub[i] = -oo;
+                }
+              }
+            }
+          }
+        }
+
+        else
+        {
+          auto& x2 = std::get<1>(std::tie(x...));
+
+          if constexpr(std::is_same_v<C,AddOp>) // x1 &= y-x2
+            IntervalKernels::sub(y.a_lb.data(), y.a_ub.data(), x2.a_lb.data(), x2.a_ub.data(), t_lb.data(), t_ub.data(), m);
+          else // x1 &= y+x2
+            IntervalKernels::add(y.a_lb.data(), y.a_ub.data(), x2.a_lb.data(), x2.a_ub.data(), t_lb.data(), t_ub.data(), m);
+          inter_bounds(x1.a_lb.data(), x1.a_ub.data(), t_lb.data(), t_ub.data(), m);
+          propagate_empty_bounds(x1.a_lb.data(), x1.a_ub.data(), x2.a_lb.data(), x2.a_ub.data(), m);
+
+          if constexpr(std::is_same_v<C,AddOp>) // x2 &= y-x1
+            IntervalKernels::sub(y.a_lb.data(), y.a_ub.data(), x1.a_lb.data(), x1.a_ub.data(), t_lb.data(), t_ub.data(), m);
+          else // x2 &= x1-y
+            IntervalKernels::sub(x1.a_lb.data(), x1.a_ub.data(), y.a_lb.data(), y.a_ub.data(), t_lb.data(), t_ub.data(), m);
+          inter_bounds(x2.a_lb.data(), x2.a_ub.data(), t_lb.data(), t_ub.data(), m);
+          propagate_empty_bounds(x2.a_lb.data(), x2.a_ub.data(), x1.a_lb.data(), x1.a_ub.data(), m);
+        }
+      }
   };
 }
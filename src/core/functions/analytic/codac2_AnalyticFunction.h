@@ -10,6 +10,7 @@
 #pragma once
 
 #include <map>
+#include <vector>
 #include "codac2_AnalyticExpr.h"
 #include "codac2_Domain.h"
 #include "codac2_analytic_variables.h"
@@ -22,6 +23,7 @@
 #include "codac2_Wrapper.h"
 #include "codac2_Parallelepiped.h"
 #include "codac2_peibos_tools.h"
+#include "codac2_parallel.h"
 
 namespace codac2
 {
@@ -67,6 +69,7 @@ namespace codac2
         assert_release(y->belongs_to_args_list(this->args()) && 
           "Invalid argument: variable not present in input arguments");
         update_var_names();
+        compile();
       }
 
       AnalyticFunction(const FunctionArgsList& args, const AnalyticExprWrapper<T>& y)
@@ -75,11 +78,14 @@ namespace codac2
         assert_release(y->belongs_to_args_list(this->args()) && 
           "Invalid argument: variable not present in input arguments");
         update_var_names();
+        compile();
       }
 
       AnalyticFunction(const AnalyticFunction<T>& f)
         : FunctionBase<AnalyticExpr<T>>(f)
-      { }
+      {
+        compile();
+      }
 
       template<typename... X>
       AnalyticExprWrapper<T> operator()(const X&... x) const
@@ -98,66 +104,11 @@ namespace codac2
       {
         check_valid_inputs(x...);
 
-        switch(m)
-        {
-          case EvalMode::NATURAL:
-          {
-            return eval_<true>(x...).a;
-          }
-
-          case EvalMode::CENTERED:
-          {
-            auto x_ = eval_<false>(x...);
-            auto flatten_x = IntervalVector(cart_prod(x...));
-            assert(x_.da.rows() == x_.a.size() && x_.da.cols() == flatten_x.size());
-            
-            if constexpr(std::is_same_v<T,ScalarType>)
-              return x_.m + (x_.da*(flatten_x-flatten_x.mid()))[0];
-
-            else if constexpr(std::is_same_v<T,VectorType>)
-              return x_.m + (x_.da*(flatten_x-flatten_x.mid())).col(0);
-
-            else
-            {
-              static_assert(std::is_same_v<T,MatrixType>);
-              return x_.m + (x_.da*(flatten_x-flatten_x.mid()))
-                .reshaped(x_.m.rows(), x_.m.cols());
-            }
-          }
+        if(m == EvalMode::NATURAL)
+          return eval_<true>(x...).a;
 
-          case EvalMode::DEFAULT:
-          default:
-          {
-            auto x_ = eval_<false>(x...);
-
-            // If the centered form is not available for this expression...
-            if(x_.da.size() == 0 // .. because some parts have not yet been implemented,
-              || !x_.def_domain) // .. or due to restrictions in the derivative definition domain
-              return x_.a; // natural evaluation
-
-            else
-            {
-              auto flatten_x = IntervalVector(cart_prod(x...));
-
-              if constexpr(std::is_same_v<T,ScalarType>)
-                return x_.a & (x_.m + (x_.da*(flatten_x-flatten_x.mid()))[0]);
-
-              else if constexpr(std::is_same_v<T,VectorType>)
-              {
-                assert(x_.da.rows() == x_.a.size() && x_.da.cols() == flatten_x.size());
-                return x_.a & (x_.m + (x_.da*(flatten_x-flatten_x.mid())).col(0));
-              }
-
-              else
-              {
-                static_assert(std::is_same_v<T,MatrixType>);
-                assert(x_.da.rows() == x_.a.size() && x_.da.cols() == flatten_x.size());
-                return x_.a & (x_.m +(x_.da*(flatten_x-flatten_x.mid()))
-                  .reshaped(x_.m.rows(),x_.m.cols()));
-              }
-            }
-          }
-        }
+        else
+          return centered_eval(m, eval_<false>(x...), x...);
       }
 
       template<typename... Args>
@@ -173,6 +124,42 @@ namespace codac2
         return eval(EvalMode::NATURAL | EvalMode::CENTERED, x...);
       }
 
+      /**
+       * \brief Evaluates the function for a batch of inputs, restricted to functions
+       * of one argument. The evaluation plan of the function is run once for all the
+       * inputs, each node of the expression being evaluated on the whole batch
+       * before the next one.
+       *
+       * \param m evaluation mode
+       * \param x inputs of the batch
+       * \return evaluations of the function, one for each input
+       */
+      template<typename D>
+      std::vector<typename T::Domain> eval_batch(const EvalMode& m, const std::vector<D>& x) const
+      {
+        assert_release(this->args().size() == 1 &&
+          "Batch evaluations are restricted to functions of one argument");
+
+        bool natural_eval = (m == EvalMode::NATURAL);
+        auto v = tape().batch_values();
+        fill_batch_from_args(*v, x, natural_eval);
+        tape().fwd_eval_batch(*v, x.size(), this->input_size(), natural_eval);
+        const auto& y = AnalyticExpr<T>::batch_value(*v, tape().root_slot());
+
+        std::vector<typename T::Domain> r;
+        r.reserve(x.size());
+
+        for(size_t k = 0 ; k < x.size() ; k++)
+          r.push_back(natural_eval ? y.a(k) : centered_eval(m, y.get(k), x[k]));
+        return r;
+      }
+
+      template<typename D>
+      std::vector<typename T::Domain> eval_batch(const std::vector<D>& x) const
+      {
+        return eval_batch(EvalMode::NATURAL | EvalMode::CENTERED, x);
+      }
+
       template<typename... Args>
       auto traj_eval(const SampledTraj<Args>&... x) const
       {
@@ -191,8 +178,32 @@ namespace codac2
           tdomain, (typename T::Domain)(this->output_size())
         );
 
-        for(auto it = tdomain->begin() ; it != tdomain->end() ; it++)
-          y.slice(it)->codomain() = this->eval(x.slice(it)->codomain()...);
+        // Simultaneous sweep over the slices of the tubes (sharing the same tdomain)
+        auto sx = std::make_tuple(x.first_slice().get()...);
+        for(auto sy = y.first_slice().get() ; sy ; sy = sy->next_slice_ptr())
+          std::apply([this,sy](auto&... si) {
+            sy->set(this->eval(si->codomain()...), false);
+            ((si = si->next_slice_ptr()), ...);
+          }, sx);
+
+        return y;
+      }
+
+      // Parallel version: the slices are evaluated by nb_threads threads
+      // (0 for the number of hardware threads), with the same result as tube_eval()
+      template<typename... Args>
+      auto parallel_tube_eval(std::size_t nb_threads, const SlicedTube<Args>&... x) const
+      {
+        auto tdomain = std::get<0>(std::tie(x...)).tdomain();
+
+        SlicedTube<typename T::Domain> y(
+          tdomain, (typename T::Domain)(this->output_size())
+        );
+
+        parallel_slices_process([this](auto* sy, auto*... si) {
+            sy->set(this->eval(si->codomain()...), false);
+          },
+          nb_threads, y.first_slice().get(), x.first_slice().get()...);
 
         return y;
       }
@@ -270,8 +281,117 @@ namespace codac2
         (intersect_value_from_arg_map(v, x, i++), ...);
       }
 
+      const AnalyticTape& tape() const
+      {
+        assert(_tape);
+        return *_tape;
+      }
+
+      template<typename... Args>
+      void fill_from_args(ValuesSlots& v, const Args&... x) const
+      {
+        Index i = 0;
+        (add_value_to_arg_slot(v, x, i++), ...);
+      }
+
+      template<typename... Args>
+      void intersect_from_args(ValuesSlots& v, Args&... x) const
+      {
+        Index i = 0;
+        (intersect_value_from_arg_slot(v, x, i++), ...);
+      }
+
+      template<typename D>
+      void fill_batch_from_args(ValuesSlots& v, const std::vector<D>& x, bool natural_eval) const
+      {
+        // The slot of the argument is the first slot of the tape
+        assert(this->args().size() == 1);
+        for([[maybe_unused]] const auto& xk : x)
+          assert_release(size_of(xk) == this->args()[0]->size() && "provided arguments do not match function inputs");
+
+        using D_TYPE = typename ExprType<D>::Type;
+        using D_DOMAIN = typename D_TYPE::Domain;
+
+        auto& y = AnalyticExpr<D_TYPE>::init_batch_value(v, 0);
+
+        // The derivatives of the inputs are the identity, only required
+        // by centered evaluations
+        IntervalMatrix d;
+        if(!natural_eval)
+        {
+          d = IntervalMatrix::zero(this->args()[0]->size(), this->args().total_size());
+          for(Index k = 0 ; k < d.rows() ; k++)
+            d(k,k) = 1.;
+        }
+
+        if(x.empty())
+          y.resize(0, 0, 0, 0);
+
+        for(size_t k = 0 ; k < x.size() ; k++)
+        {
+          D_TYPE xk = natural_eval ? D_TYPE(D_DOMAIN(x[k]), true)
+            : D_TYPE(D_DOMAIN(x[k]).mid(), x[k], d, true);
+          if(k == 0)
+            y.resize(x.size(), xk);
+          y.set(k, xk);
+        }
+      }
+
     protected:
 
+      template<typename... Args>
+      typename T::Domain centered_eval(const EvalMode& m, const T& x_, const Args&... x) const
+      {
+        if(m == EvalMode::CENTERED)
+        {
+          auto flatten_x = IntervalVector(cart_prod(x...));
+          assert(x_.da.rows() == x_.a.size() && x_.da.cols() == flatten_x.size());
+
+          if constexpr(std::is_same_v<T,ScalarType>)
+            return x_.m + MulOp::fwd(x_.da,IntervalVector(flatten_x-flatten_x.mid()))[0];
+
+          else if constexpr(std::is_same_v<T,VectorType>)
+            return x_.m + MulOp::fwd(x_.da,IntervalVector(flatten_x-flatten_x.mid())).col(0);
+
+          else
+          {
+            static_assert(std::is_same_v<T,MatrixType>);
+            return x_.m + MulOp::fwd(x_.da,IntervalVector(flatten_x-flatten_x.mid()))
+              .reshaped(x_.m.rows(), x_.m.cols());
+          }
+        }
+
+        else // EvalMode::DEFAULT
+        {
+          // If the centered form is not available for this expression...
+          if(x_.da.size() == 0 // .. because some parts have not yet been implemented,
+            || !x_.def_domain) // .. or due to restrictions in the derivative definition domain
+            return x_.a; // natural evaluation
+
+          else
+          {
+            auto flatten_x = IntervalVector(cart_prod(x...));
+
+            if constexpr(std::is_same_v<T,ScalarType>)
+              return x_.a & (x_.m + MulOp::fwd(x_.da,IntervalVector(flatten_x-flatten_x.mid()))[0]);
+
+            else if constexpr(std::is_same_v<T,VectorType>)
+            {
+              assert(x_.da.rows() == x_.a.size() && x_.da.cols() == flatten_x.size());
+              return x_.a & (x_.m + MulOp::fwd(x_.da,IntervalVector(flatten_x-flatten_x.mid())).col(0));
+            }
+
+            else
+            {
+              static_assert(std::is_same_v<T,MatrixType>);
+              assert(x_.da.rows() == x_.a.size() && x_.da.cols() == flatten_x.size());
+              return x_.a & (x_.m + MulOp::fwd(x_.da,IntervalVector(flatten_x-flatten_x.mid()))
+                .reshaped(x_.m.rows(),x_.m.cols()));
+            }
+          }
+        }
+      }
+
       template<typename D>
       void add_value_to_arg_map(ValuesMap& v, const D& x, Index i) const
       {
@@ -300,21 +420,56 @@ namespace codac2
         x &= std::dynamic_pointer_cast<typename ExprType<D>::Type>(v.at(this->args()[i]->unique_id()))->a;
       }
 
-      template<bool NATURAL_EVAL,typename... Args>
-      auto eval_(const Args&... x) const
+      template<typename D>
+      void add_value_to_arg_slot(ValuesSlots& v, const D& x, Index i) const
       {
-        ValuesMap v;
+        // The slots of the arguments are the first slots of the tape
+        assert(i >= 0 && i < (Index)this->args().size());
+        assert_release(size_of(x) == this->args()[i]->size() && "provided arguments do not match function inputs");
+
+        using D_TYPE = typename ExprType<D>::Type;
+
+        if(!v[i])
+        {
+          IntervalMatrix d = IntervalMatrix::zero(size_of(x), this->args().total_size());
 
-        if constexpr(sizeof...(Args) == 0)
-          return this->expr()->fwd_eval(v, 0, NATURAL_EVAL);
+          Index p = 0;
+          for(Index j = 0 ; j < i ; j++)
+            p += this->args()[j]->size();
+
+          for(Index k = p ; k < p+size_of(x) ; k++)
+            d(k-p,k) = 1.;
+
+          v[i] = std::make_unique<D_TYPE>(typename D_TYPE::Domain(x).mid(), x, d, true);
+        }
 
         else
         {
-          fill_from_args(v, x...);
-          return this->expr()->fwd_eval(v, this->input_size(), NATURAL_EVAL);
+          // The derivative of the argument is not modified by the evaluations,
+          // only its value has to be updated
+          using D_DOMAIN = typename D_TYPE::Domain;
+          auto& xi = AnalyticExpr<D_TYPE>::value(v, i);
+          xi.m = D_DOMAIN(D_DOMAIN(x).mid());
+          xi.a = D_DOMAIN(x);
+          xi.def_domain = true;
         }
       }
 
+      template<typename D>
+      void intersect_value_from_arg_slot(ValuesSlots& v, D& x, Index i) const
+      {
+        x &= AnalyticExpr<typename ExprType<D>::Type>::value(v, i).a;
+      }
+
+      template<bool NATURAL_EVAL,typename... Args>
+      auto eval_(const Args&... x) const
+      {
+        auto v = tape().values();
+        fill_from_args(*v, x...);
+        tape().fwd_eval(*v, sizeof...(Args) == 0 ? 0 : this->input_size(), NATURAL_EVAL);
+        return AnalyticExpr<T>::value(*v, tape().root_slot());
+      }
+
       template<typename... Args>
       void check_valid_inputs(const Args&... x) const
       {
@@ -331,6 +486,15 @@ namespace codac2
           // so we propagate them to the expression
           this->_y->replace_arg(v->unique_id(), std::dynamic_pointer_cast<ExprBase>(v));
       }
+
+      inline void compile()
+      {
+        // The expression is linearised once into an evaluation plan,
+        // reused by all the evaluations of this function
+        _tape = std::make_shared<AnalyticTape>(this->args(), *this->expr());
+      }
+
+      std::shared_ptr<const AnalyticTape> _tape;
   };
 
   AnalyticFunction(const FunctionArgsList&, std::initializer_list<ScalarExpr>) -> 
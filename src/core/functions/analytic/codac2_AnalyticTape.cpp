@@ -0,0 +1,187 @@
+/**
+ *  codac2_AnalyticTape.cpp
+ * ----------------------------------------------------------------------------
+ *  \date       2025
+ *  \author     Simon Rohou
+ *  \copyright  Copyright 2025 Codac Team
+ *  \license    GNU Lesser General Public License (LGPL)
+ */
+
+#include <algorithm>
+#include "codac2_AnalyticTape.h"
+#include "codac2_AnalyticExpr.h"
+
+using namespace std;
+using namespace codac2;
+
+void AnalyticTape::ValuesRecycler::operator()(ValuesSlots* v) const
+{
+  lock_guard<mutex> lock(t->_pool_mutex);
+  (batch ? t->_batch_pool : t->_pool).push_back(unique_ptr<ValuesSlots>(v));
+}
+
+AnalyticTape::AnalyticTape(const FunctionArgsList& args, const AnalyticExprBase& y)
+{
+  for(const auto& xi : args)
+    _ids[xi->unique_id()] = _nb_slots++;
+
+  y.compile(*this);
+  assert(_stack.size() == 1);
+  _root_slot = _stack.back();
+
+  // Backward order: reversed post-order of a depth-first search from the root,
+  // the operands being visited from the last one. This is a topological order
+  // of the graph of the sub-expressions (each step is processed after the steps
+  // using its value), which corresponds to the pre-order of the tree when no
+  // sub-expression is shared.
+
+  std::vector<Index> slot_step(_nb_slots, -1); // the slots of the variables have no step
+  for(size_t i = 0 ; i < _steps.size() ; i++)
+    slot_step[_steps_slots[_steps[i].first]] = i;
+
+  std::vector<bool> visited(_steps.size(), false);
+  std::vector<std::pair<Index,Index>> dfs; // step, number of operands already visited
+
+  if(slot_step[_root_slot] >= 0)
+  {
+    dfs.push_back({ slot_step[_root_slot], 0 });
+    visited[slot_step[_root_slot]] = true;
+  }
+
+  while(!dfs.empty())
+  {
+    auto& [i,k] = dfs.back();
+    const Step& si = _steps[i];
+
+    if(k < si.n)
+    {
+      Index j = slot_step[_steps_slots[si.first+si.n-k]];
+      k++;
+
+      if(j >= 0 && !visited[j])
+      {
+        visited[j] = true;
+        dfs.push_back({ j, 0 });
+      }
+    }
+
+    else
+    {
+      _bwd.push_back(i);
+      dfs.pop_back();
+    }
+  }
+
+  std::reverse(_bwd.begin(), _bwd.end());
+
+  _stack.clear();
+  _ids.clear();
+  _ops.clear();
+}
+
+Index AnalyticTape::nb_slots() const
+{
+  return _nb_slots;
+}
+
+Index AnalyticTape::nb_steps() const
+{
+  return _steps.size();
+}
+
+Index AnalyticTape::root_slot() const
+{
+  return _root_slot;
+}
+
+AnalyticTape::ValuesPtr AnalyticTape::values() const
+{
+  {
+    lock_guard<mutex> lock(_pool_mutex);
+    if(!_pool.empty())
+    {
+      ValuesPtr v(_pool.back().release(), { this, false });
+      _pool.pop_back();
+      return v;
+    }
+  }
+
+  return ValuesPtr(new ValuesSlots(_nb_slots), { this, false });
+}
+
+AnalyticTape::ValuesPtr AnalyticTape::batch_values() const
+{
+  {
+    lock_guard<mutex> lock(_pool_mutex);
+    if(!_batch_pool.empty())
+    {
+      ValuesPtr v(_batch_pool.back().release(), { this, true });
+      _batch_pool.pop_back();
+      return v;
+    }
+  }
+
+  return ValuesPtr(new ValuesSlots(_nb_slots), { this, true });
+}
+
+void AnalyticTape::fwd_eval(ValuesSlots& v, Index total_input_size, bool natural_eval) const
+{
+  assert((Index)v.size() == _nb_slots);
+  for(const auto& si : _steps)
+    si.e->fwd_eval_step(v, _steps_slots.data()+si.first, total_input_size, natural_eval);
+}
+
+void AnalyticTape::bwd_eval(ValuesSlots& v) const
+{
+  assert((Index)v.size() == _nb_slots);
+  for(const auto& i : _bwd)
+    _steps[i].e->bwd_eval_step(v, _steps_slots.data()+_steps[i].first);
+}
+
+void AnalyticTape::fwd_eval_batch(ValuesSlots& v, Index n, Index total_input_size, bool natural_eval) const
+{
+  assert((Index)v.size() == _nb_slots);
+  for(const auto& si : _steps)
+    si.e->fwd_eval_batch_step(v, _steps_slots.data()+si.first, n, total_input_size, natural_eval);
+}
+
+void AnalyticTape::bwd_eval_batch(ValuesSlots& v) const
+{
+  assert((Index)v.size() == _nb_slots);
+  for(const auto& i : _bwd)
+    _steps[i].e->bwd_eval_batch_step(v, _steps_slots.data()+_steps[i].first);
+}
+
+void AnalyticTape::add_step(const AnalyticExprBase& e, Index n)
+{
+  assert((Index)_stack.size() >= n);
+  std::vector<Index> x_slots(_stack.end()-n, _stack.end());
+  _stack.erase(_stack.end()-n, _stack.end());
+
+  // Nodes sharing the same identifier share the same value
+  auto it = _ids.find(e.unique_id());
+  if(it != _ids.end())
+  {
+    _stack.push_back(it->second);
+    return;
+  }
+
+  // Nodes computing the same operation on the same operands also share the same value
+  auto& same_ops = _ops[{ std::type_index(typeid(e)), x_slots }];
+  for(const auto& j : same_ops)
+    if(e.is_same_operation(*_steps[j].e))
+    {
+      Index slot = _steps_slots[_steps[j].first];
+      _ids[e.unique_id()] = slot;
+      _stack.push_back(slot);
+      return;
+    }
+
+  Index slot = _nb_slots++;
+  _ids[e.unique_id()] = slot;
+  same_ops.push_back(_steps.size());
+  _steps.push_back({ &e, (Index)_steps_slots.size(), n });
+  _steps_slots.push_back(slot);
+  _steps_slots.insert(_steps_slots.end(), x_slots.begin(), x_slots.end());
+  _stack.push_back(slot);
+}
@@ -0,0 +1,202 @@
+/**
+ *  \file codac2_AnalyticTape.h
+ * ----------------------------------------------------------------------------
+ *  \date       2025
+ *  \author     Simon Rohou
+ *  \copyright  Copyright 2025 Codac Team
+ *  \license    GNU Lesser General Public License (LGPL)
+ */
+
+#pragma once
+
+#include <map>
+#include <mutex>
+#include <memory>
+#include <vector>
+#include <typeindex>
+#include "codac2_ExprBase.h"
+#include "codac2_FunctionArgsList.h"
+#include "codac2_AnalyticType.h"
+
+namespace codac2
+{
+  class AnalyticExprBase;
+
+  /**
+   * \brief Values of the nodes of a compiled expression, indexed by their slot
+   * in an ``AnalyticTape``. Each slot is allocated at its first use, and then
+   * reused by the next evaluations.
+   *
+   * For batch evaluations, each slot contains the values of its node for all the
+   * inputs of the batch, stored as contiguous arrays of bounds (see ``AnalyticTypeBatch``).
+   */
+  using ValuesSlots = std::vector<std::unique_ptr<AnalyticTypeBase>>;
+
+  /**
+   * \class AnalyticTape
+   * \brief Flat evaluation plan of an analytic expression.
+   *
+   * The expression tree is linearised once into a sequence of steps, each step
+   * referring to a node of the tree and to the slots of its value and of the values
+   * of its operands. Common sub-expressions are shared during this compilation:
+   * nodes with the same identifier, or computing the same operation on the same
+   * operands (for instance, ``cos(x[2])`` written twice in an expression), are
+   * given the same slot and a single step. The tape is then a directed acyclic
+   * graph of distinct sub-expressions.
+   *
+   * A forward evaluation is a loop over the steps in topological order, each
+   * distinct sub-expression being evaluated once. A backward evaluation is a loop
+   * over the steps from the root to the leaves, each step being processed after
+   * all the steps using its value: the contractions coming from the different
+   * occurrences of a sub-expression are thus intersected before being propagated
+   * to its operands. When no sub-expression is shared, the results are the same as
+   * the ones of the recursive ``fwd_eval``/``bwd_eval`` methods based on a ``ValuesMap``
+   * (the backward order is then the pre-order of the tree).
+   *
+   * The first slots are those of the arguments of the function, in the order of
+   * the ``FunctionArgsList``.
+   *
+   * A batch evaluation runs each step over all the inputs of the batch before the
+   * next step, the values of each node being stored contiguously (structure of
+   * arrays): the evaluation of the expression becomes a sequence of tight loops.
+   *
+   * The tape is immutable once built and can be evaluated concurrently, provided
+   * that each thread uses its own values (see ``values()`` and ``batch_values()``).
+   */
+  class AnalyticTape
+  {
+    public:
+
+      /**
+       * \brief Recycles the values of an evaluation into the pool of the tape
+       */
+      struct ValuesRecycler
+      {
+        const AnalyticTape* t;
+        bool batch;
+        void operator()(ValuesSlots* v) const;
+      };
+
+      using ValuesPtr = std::unique_ptr<ValuesSlots,ValuesRecycler>;
+
+      /**
+       * \brief Compiles the expression ``y`` of a function of arguments ``args``
+       *
+       * \param args arguments of the function
+       * \param y expression to be compiled
+       */
+      AnalyticTape(const FunctionArgsList& args, const AnalyticExprBase& y);
+
+      AnalyticTape(const AnalyticTape&) = delete;
+      AnalyticTape& operator=(const AnalyticTape&) = delete;
+
+      /**
+       * \brief Returns the number of slots of the tape
+       *
+       * \return number of slots
+       */
+      Index nb_slots() const;
+
+      /**
+       * \brief Returns the number of steps of the tape, that is the number
+       * of distinct sub-expressions (variables excepted)
+       *
+       * \return number of steps
+       */
+      Index nb_steps() const;
+
+      /**
+       * \brief Returns the slot of the value of the root of the expression
+       *
+       * \return slot index
+       */
+      Index root_slot() const;
+
+      /**
+       * \brief Provides values for an evaluation of the tape, taken from a pool
+       * of previously used values when available. The values are given back to
+       * the pool when the returned pointer is destroyed.
+       *
+       * \return values of the slots of the tape
+       */
+      ValuesPtr values() const;
+
+      /**
+       * \brief Provides values for a batch evaluation of the tape, taken from a pool
+       * of previously used values when available. The values are given back to
+       * the pool when the returned pointer is destroyed.
+       *
+       * \return values of the slots of the tape, for batch evaluations
+       */
+      ValuesPtr batch_values() const;
+
+      /**
+       * \brief Forward evaluation of the expression, the values of the arguments
+       * being already set in their slots
+       *
+       * \param v values of the slots
+       * \param total_input_size total size of the arguments
+       * \param natural_eval ``true`` for a natural evaluation only, ``false``
+       *        for also computing the centered form data
+       */
+      void fwd_eval(ValuesSlots& v, Index total_input_size, bool natural_eval) const;
+
+      /**
+       * \brief Backward evaluation of the expression, from the root to the leaves
+       *
+       * \param v values of the slots, obtained by a previous forward evaluation
+       */
+      void bwd_eval(ValuesSlots& v) const;
+
+      /**
+       * \brief Forward evaluation of the expression for a batch of ``n`` inputs,
+       * the values of the arguments being already set in their slots
+       *
+       * \param v batch values of the slots
+       * \param n number of inputs
+       * \param total_input_size total size of the arguments
+       * \param natural_eval ``true`` for a natural evaluation only, ``false``
+       *        for also computing the centered form data
+       */
+      void fwd_eval_batch(ValuesSlots& v, Index n, Index total_input_size, bool natural_eval) const;
+
+      /**
+       * \brief Backward evaluation of the expression for a batch of inputs
+       *
+       * \param v batch values of the slots, obtained by a previous forward evaluation
+       */
+      void bwd_eval_batch(ValuesSlots& v) const;
+
+      /**
+       * \brief Adds a step for the node ``e``, whose ``n`` operands have just been
+       * compiled. Called by the ``compile()`` methods of the expressions.
+       *
+       * \param e node of the expression
+       * \param n number of operands of the node
+       */
+      void add_step(const AnalyticExprBase& e, Index n);
+
+    protected:
+
+      struct Step
+      {
+        const AnalyticExprBase* e; //!< node of the expression
+        Index first; //!< position of its slot in _steps_slots, followed by the slots of its operands
+        Index n; //!< number of operands
+      };
+
+      std::vector<Step> _steps; //!< one step per distinct sub-expression, in forward order
+      std::vector<Index> _steps_slots;
+      std::vector<Index> _bwd; //!< backward order
+      Index _nb_slots = 0;
+      Index _root_slot = 0;
+
+      // Compilation data
+      std::map<ExprID,Index> _ids;
+      std::map<std::pair<std::type_index,std::vector<Index>>,std::vector<Index>> _ops; //!< steps by operation type and operands
+      std::vector<Index> _stack; //!< slots of the compiled sub-expressions
+
+      mutable std::mutex _pool_mutex;
+      mutable std::vector<std::unique_ptr<ValuesSlots>> _pool, _batch_pool;
+  };
+}
@@ -9,6 +9,9 @@
 
 #pragma once
 
+#include <vector>
+#include <algorithm>
+#include <type_traits>
 #include "codac2_Interval.h"
 #include "codac2_Vector.h"
 #include "codac2_Matrix.h"
@@ -53,6 +56,179 @@ namespace codac2
     }
   };
 
+  /**
+   * \struct AnalyticTypeBatch
+   * \brief Values of an analytic type for a batch of inputs, stored as a structure of arrays
+   *
+   * Each component of the values (and of their midpoints and derivatives, for centered
+   * evaluations) is stored as two contiguous arrays of lower and upper bounds over the
+   * inputs of the batch. Element-wise operations can then be computed on the whole batch
+   * with the bulk operations of ``IntervalKernels``. Other operations gather the values
+   * of each input into an ``AnalyticType`` (see ``get()`` and ``set()``).
+   *
+   * The empty set is stored as \f$[\infty,-\infty]\f$.
+   */
+  template<typename T>
+  struct AnalyticTypeBatch : public AnalyticTypeBase
+  {
+    using Domain = typename T::Domain;
+
+    Index n = 0; //!< number of inputs
+    Index rows = 0, cols = 0; //!< shape of the values
+    Index da_cols = 0; //!< number of columns of the derivatives, 0 if they are not computed
+
+    // The component i of the input k is stored at i*n+k. The components of the
+    // matrices are taken in column-major order, the derivatives being matrices
+    // of size() rows and da_cols columns.
+    std::vector<double> a_lb, a_ub; //!< bounds of the values
+    std::vector<double> m_lb, m_ub; //!< bounds of the midpoints, for centered evaluations
+    std::vector<double> da_lb, da_ub; //!< bounds of the derivatives, for centered evaluations
+    std::vector<char> has_da; //!< true for the inputs whose derivatives are available
+    std::vector<char> def_domain;
+
+    Index size() const
+    {
+      return rows*cols;
+    }
+
+    void resize(Index n_, Index rows_, Index cols_, Index da_cols_)
+    {
+      n = n_; rows = rows_; cols = cols_; da_cols = da_cols_;
+      a_lb.resize(size()*n); a_ub.resize(size()*n);
+      m_lb.resize(da_cols ? size()*n : 0); m_ub.resize(m_lb.size());
+      da_lb.resize(size()*da_cols*n); da_ub.resize(da_lb.size());
+      has_da.assign(n, da_cols != 0);
+      def_domain.resize(n);
+    }
+
+    void resize(Index n_, const T& x)
+    {
+      if constexpr(std::is_same_v<Domain,Interval>)
+        resize(n_, 1, 1, x.da.cols());
+      else
+        resize(n_, x.a.rows(), x.a.cols(), x.da.cols());
+    }
+
+    /**
+     * \brief Sets the same value for all the inputs of the batch
+     */
+    void assign(Index n_, const T& x)
+    {
+      resize(n_, x);
+      for(Index k = 0 ; k < n ; k++)
+        set(k, x);
+    }
+
+    /**
+     * \brief Sets the values of a natural evaluation from the consecutive components of
+     * the values of ``x``, starting from the component ``i``
+     */
+    template<typename B>
+    void set_components(const B& x, Index i, Index rows_, Index cols_)
+    {
+      resize(x.n, rows_, cols_, 0);
+      std::copy(x.a_lb.begin()+i*n, x.a_lb.begin()+(i+size())*n, a_lb.begin());
+      std::copy(x.a_ub.begin()+i*n, x.a_ub.begin()+(i+size())*n, a_ub.begin());
+      def_domain = x.def_domain;
+    }
+
+    Domain a(Index k) const
+    {
+      return gather(a_lb, a_ub, k, rows, cols);
+    }
+
+    void set_a(Index k, const Domain& x)
+    {
+      scatter(x, a_lb, a_ub, k);
+    }
+
+    T get(Index k) const
+    {
+      if(!has_da[k])
+        return T(a(k), def_domain[k]);
+      return T(gather(m_lb, m_ub, k, rows, cols), a(k), gather_matrix(da_lb, da_ub, k, size(), da_cols), def_domain[k]);
+    }
+
+    void set(Index k, const T& x)
+    {
+      set_a(k, x.a);
+      def_domain[k] = x.def_domain;
+      has_da[k] = x.da.size() != 0;
+
+      if(has_da[k])
+      {
+        if(da_cols == 0) // first derivatives of the batch
+        {
+          da_cols = x.da.cols();
+          m_lb.resize(size()*n); m_ub.resize(size()*n);
+          da_lb.resize(size()*da_cols*n); da_ub.resize(da_lb.size());
+        }
+
+        assert(x.da.rows() == size() && x.da.cols() == da_cols);
+        scatter(x.m, m_lb, m_ub, k);
+        scatter(x.da, da_lb, da_ub, k);
+      }
+    }
+
+    protected:
+
+      Domain gather(const std::vector<double>& lb, const std::vector<double>& ub, Index k, Index r, Index c) const
+      {
+        Domain x = make_domain(r, c);
+        Interval* xi = components(x);
+        for(Index i = 0 ; i < r*c ; i++)
+          xi[i] = Interval(lb[i*n+k], ub[i*n+k]); // [oo,-oo] is the empty set
+        return x;
+      }
+
+      IntervalMatrix gather_matrix(const std::vector<double>& lb, const std::vector<double>& ub, Index k, Index r, Index c) const
+      {
+        IntervalMatrix x(r,c);
+        for(Index i = 0 ; i < r*c ; i++)
+          x.data()[i] = Interval(lb[i*n+k], ub[i*n+k]);
+        return x;
+      }
+
+      template<typename D>
+      void scatter(const D& x, std::vector<double>& lb, std::vector<double>& ub, Index k) const
+      {
+        const Interval* xi = components(x);
+        for(Index i = 0 ; i < size_of_domain(x) ; i++)
+        {
+          lb[i*n+k] = xi[i].is_empty() ? oo : xi[i].lb();
+          ub[i*n+k] = xi[i].is_empty() ? -oo : xi[i].ub();
+        }
+      }
+
+      static Domain make_domain(Index r, Index c)
+      {
+        if constexpr(std::is_same_v<Domain,Interval>)
+          return Interval();
+        else if constexpr(std::is_same_v<Domain,IntervalVector>)
+          return IntervalVector(r);
+        else
+          return Domain(r,c);
+      }
+
+      template<typename D>
+      static auto components(D& x)
+      {
+        if constexpr(std::is_same_v<std::remove_const_t<D>,Interval>)
+          return &x;
+        else
+          return x.data();
+      }
+
+      template<typename D>
+      static Index size_of_domain(const D& x)
+      {
+        if constexpr(std::is_same_v<D,Interval>)
+          return 1;
+        else
+          return x.size();
+      }
+  };
+
   using ScalarType = AnalyticType<double,Interval>;
   using VectorType = AnalyticType<Vector,IntervalVector>;
   using MatrixType = AnalyticType<Matrix,IntervalMatrix>;
@@ -60,6 +60,50 @@ namespace codac2
         AnalyticExpr<T>::value(v).a &= _x;
       }
 
+      void compile(AnalyticTape& t) const
+      {
+        t.add_step(*this, 0);
+      }
+
+      void fwd_eval_step(ValuesSlots& v, const Index* s, Index total_input_size, bool natural_eval) const
+      {
+        if(natural_eval)
+          AnalyticExpr<T>::init_value(v, s[0], T(_x, true));
+
+        else
+          AnalyticExpr<T>::init_value(v, s[0], T(_x, _x,
+            IntervalMatrix::zero(_x.size(),total_input_size), true));
+      }
+
+      void bwd_eval_step(ValuesSlots& v, const Index* s) const
+      {
+        AnalyticExpr<T>::value(v, s[0]).a &= _x;
+      }
+
+      void fwd_eval_batch_step(ValuesSlots& v, const Index* s, Index n, Index total_input_size, bool natural_eval) const
+      {
+        if(natural_eval)
+          AnalyticExpr<T>::init_batch_value(v, s[0]).assign(n, T(_x, true));
+
+        else
+          AnalyticExpr<T>::init_batch_value(v, s[0]).assign(n, T(_x, _x,
+            IntervalMatrix::zero(_x.size(),total_input_size), true));
+      }
+
+      void bwd_eval_batch_step(ValuesSlots& v, const Index* s) const
+      {
+        bwd_batch([this](auto& y) { y &= _x; }, AnalyticExpr<T>::batch_value(v, s[0]));
+      }
+
+      bool is_same_operation(const AnalyticExprBase& e) const
+      {
+        const auto& e_ = dynamic_cast<const ConstValueExpr<T>&>(e);
+        if constexpr(std::is_same_v<T,ScalarType>)
+          return e_._x == _x;
+        else
+          return e_._x.rows() == _x.rows() && e_._x.cols() == _x.cols() && e_._x == _x;
+      }
+
       std::pair<Index,Index> output_shape() const
       {
         if constexpr(std::is_same_v<T,ScalarType>)
@@ -41,6 +41,30 @@ namespace codac2
       void bwd_eval([[maybe_unused]] ValuesMap& v) const
       { }
 
+      void compile(AnalyticTape& t) const
+      {
+        t.add_step(*this, 0);
+      }
+
+      void fwd_eval_step([[maybe_unused]] ValuesSlots& v, [[maybe_unused]] const Index* s,
+        [[maybe_unused]] Index total_input_size, [[maybe_unused]] bool natural_eval) const
+      { }
+
+      void bwd_eval_step([[maybe_unused]] ValuesSlots& v, [[maybe_unused]] const Index* s) const
+      { }
+
+      void fwd_eval_batch_step([[maybe_unused]] ValuesSlots& v, [[maybe_unused]] const Index* s, [[maybe_unused]] Index n,
+        [[maybe_unused]] Index total_input_size, [[maybe_unused]] bool natural_eval) const
+      { }
+
+      void bwd_eval_batch_step([[maybe_unused]] ValuesSlots& v, [[maybe_unused]] const Index* s) const
+      { }
+
+      bool is_same_operation([[maybe_unused]] const AnalyticExprBase& e) const
+      {
+        return false; // variables are only identified by their unique id
+      }
+
       void replace_arg([[maybe_unused]] const ExprID& old_arg_id, [[maybe_unused]] const std::shared_ptr<ExprBase>& new_expr)
       { }
 
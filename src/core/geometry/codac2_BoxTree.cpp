@@ -0,0 +1,124 @@
+/** 
+ *  codac2_BoxTree.cpp
+ * ----------------------------------------------------------------------------
+ *  \date       2025
+ *  \author     Simon Rohou
+ *  \copyright  Copyright 2025 Codac Team
+ *  \license    GNU Lesser General Public License (LGPL)
+ */
+
+#include <algorithm>
+#include "codac2_BoxTree.h"
+
+using namespace std;
+
+namespace codac2
+{
+  BoxTree::BoxTree(const vector<IntervalVector>& boxes, size_t leaf_size)
+    : _hull(IntervalVector::empty(boxes.empty() ? 0 : boxes[0].size()))
+  {
+    assert_release(leaf_size > 0);
+    assert_release([&]() {
+      for(const auto& bi : boxes)
+        if(bi.size() != _hull.size())
+          return false;
+      return true;
+    }() && "all the boxes should be of same dimension");
+
+    vector<Vector> centers(boxes.size());
+    for(size_t i = 0 ; i < boxes.size() ; i++)
+      if(!boxes[i].is_empty())
+      {
+        centers[i] = boxes[i].mid();
+        _ids.push_back(i);
+      }
+
+    if(_ids.empty())
+      return;
+
+    _nodes.reserve(2*(_ids.size()/leaf_size+1));
+    _nodes.push_back({ IntervalVector(), 0, _ids.size(), 0 });
+    build(0, boxes, centers, leaf_size);
+    _hull = _nodes[0].hull;
+
+    _boxes.reserve(_ids.size());
+    for(size_t i : _ids)
+      _boxes.push_back(boxes[i]);
+  }
+
+  size_t BoxTree::size() const
+  {
+    return _ids.size();
+  }
+
+  const IntervalVector& BoxTree::hull() const
+  {
+    return _hull;
+  }
+
+  IntervalVector BoxTree::hull_of_intersections(const IntervalVector& x) const
+  {
+    assert_release(x.size() == _hull.size());
+    auto u = IntervalVector::empty(x.size());
+    if(_nodes.empty())
+      return u;
+
+    vector<size_t> stack { 0 };
+    while(!stack.empty())
+    {
+      const Node& n = _nodes[stack.back()];
+      stack.pop_back();
+
+      if(!x.intersects(n.hull) || n.hull.is_subset(u))
+        continue; // no contribution of the boxes of the node
+
+      if(n.hull.is_subset(x))
+        u |= n.hull; // the boxes of the node are enclosed in x
+
+      else if(n.left == 0) // leaf
+      {
+        for(size_t k = n.begin ; k < n.end ; k++)
+          u |= x & _boxes[k];
+      }
+
+      else
+      {
+        stack.push_back(n.left);
+        stack.push_back(n.left+1);
+      }
+    }
+
+    return u;
+  }
+
+  void BoxTree::build(size_t i, const vector<IntervalVector>& boxes,
+    const vector<Vector>& centers, size_t leaf_size)
+  {
+    size_t begin = _nodes[i].begin, end = _nodes[i].end;
+
+    IntervalVector h = IntervalVector::empty(_hull.size());
+    auto c = IntervalVector::empty(_hull.size()); // hull of the centers
+    for(size_t k = begin ; k < end ; k++)
+    {
+      h |= boxes[_ids[k]];
+      c |= centers[_ids[k]];
+    }
+
+    _nodes[i].hull = h;
+    if(end-begin <= leaf_size)
+      return;
+
+    // Split at the median of the centers, along their largest extent
+    Index axis = c.max_diam_index();
+    size_t mid = begin + (end-begin)/2;
+    nth_element(_ids.begin()+begin, _ids.begin()+mid, _ids.begin()+end,
+      [&centers,axis](size_t a, size_t b) { return centers[a][axis] < centers[b][axis]; });
+
+    size_t left = _nodes.size();
+    _nodes[i].left = left; // the references to the nodes are invalidated below
+    _nodes.push_back({ IntervalVector(), begin, mid, 0 });
+    _nodes.push_back({ IntervalVector(), mid, end, 0 });
+    build(left, boxes, centers, leaf_size);
+    build(left+1, boxes, centers, leaf_size);
+  }
+}
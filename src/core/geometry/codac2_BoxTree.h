@@ -0,0 +1,116 @@
+/**
+ *  \file codac2_BoxTree.h
+ * ----------------------------------------------------------------------------
+ *  \date       2025
+ *  \author     Simon Rohou
+ *  \copyright  Copyright 2025 Codac Team
+ *  \license    GNU Lesser General Public License (LGPL)
+ */
+
+#pragma once
+
+#include <vector>
+#include "codac2_IntervalVector.h"
+
+namespace codac2
+{
+  /**
+   * \class BoxTree
+   * \brief Bounding volume hierarchy over a static set of boxes.
+   *
+   * The boxes are recursively split into two halves along the axis on which their
+   * centers are the most spread, each node of the tree enclosing the hull of its
+   * boxes. The boxes intersecting a query box \f$[\mathbf{x}]\f$ are then obtained
+   * without visiting the nodes disjoint from \f$[\mathbf{x}]\f$.
+   *
+   * Empty boxes are not stored: they intersect no query box.
+   */
+  class BoxTree
+  {
+    public:
+
+      /**
+       * \brief Builds the tree over a set of boxes of same dimension.
+       *
+       * \param boxes set of boxes
+       * \param leaf_size maximal number of boxes in a leaf of the tree
+       */
+      explicit BoxTree(const std::vector<IntervalVector>& boxes, size_t leaf_size = 8);
+
+      /**
+       * \brief Returns the number of boxes stored in the tree.
+       *
+       * \return number of non-empty boxes
+       */
+      size_t size() const;
+
+      /**
+       * \brief Returns the hull of the boxes of the tree.
+       *
+       * \return hull of the boxes, empty if the tree contains no box
+       */
+      const IntervalVector& hull() const;
+
+      /**
+       * \brief Computes the hull of the intersections of \f$[\mathbf{x}]\f$ with the boxes
+       * of the tree, that is \f$\bigsqcup_i([\mathbf{x}]\cap[\mathbf{b}_i])\f$.
+       *
+       * The nodes of the tree enclosed in \f$[\mathbf{x}]\f$ are not explored further.
+       *
+       * \param x query box
+       * \return hull of the intersections
+       */
+      IntervalVector hull_of_intersections(const IntervalVector& x) const;
+
+      /**
+       * \brief Calls ``f(i)`` for each box \f$[\mathbf{b}_i]\f$ of the tree intersecting
+       * \f$[\mathbf{x}]\f$, \f$i\f$ being the rank of the box in the set given at construction.
+       *
+       * \param x query box
+       * \param f function called with the rank of each box intersecting \f$[\mathbf{x}]\f$
+       */
+      template<typename F>
+      void visit(const IntervalVector& x, const F& f) const
+      {
+        assert_release(x.size() == _hull.size());
+        if(_nodes.empty() || !x.intersects(_hull))
+          return;
+
+        std::vector<size_t> stack { 0 };
+        while(!stack.empty())
+        {
+          const Node& n = _nodes[stack.back()];
+          stack.pop_back();
+
+          if(n.left == 0) // leaf
+          {
+            for(size_t k = n.begin ; k < n.end ; k++)
+              if(x.intersects(_boxes[k]))
+                f(_ids[k]);
+          }
+
+          else
+            for(size_t c : { n.left, n.left+1 })
+              if(x.intersects(_nodes[c].hull))
+                stack.push_back(c);
+        }
+      }
+
+    protected:
+
+      struct Node
+      {
+        IntervalVector hull; // hull of the boxes of the node
+        size_t begin, end; // range of the boxes of the node
+        size_t left; // rank of the first child (the second one follows), 0 for a leaf
+      };
+
+      void build(size_t i, const std::vector<IntervalVector>& boxes,
+        const std::vector<Vector>& centers, size_t leaf_size);
+
+      std::vector<IntervalVector> _boxes; // boxes, reordered by the tree
+      std::vector<size_t> _ids; // ranks of the boxes in the set given at construction
+      std::vector<Node> _nodes; // nodes, the root being the first one
+      IntervalVector _hull;
+  };
+}
@@ -163,103 +163,145 @@ namespace codac2
     return this->vector<Segment>::empty();
   }
 
-  BoolInterval Polygon::contains(const IntervalVector& p) const
+  namespace
   {
-    assert_release(p.size() == 2);
-
-    IntervalVector box_hull = box();
-    if(!p.intersects(box_hull))
-      return BoolInterval::FALSE;
-
-    for(const auto& e : *this)
+    // Containment test of a point in a polygon, visit_edges(x,f) calling f(i) for (at least)
+    // all the edges whose bounding boxes intersect x. Visiting only these edges provides
+    // the same result, the other ones being neither containing the point nor crossed by the ray.
+    // If f(i) returns true, the remaining edges are not needed.
+    template<typename V>
+    BoolInterval polygon_contains(const Polygon& poly, const IntervalVector& box_hull,
+      const IntervalVector& p, const V& visit_edges)
     {
-      auto b = e.contains(p);
-      if(b == BoolInterval::TRUE || b == BoolInterval::UNKNOWN)
-        return b;
-    }
-
-    if(this->size() <= 2) // if the polygon has no volume
-      // Then it contains a point only if the point is on one of,
-      // its edges, which has been tested before
-      return BoolInterval::FALSE;
+      assert_release(p.size() == 2);
 
-    bool retry;
-    Segment transect(IntervalVector(2),IntervalVector(2));
-    // ^ selected transect (e.g. horizontal ray) for crossing the polygon.
-    // Odd number of crossing => point is inside
-    // Even number of crossing => point is outside
+      if(!p.intersects(box_hull))
+        return BoolInterval::FALSE;
 
-    Index i = 0;
-    // Some limit cases must be considered, for instance when the
-    // transect crosses exactly one vertex of the polygon, and/or 
-    // when the point to be tested is this very vertex. Below, we
-    // generate a convenient transect avoiding such configuration.
+      // The first edge (in the order of the polygon) possibly containing the point
+      size_t first = poly.size();
+      BoolInterval b_first;
 
-    do
-    {
-      retry = false;
-
-      // Creating a ray candidate:
-      Segment try_transect = [i,&p]() -> Segment {
-        switch(i)
+      visit_edges(p, [&](size_t i)
+      {
+        auto b = poly[i].contains(p);
+        if((b == BoolInterval::TRUE || b == BoolInterval::UNKNOWN) && i < first)
         {
-          case 0:
-            return { {next_float(-oo),p[1]}, p };
-          case 1:
-            return { {prev_float(oo),p[1]}, p };
-          case 2:
-            return { {p[0],next_float(-oo)}, p };
-          case 3:
-            return { {p[0],prev_float(oo)}, p };
-          default:
+          first = i;
+          b_first = b;
+        }
+        return first != poly.size();
+      });
+
+      if(first != poly.size())
+        return b_first;
+
+      if(poly.size() <= 2) // if the polygon has no volume
+        // Then it contains a point only if the point is on one of,
+        // its edges, which has been tested before
+        return BoolInterval::FALSE;
+
+      bool retry;
+      Segment transect(IntervalVector(2),IntervalVector(2));
+      // ^ selected transect (e.g. horizontal ray) for crossing the polygon.
+      // Odd number of crossing => point is inside
+      // Even number of crossing => point is outside
+
+      Index i = 0;
+      // Some limit cases must be considered, for instance when the
+      // transect crosses exactly one vertex of the polygon, and/or 
+      // when the point to be tested is this very vertex. Below, we
+      // generate a convenient transect avoiding such configuration.
+
+      do
+      {
+        retry = false;
+
+        // Creating a ray candidate:
+        Segment try_transect = [i,&p]() -> Segment {
+          switch(i)
           {
-            assert_release(false &&
-              "failed to test if the point is contained in polygon");
-            return Segment(IntervalVector(2),IntervalVector(2));
+            case 0:
+              return { {next_float(-oo),p[1]}, p };
+            case 1:
+              return { {prev_float(oo),p[1]}, p };
+            case 2:
+              return { {p[0],next_float(-oo)}, p };
+            case 3:
+              return { {p[0],prev_float(oo)}, p };
+            default:
+            {
+              assert_release(false &&
+                "failed to test if the point is contained in polygon");
+              return Segment(IntervalVector(2),IntervalVector(2));
+            }
           }
-        }
-      }();
+        }();
 
-      // The ray may pass through the vertices, we must double counting
-      for(const auto& pi : vertices())
-        if(try_transect.contains(pi) != BoolInterval::FALSE)
+        // The ray may pass through the vertices, we must double counting
+        // (the vertices are the first points of the edges, and the last point
+        // of the last edge if the polygon is not closed)
+        visit_edges(try_transect.box(), [&](size_t k)
         {
+          if(try_transect.contains(poly[k][0]) != BoolInterval::FALSE)
+            retry = true;
+          return retry;
+        });
+
+        const auto& last = poly.back()[1];
+        if(poly.front()[0] != last && try_transect.contains(last) != BoolInterval::FALSE)
           retry = true;
-          break;
-        }
 
-      if(!retry)
-        transect = try_transect;
+        if(!retry)
+          transect = try_transect;
 
-      i++;
-      assert(i < 10);
-    } while(retry);
+        i++;
+        assert(i < 10);
+      } while(retry);
 
-    // Now the number i of crossing can be computed.
-    i = 0;
+      // Now the number i of crossing can be computed.
+      i = 0;
+      bool unknown = false;
 
-    for(const auto& e : *this)
-    {
-      switch(transect.intersects(e))
+      visit_edges(transect.box(), [&](size_t k)
       {
-        case BoolInterval::TRUE:
-          i++;
-          break;
+        switch(transect.intersects(poly[k]))
+        {
+          case BoolInterval::TRUE:
+            i++;
+            break;
+
+          case BoolInterval::FALSE:
+            // no intersection
+            break;
 
-        case BoolInterval::FALSE:
-          // no intersection
-          break;
+          case BoolInterval::UNKNOWN:
+            unknown = true;
+            break;
 
-        case BoolInterval::UNKNOWN:
-          return BoolInterval::UNKNOWN;
+          case BoolInterval::EMPTY:
+          default:
+            assert(false && "BoolInterval::EMPTY should not happen");
+        }
+        return unknown;
+      });
 
-        case BoolInterval::EMPTY:
-        default:
-          assert(false && "BoolInterval::EMPTY should not happen");
-      }
+      if(unknown)
+        return BoolInterval::UNKNOWN;
+      
+      return (i%2 == 0) ? BoolInterval::FALSE : BoolInterval::TRUE;
     }
-    
-    return (i%2 == 0) ? BoolInterval::FALSE : BoolInterval::TRUE;
+  }
+
+  BoolInterval Polygon::contains(const IntervalVector& p) const
+  {
+    return polygon_contains(*this, box(), p,
+      [this](const IntervalVector&, const auto& f)
+      {
+        for(size_t i = 0 ; i < this->size() ; i++)
+          if(f(i))
+            break;
+      });
   }
   
   Polygon Polygon::empty()
@@ -267,6 +309,34 @@ namespace codac2
     return Polygon();
   }
 
+  IndexedPolygon::IndexedPolygon(const Polygon& p)
+    : _p(p), _edges([&p]()
+      {
+        vector<IntervalVector> boxes;
+        boxes.reserve(p.size());
+        for(const auto& e : p)
+          boxes.push_back(e.box());
+        return boxes;
+      }())
+  { }
+
+  const Polygon& IndexedPolygon::polygon() const
+  {
+    return _p;
+  }
+
+  BoolInterval IndexedPolygon::contains(const IntervalVector& p) const
+  {
+    if(_p.is_empty())
+      return _p.contains(p);
+
+    return polygon_contains(_p, _edges.hull(), p,
+      [this](const IntervalVector& x, const auto& f)
+      {
+        _edges.visit(x, f);
+      });
+  }
+
   bool Polygon::operator==(const Polygon& p) const
   {
     if(is_empty() || p.is_empty())
@@ -15,6 +15,7 @@
 #include "codac2_IntervalVector.h"
 #include "codac2_BoolInterval.h"
 #include "codac2_Segment.h"
+#include "codac2_BoxTree.h"
 
 namespace codac2
 {
@@ -135,6 +136,60 @@ namespace codac2
       Polygon();
   };
 
+  /**
+   * \class IndexedPolygon
+   * \brief Polygon whose edges are indexed in a ``BoxTree``, for polygons made of many edges.
+   *
+   * The tests and contractions involving a box only consider the edges whose bounding
+   * boxes intersect this box, with the same results as the methods of ``Polygon``.
+   */
+  class IndexedPolygon
+  {
+    public:
+
+      /**
+       * \brief Indexes the edges of a polygon.
+       *
+       * \param p The polygon.
+       */
+      explicit IndexedPolygon(const Polygon& p);
+
+      /**
+       * \brief Returns the indexed polygon.
+       *
+       * \return A constant reference to the polygon.
+       */
+      const Polygon& polygon() const;
+
+      /**
+       * \brief Checks whether the polygon contains a given point.
+       *
+       * The result is the one of ``Polygon::contains()``.
+       *
+       * \param p The point to check, enclosed in an ``IntervalVector``.
+       * \return A ``BoolInterval`` indicating possible containment.
+       */
+      BoolInterval contains(const IntervalVector& p) const;
+
+      /**
+       * \brief Calls ``f(i)`` for each edge of the polygon whose bounding box intersects \f$[\mathbf{x}]\f$,
+       * \f$i\f$ being the rank of the edge in the polygon.
+       *
+       * \param x The box.
+       * \param f The function called for each edge.
+       */
+      template<typename F>
+      void visit_edges(const IntervalVector& x, const F& f) const
+      {
+        _edges.visit(x, f);
+      }
+
+    protected:
+
+      const Polygon _p;
+      const BoxTree _edges;
+  };
+
   /**
    * \brief Stream output operator for ``Polygon``.
    *
@@ -17,6 +17,15 @@
 using namespace std;
 using namespace codac2;
 
+namespace
+{
+  // Box enclosing two 2d points, computed on the stack
+  IntervalVector_<2> box_2d(const IntervalVector& a, const IntervalVector& b)
+  {
+    return { a[0] | b[0], a[1] | b[1] };
+  }
+}
+
 namespace codac2
 {
   Segment::Segment(const std::array<IntervalVector,2>& x)
@@ -54,6 +63,11 @@ namespace codac2
         o3 == OrientationInterval::EMPTY || o4 == OrientationInterval::EMPTY)
       return BoolInterval::EMPTY;
 
+    else if(!box_2d(x1,x2).intersects(box_2d(e1,e2)))
+      // Disjoint boxes: not relying on the orientations, which may
+      // be uncertain for distant segments that are almost aligned
+      return BoolInterval::FALSE;
+
     else if(o1 == OrientationInterval::UNKNOWN || o2 == OrientationInterval::UNKNOWN || 
         o3 == OrientationInterval::UNKNOWN || o4 == OrientationInterval::UNKNOWN)
       return BoolInterval::UNKNOWN;
@@ -82,7 +96,7 @@ namespace codac2
 
   BoolInterval Segment::contains(const IntervalVector& p) const
   {
-    IntervalVector b = box();
+    IntervalVector_<2> b = box_2d((*this)[0], (*this)[1]); // box of the segment
 
     if(b.is_superset(p))
     {
@@ -36,6 +36,34 @@ namespace codac2
     return os;
   }
 
+  /**
+   * \brief Alias for a fixed-size column vector of doubles.
+   *
+   * The ``N`` components are stored in the object itself, without heap allocation:
+   * this type is suited for low dimensions (typically 2d or 3d points).
+   * It corresponds to ``Eigen::Matrix<double,N,1>`` and can be converted into a
+   * ``Vector`` (and conversely, provided that the sizes match).
+   *
+   * \tparam N number of components
+   */
+  template<int N>
+  using Vector_ = Eigen::Matrix<double,N,1>;
+
+  /**
+   * \brief Stream output operator for ``Vector_<N>`` objects.
+   *
+   * \param os The output stream to write to.
+   * \param x The vector whose contents are to be printed.
+   * \return A reference to the modified output stream.
+   */
+  template<int N>
+    requires (N != Dynamic)
+  inline std::ostream& operator<<(std::ostream& os, const Vector_<N>& x)
+  {
+    os << x.format(codac_vector_fmt());
+    return os;
+  }
+
   /**
    * \struct VectorCompare
    * \brief Comparison functor for ``codac2::Vector`` objects.
@@ -0,0 +1,619 @@
+/**
+ *  codac2_interval_kernels.cpp
+ * ----------------------------------------------------------------------------
+ *  \date       2025
+ *  \author     Simon Rohou
+ *  \copyright  Copyright 2025 Codac Team
+ *  \license    GNU Lesser General Public License (LGPL)
+ */
+
+#include <cassert>
+#include <cmath>
+#include <vector>
+#include <algorithm>
+#include <cstring>
+#include "codac2_interval_kernels.h"
+
+// The instruction set is selected at build time, see the option
+// WITH_SIMD of the CMake configuration (CODAC_WITH_SIMD definition)
+
+#if defined(CODAC_WITH_SIMD) && defined(__AVX2__)
+  #define CODAC_SIMD_AVX2
+#endif
+
+#if defined(CODAC_WITH_SIMD) && (defined(__SSE2__) || defined(_M_X64))
+  #define CODAC_SIMD_SSE2
+  #include <immintrin.h>
+#endif
+
+using namespace std;
+using namespace codac2;
+
+#ifdef CODAC_SIMD_SSE2
+
+namespace
+{
+  // Intervals are stored in registers as (-lb,ub). An empty interval is
+  // stored as (-oo,-oo), that is [oo,-oo]: it is then neutral for the union
+  // hull and absorbing for the intersection and the sums.
+
+  // Memory layout of the intervals, probed at the first call: the two bounds
+  // are stored next to each other at some offset in the object, either as
+  // (lb,ub) or as (-lb,ub), the empty set being stored as NaN values or as
+  // [oo,-oo]. The bounds are then loaded and stored directly. Otherwise,
+  // they are accessed through the methods of Interval.
+
+  enum class Layout { LB_UB, NEG_LB_UB, UNKNOWN };
+
+  size_t bounds_offset = 0; // offset of the bounds in an Interval object, set with the layout
+
+  inline const double* bounds(const Interval* x)
+  {
+    return reinterpret_cast<const double*>(reinterpret_cast<const char*>(x)+bounds_offset);
+  }
+
+  inline double* bounds(Interval* x)
+  {
+    return reinterpret_cast<double*>(reinterpret_cast<char*>(x)+bounds_offset);
+  }
+
+  Layout probe_layout()
+  {
+    const Interval x(1,2), e = Interval::empty();
+
+    for(bounds_offset = 0 ; bounds_offset+2*sizeof(double) <= sizeof(Interval) ; bounds_offset += alignof(double))
+    {
+      double dx[2], de[2];
+      std::memcpy(dx, bounds(&x), sizeof(dx));
+      std::memcpy(de, bounds(&e), sizeof(de));
+
+      if(dx[1] != 2. || (dx[0] != 1. && dx[0] != -1.))
+        continue;
+
+      Layout l = dx[0] == 1. ? Layout::LB_UB : Layout::NEG_LB_UB;
+      double e0 = l == Layout::LB_UB ? -de[0] : de[0];
+
+      if(!(std::isnan(e0) && std::isnan(de[1])) && !(e0 == -oo && de[1] == -oo))
+        continue;
+
+      Interval y;
+      const double dy[2] = { l == Layout::LB_UB ? -3. : 3., 4. };
+      std::memcpy(bounds(&y), dy, sizeof(dy));
+      if(y == Interval(-3,4))
+        return l;
+    }
+
+    bounds_offset = 0;
+    return Layout::UNKNOWN;
+  }
+
+  Layout layout()
+  {
+    static const Layout l = probe_layout();
+    return l;
+  }
+
+  inline __m128d empty_as_minus_oo(__m128d v)
+  {
+    __m128d nan = _mm_cmpunord_pd(v, v);
+    return _mm_or_pd(_mm_and_pd(nan, _mm_set1_pd(-oo)), _mm_andnot_pd(nan, v));
+  }
+
+  // Mask of the lanes of (-lb,ub) pairs that are valid bounds of a non-empty
+  // interval, and can then be stored directly: -lb <= ub, lb < oo and ub > -oo
+
+  inline int proper_mask(__m128d v)
+  {
+    __m128d neg = _mm_xor_pd(v, _mm_set1_pd(-0.));
+    return _mm_movemask_pd(_mm_and_pd(
+      _mm_cmple_pd(neg, _mm_shuffle_pd(v, v, 0b01)),
+      _mm_cmpgt_pd(v, _mm_set1_pd(-oo))));
+  }
+
+  // Sign of the lower bounds in memory, with the layout (lb,ub)
+  inline __m128d lb_sign() { return _mm_set_pd(0., -0.); }
+
+  inline void store_checked(__m128d v, Interval& x)
+  {
+    alignas(16) double d[2];
+    _mm_store_pd(d, v);
+
+    if(!(-d[0] <= d[1])) // also true for NaN values, obtained from empty sets
+      x.set_empty();
+    else
+      x = Interval(-d[0], d[1]);
+  }
+
+  template<Layout L>
+  inline __m128d load(const Interval* x)
+  {
+    if constexpr(L == Layout::UNKNOWN)
+    {
+      if(x->is_empty())
+        return _mm_set1_pd(-oo);
+      return _mm_set_pd(x->ub(), -x->lb());
+    }
+
+    else
+    {
+      __m128d v = _mm_loadu_pd(bounds(x));
+      if constexpr(L == Layout::LB_UB)
+        v = _mm_xor_pd(v, lb_sign());
+      return empty_as_minus_oo(v);
+    }
+  }
+
+  template<Layout L>
+  inline void store(__m128d v, Interval* x)
+  {
+    if constexpr(L != Layout::UNKNOWN)
+      if(proper_mask(v) == 0b11)
+      {
+        _mm_storeu_pd(bounds(x), L == Layout::LB_UB ? _mm_xor_pd(v, lb_sign()) : v);
+        return;
+      }
+
+    store_checked(v, *x);
+  }
+
+  #ifdef CODAC_SIMD_AVX2
+
+    // Two intervals per register: (-lb0,ub0,-lb1,ub1), loaded at once when
+    // the intervals only contain their bounds
+
+    inline __m256d lb_sign2() { return _mm256_set_pd(0., -0., 0., -0.); }
+
+    template<Layout L>
+    inline __m256d load2(const Interval* x)
+    {
+      if constexpr(L == Layout::UNKNOWN)
+        return _mm256_set_m128d(load<L>(x+1), load<L>(x));
+
+      else
+      {
+        __m256d v = sizeof(Interval) == 2*sizeof(double) ? _mm256_loadu_pd(bounds(x))
+          : _mm256_insertf128_pd(_mm256_castpd128_pd256(_mm_loadu_pd(bounds(x))), _mm_loadu_pd(bounds(x+1)), 1);
+        if constexpr(L == Layout::LB_UB)
+          v = _mm256_xor_pd(v, lb_sign2());
+        return _mm256_blendv_pd(v, _mm256_set1_pd(-oo), _mm256_cmp_pd(v, v, _CMP_UNORD_Q));
+      }
+    }
+
+    template<Layout L>
+    inline void store2(__m256d v, Interval* x)
+    {
+      if constexpr(L != Layout::UNKNOWN)
+      {
+        __m256d neg = _mm256_xor_pd(v, _mm256_set1_pd(-0.));
+        int mask = _mm256_movemask_pd(_mm256_and_pd(
+          _mm256_cmp_pd(neg, _mm256_permute_pd(v, 0b0101), _CMP_LE_OQ),
+          _mm256_cmp_pd(v, _mm256_set1_pd(-oo), _CMP_GT_OQ)));
+
+        if(mask == 0b1111)
+        {
+          if constexpr(L == Layout::LB_UB)
+            v = _mm256_xor_pd(v, lb_sign2());
+
+          if(sizeof(Interval) == 2*sizeof(double))
+            _mm256_storeu_pd(bounds(x), v);
+          else
+          {
+            _mm_storeu_pd(bounds(x), _mm256_castpd256_pd128(v));
+            _mm_storeu_pd(bounds(x+1), _mm256_extractf128_pd(v, 1));
+          }
+          return;
+        }
+      }
+
+      store<L>(_mm256_castpd256_pd128(v), x);
+      store<L>(_mm256_extractf128_pd(v, 1), x+1);
+    }
+
+  #endif
+
+  // Operations on (-lb,ub) pairs
+
+  inline __m128d add(__m128d x, __m128d y) { return _mm_add_pd(x, y); }
+  inline __m128d sub(__m128d x, __m128d y) { return _mm_add_pd(x, _mm_shuffle_pd(y, y, 0b01)); }
+  inline __m128d inter(__m128d x, __m128d y) { return _mm_min_pd(x, y); }
+  inline __m128d hull(__m128d x, __m128d y) { return _mm_max_pd(x, y); }
+
+  #ifdef CODAC_SIMD_AVX2
+
+    inline __m256d add(__m256d x, __m256d y) { return _mm256_add_pd(x, y); }
+    inline __m256d sub(__m256d x, __m256d y) { return _mm256_add_pd(x, _mm256_permute_pd(y, 0b0101)); }
+    inline __m256d inter(__m256d x, __m256d y) { return _mm256_min_pd(x, y); }
+    inline __m256d hull(__m256d x, __m256d y) { return _mm256_max_pd(x, y); }
+
+  #endif
+
+  template<Layout L, typename Op>
+  void elementwise(const Interval* x, const Interval* y, Interval* z, Index n, const Op& op)
+  {
+    IntervalKernels::UpwardRounding rounding;
+    Index k = 0;
+
+    #ifdef CODAC_SIMD_AVX2
+      for( ; k+1 < n ; k += 2)
+        store2<L>(op(load2<L>(x+k), load2<L>(y+k)), z+k);
+    #endif
+
+    for( ; k < n ; k++)
+      store<L>(op(load<L>(x+k), load<L>(y+k)), z+k);
+  }
+
+  template<typename Op>
+  void elementwise(const Interval* x, const Interval* y, Interval* z, Index n, const Op& op)
+  {
+    switch(layout())
+    {
+      case Layout::LB_UB:
+        elementwise<Layout::LB_UB>(x, y, z, n, op);
+        break;
+      case Layout::NEG_LB_UB:
+        elementwise<Layout::NEG_LB_UB>(x, y, z, n, op);
+        break;
+      default:
+        elementwise<Layout::UNKNOWN>(x, y, z, n, op);
+    }
+  }
+
+  // Product of intervals: with a = [a1,a2] and b = [b1,b2], the pair (-lb,ub)
+  // is the maximum of the four products (-a1,a1)*b1, (-a1,a1)*b2, (-a2,a2)*b1
+  // and (-a2,a2)*b2, rounded upward. The NaN values, obtained for 0*oo, are
+  // replaced by 0 as in interval arithmetic.
+
+  inline __m128d no_nan(__m128d x)
+  {
+    return _mm_andnot_pd(_mm_cmpunord_pd(x, x), x);
+  }
+
+  inline __m128d mul(__m128d a1, __m128d a2, __m128d b1, __m128d b2)
+  {
+    return _mm_max_pd(
+      _mm_max_pd(no_nan(_mm_mul_pd(a1, b1)), no_nan(_mm_mul_pd(a1, b2))),
+      _mm_max_pd(no_nan(_mm_mul_pd(a2, b1)), no_nan(_mm_mul_pd(a2, b2))));
+  }
+
+  #ifdef CODAC_SIMD_AVX2
+
+    inline __m256d no_nan(__m256d x)
+    {
+      return _mm256_andnot_pd(_mm256_cmp_pd(x, x, _CMP_UNORD_Q), x);
+    }
+
+    inline __m256d mul(__m256d a1, __m256d a2, __m256d b1, __m256d b2)
+    {
+      return _mm256_max_pd(
+        _mm256_max_pd(no_nan(_mm256_mul_pd(a1, b1)), no_nan(_mm256_mul_pd(a1, b2))),
+        _mm256_max_pd(no_nan(_mm256_mul_pd(a2, b1)), no_nan(_mm256_mul_pd(a2, b2))));
+    }
+
+  #endif
+
+  template<Layout L>
+  void product(const Interval* a, Index r, Index c, const Interval* b, Index p, Interval* z)
+  {
+    IntervalKernels::UpwardRounding rounding;
+
+    // Rows of a containing an empty interval
+    vector<bool> empty_row(r, false);
+    for(Index j = 0 ; j < c ; j++)
+      for(Index i = 0 ; i < r ; i++)
+        if(a[i+j*r].is_empty())
+          empty_row[i] = true;
+
+    // Each column of z is computed as a sum of the columns of a, weighted by
+    // the coefficients of b, the sums being accumulated in (-lb,ub) pairs.
+    // The coefficients of a are loaded as (-lb,ub) pairs, from which the pairs
+    // (-lb,lb) and (-ub,ub) are obtained by duplicating a lane and flipping
+    // the sign of the second one.
+    vector<double> acc(2*r);
+
+    for(Index q = 0 ; q < p ; q++)
+    {
+      const Interval* bq = b+q*c;
+      bool empty_col = false;
+      std::fill(acc.begin(), acc.end(), 0.);
+
+      for(Index j = 0 ; j < c ; j++)
+      {
+        if(bq[j].is_empty())
+        {
+          empty_col = true;
+          break;
+        }
+
+        const Interval* aj = a+j*r;
+        Index i = 0;
+
+        #ifdef CODAC_SIMD_AVX2
+
+          const __m256d sign1 = _mm256_set_pd(-0., 0., -0., 0.), sign2 = _mm256_set_pd(0., -0., 0., -0.);
+          const __m256d b1 = _mm256_set1_pd(bq[j].lb()), b2 = _mm256_set1_pd(bq[j].ub());
+
+          for( ; i+1 < r ; i += 2)
+          {
+            __m256d v = load2<L>(aj+i);
+            __m256d a1 = _mm256_xor_pd(sign1, _mm256_movedup_pd(v));
+            __m256d a2 = _mm256_xor_pd(sign2, _mm256_permute_pd(v, 0b1111));
+            _mm256_storeu_pd(acc.data()+2*i,
+              _mm256_add_pd(_mm256_loadu_pd(acc.data()+2*i), mul(a1, a2, b1, b2)));
+          }
+
+        #endif
+
+        const __m128d sign1_ = _mm_set_pd(-0., 0.), sign2_ = _mm_set_pd(0., -0.);
+        const __m128d b1_ = _mm_set1_pd(bq[j].lb()), b2_ = _mm_set1_pd(bq[j].ub());
+
+        for( ; i < r ; i++)
+        {
+          __m128d v = load<L>(aj+i);
+          __m128d a1 = _mm_xor_pd(sign1_, _mm_unpacklo_pd(v, v));
+          __m128d a2 = _mm_xor_pd(sign2_, _mm_unpackhi_pd(v, v));
+          _mm_storeu_pd(acc.data()+2*i,
+            _mm_add_pd(_mm_loadu_pd(acc.data()+2*i), mul(a1, a2, b1_, b2_)));
+        }
+      }
+
+      for(Index i = 0 ; i < r ; i++)
+      {
+        if(empty_col || empty_row[i])
+          z[i+q*r].set_empty();
+        else
+          store<L>(_mm_loadu_pd(acc.data()+2*i), z+i+q*r);
+      }
+    }
+  }
+
+  // Operations on separate arrays of bounds: the lower bounds and the upper
+  // bounds of several intervals are loaded in two registers, the lower bounds
+  // being negated so that all the operations are rounded upward. An empty
+  // interval is stored as [oo,-oo]: the results with an empty input, or whose
+  // bounds are not ordered (NaN values), are set to [oo,-oo].
+
+  inline void load(const double* p, __m128d& x) { x = _mm_loadu_pd(p); }
+  inline void store(double* p, __m128d x) { _mm_storeu_pd(p, x); }
+  inline __m128d neg(__m128d x) { return _mm_xor_pd(x, _mm_set1_pd(-0.)); }
+  inline __m128d le(__m128d x, __m128d y) { return _mm_cmple_pd(x, y); }
+  inline __m128d and_(__m128d x, __m128d y) { return _mm_and_pd(x, y); }
+  inline __m128d select(__m128d mask, __m128d x, double y)
+  {
+    return _mm_or_pd(_mm_and_pd(mask, x), _mm_andnot_pd(mask, _mm_set1_pd(y)));
+  }
+
+  #ifdef CODAC_SIMD_AVX2
+
+    inline void load(const double* p, __m256d& x) { x = _mm256_loadu_pd(p); }
+    inline void store(double* p, __m256d x) { _mm256_storeu_pd(p, x); }
+    inline __m256d neg(__m256d x) { return _mm256_xor_pd(x, _mm256_set1_pd(-0.)); }
+    inline __m256d le(__m256d x, __m256d y) { return _mm256_cmp_pd(x, y, _CMP_LE_OQ); }
+    inline __m256d and_(__m256d x, __m256d y) { return _mm256_and_pd(x, y); }
+    inline __m256d select(__m256d mask, __m256d x, double y) { return _mm256_blendv_pd(_mm256_set1_pd(y), x, mask); }
+
+  #endif
+
+  struct AddBounds
+  {
+    template<typename V>
+    void operator()(V xl, V xu, V yl, V yu, V& zl, V& zu) const
+    {
+      zl = neg(add(neg(xl), neg(yl)));
+      zu = add(xu, yu);
+    }
+  };
+
+  struct SubBounds
+  {
+    template<typename V>
+    void operator()(V xl, V xu, V yl, V yu, V& zl, V& zu) const
+    {
+      zl = neg(add(neg(xl), yu));
+      zu = add(xu, neg(yl));
+    }
+  };
+
+  struct MulBounds
+  {
+    template<typename V>
+    void operator()(V xl, V xu, V yl, V yu, V& zl, V& zu) const
+    {
+      zl = neg(mul(neg(xl), neg(xu), yl, yu));
+      zu = mul(xl, xu, yl, yu);
+    }
+  };
+
+  template<typename V, typename Op>
+  inline void bounds_op(const double* xl, const double* xu, const double* yl, const double* yu,
+    double* zl, double* zu, const Op& op)
+  {
+    V xl_, xu_, yl_, yu_, zl_, zu_;
+    load(xl, xl_); load(xu, xu_);
+    load(yl, yl_); load(yu, yu_);
+    op(xl_, xu_, yl_, yu_, zl_, zu_);
+
+    V proper = and_(and_(le(xl_, xu_), le(yl_, yu_)), le(zl_, zu_));
+    store(zl, select(proper, zl_, oo));
+    store(zu, select(proper, zu_, -oo));
+  }
+
+  template<typename Op>
+  void bounds_elementwise(const double* xl, const double* xu, const double* yl, const double* yu,
+    double* zl, double* zu, Index n, const Op& op)
+  {
+    IntervalKernels::UpwardRounding rounding;
+    Index k = 0;
+
+    #ifdef CODAC_SIMD_AVX2
+      for( ; k+3 < n ; k += 4)
+        bounds_op<__m256d>(xl+k, xu+k, yl+k, yu+k, zl+k, zu+k, op);
+    #endif
+
+    for( ; k+1 < n ; k += 2)
+      bounds_op<__m128d>(xl+k, xu+k, yl+k, yu+k, zl+k, zu+k, op);
+
+    if(k < n) // last interval, duplicated in the two lanes of a register
+    {
+      double b[6][2] = {
+        { xl[k], xl[k] }, { xu[k], xu[k] }, { yl[k], yl[k] }, { yu[k], yu[k] }, { }, { }
+      };
+      bounds_op<__m128d>(b[0], b[1], b[2], b[3], b[4], b[5], op);
+      zl[k] = b[4][0];
+      zu[k] = b[5][0];
+    }
+  }
+}
+
+#else
+
+namespace
+{
+  // Scalar implementation of the operations on separate arrays of bounds,
+  // an empty interval being stored as [oo,-oo]
+
+  template<typename Op>
+  void bounds_elementwise(const double* xl, const double* xu, const double* yl, const double* yu,
+    double* zl, double* zu, Index n, const Op& op)
+  {
+    for(Index k = 0 ; k < n ; k++)
+    {
+      Interval z = op(Interval(xl[k],xu[k]), Interval(yl[k],yu[k]));
+      zl[k] = z.is_empty() ? oo : z.lb();
+      zu[k] = z.is_empty() ? -oo : z.ub();
+    }
+  }
+}
+
+#endif
+
+IntervalKernels::UpwardRounding::UpwardRounding()
+{
+  #ifdef CODAC_SIMD_SSE2
+    // Writing the MXCSR register is expensive: it is done only when needed
+    _mode = _mm_getcsr();
+    _switched = (_mode & _MM_ROUND_MASK) != _MM_ROUND_UP;
+    if(_switched)
+      _mm_setcsr((_mode & ~_MM_ROUND_MASK) | _MM_ROUND_UP);
+  #endif
+}
+
+IntervalKernels::UpwardRounding::~UpwardRounding()
+{
+  #ifdef CODAC_SIMD_SSE2
+    if(_switched)
+      _mm_setcsr(_mode);
+  #endif
+}
+
+SIMDInstructionSet IntervalKernels::instruction_set()
+{
+  #if defined(CODAC_SIMD_AVX2)
+    return SIMDInstructionSet::AVX2;
+  #elif defined(CODAC_SIMD_SSE2)
+    return SIMDInstructionSet::SSE2;
+  #else
+    return SIMDInstructionSet::SCALAR;
+  #endif
+}
+
+void IntervalKernels::add(const Interval* x, const Interval* y, Interval* z, Index n)
+{
+  #ifdef CODAC_SIMD_SSE2
+    elementwise(x, y, z, n, [](auto a, auto b) { return ::add(a,b); });
+  #else
+    for(Index k = 0 ; k < n ; k++)
+      z[k] = x[k] + y[k];
+  #endif
+}
+
+void IntervalKernels::sub(const Interval* x, const Interval* y, Interval* z, Index n)
+{
+  #ifdef CODAC_SIMD_SSE2
+    elementwise(x, y, z, n, [](auto a, auto b) { return ::sub(a,b); });
+  #else
+    for(Index k = 0 ; k < n ; k++)
+      z[k] = x[k] - y[k];
+  #endif
+}
+
+void IntervalKernels::inter(const Interval* x, const Interval* y, Interval* z, Index n)
+{
+  #ifdef CODAC_SIMD_SSE2
+    elementwise(x, y, z, n, [](auto a, auto b) { return ::inter(a,b); });
+  #else
+    for(Index k = 0 ; k < n ; k++)
+      z[k] = x[k] & y[k];
+  #endif
+}
+
+void IntervalKernels::hull(const Interval* x, const Interval* y, Interval* z, Index n)
+{
+  #ifdef CODAC_SIMD_SSE2
+    elementwise(x, y, z, n, [](auto a, auto b) { return ::hull(a,b); });
+  #else
+    for(Index k = 0 ; k < n ; k++)
+      z[k] = x[k] | y[k];
+  #endif
+}
+
+void IntervalKernels::mul(const Interval* a, Index r, Index c, const Interval* b, Index p, Interval* z)
+{
+  assert(z != a && z != b);
+
+  #ifdef CODAC_SIMD_SSE2
+
+    switch(layout())
+    {
+      case Layout::LB_UB:
+        product<Layout::LB_UB>(a, r, c, b, p, z);
+        break;
+      case Layout::NEG_LB_UB:
+        product<Layout::NEG_LB_UB>(a, r, c, b, p, z);
+        break;
+      default:
+        product<Layout::UNKNOWN>(a, r, c, b, p, z);
+    }
+
+  #else
+
+    for(Index q = 0 ; q < p ; q++)
+      for(Index i = 0 ; i < r ; i++)
+      {
+        Interval s = c == 0 ? Interval(0.) : a[i]*b[q*c];
+        for(Index j = 1 ; j < c ; j++)
+          s += a[i+j*r]*b[j+q*c];
+        z[i+q*r] = s;
+      }
+
+  #endif
+}
+
+void IntervalKernels::add(const double* xl, const double* xu, const double* yl, const double* yu,
+  double* zl, double* zu, Index n)
+{
+  #ifdef CODAC_SIMD_SSE2
+    bounds_elementwise(xl, xu, yl, yu, zl, zu, n, AddBounds());
+  #else
+    bounds_elementwise(xl, xu, yl, yu, zl, zu, n, [](const Interval& a, const Interval& b) { return a+b; });
+  #endif
+}
+
+void IntervalKernels::sub(const double* xl, const double* xu, const double* yl, const double* yu,
+  double* zl, double* zu, Index n)
+{
+  #ifdef CODAC_SIMD_SSE2
+    bounds_elementwise(xl, xu, yl, yu, zl, zu, n, SubBounds());
+  #else
+    bounds_elementwise(xl, xu, yl, yu, zl, zu, n, [](const Interval& a, const Interval& b) { return a-b; });
+  #endif
+}
+
+void IntervalKernels::mul(const double* xl, const double* xu, const double* yl, const double* yu,
+  double* zl, double* zu, Index n)
+{
+  #ifdef CODAC_SIMD_SSE2
+    bounds_elementwise(xl, xu, yl, yu, zl, zu, n, MulBounds());
+  #else
+    bounds_elementwise(xl, xu, yl, yu, zl, zu, n, [](const Interval& a, const Interval& b) { return a*b; });
+  #endif
+}
@@ -0,0 +1,153 @@
+/**
+ *  \file codac2_interval_kernels.h
+ * ----------------------------------------------------------------------------
+ *  \date       2025
+ *  \author     Simon Rohou
+ *  \copyright  Copyright 2025 Codac Team
+ *  \license    GNU Lesser General Public License (LGPL)
+ */
+
+#pragma once
+
+#include "codac2_Interval.h"
+
+namespace codac2
+{
+  /**
+   * \enum SIMDInstructionSet
+   * \brief Instruction set used by the interval kernels
+   */
+  enum class SIMDInstructionSet
+  {
+    SCALAR, //!< element by element, with Gaol operations
+    SSE2, //!< one interval per 128-bit register
+    AVX2 //!< two intervals per 256-bit register
+  };
+
+  /**
+   * \class IntervalKernels
+   * \brief Bulk operations on contiguous arrays of intervals, used by the element-wise
+   * operations of interval vectors and matrices and by their products.
+   *
+   * The instruction set is selected at build time: when Codac is configured with the
+   * ``WITH_SIMD`` option, the kernels are compiled with AVX2 (or SSE2) instructions.
+   * Otherwise, a scalar implementation based on Gaol is used.
+   *
+   * The SIMD implementations store each interval \f$[a^-,a^+]\f$ as the pair
+   * \f$(-a^-,a^+)\f$ in a register. With the rounding mode set upward, a single
+   * operation on this pair rounds both bounds outward: for instance,
+   * \f$-a^--b^-\f$ rounded upward is the opposite of \f$a^-+b^-\f$ rounded downward.
+   * The results are thus guaranteed, and equal to the ones of the scalar implementation.
+   *
+   * The bounds are read from and written to the Interval objects directly, as pairs of
+   * doubles, when the memory layout of Interval allows it (this layout is checked once,
+   * at the first call).
+   *
+   * \note The output array may be one of the input arrays, excepted for matrix products.
+   */
+  struct IntervalKernels
+  {
+    /**
+     * \class UpwardRounding
+     * \brief Keeps the rounding mode of the SIMD operations upward during its lifetime
+     *
+     * Each kernel sets this rounding mode if it is not already set, and restores the
+     * previous one afterwards. When kernels are called in a row, for instance on many
+     * small vectors, this switch may cost more than the operations themselves. An
+     * ``UpwardRounding`` object can then be created before the calls, so that the mode
+     * is switched only once.
+     *
+     * \warning During the lifetime of this object, the floating-point operations on
+     * doubles performed outside the kernels are also rounded upward.
+     */
+    class UpwardRounding
+    {
+      public:
+
+        /**
+         * \brief Sets the rounding mode upward, if it is not already set
+         */
+        UpwardRounding();
+
+        /**
+         * \brief Restores the previous rounding mode
+         */
+        ~UpwardRounding();
+
+        UpwardRounding(const UpwardRounding&) = delete;
+        UpwardRounding& operator=(const UpwardRounding&) = delete;
+
+      protected:
+
+        unsigned int _mode = 0;
+        bool _switched = false;
+    };
+
+    /**
+     * \brief Returns the instruction set selected at build time
+     *
+     * \return instruction set of the kernels
+     */
+    static SIMDInstructionSet instruction_set();
+
+    /**
+     * \brief Element-wise sum: \f$z_k=x_k+y_k\f$, \f$k<n\f$
+     */
+    static void add(const Interval* x, const Interval* y, Interval* z, Index n);
+
+    /**
+     * \brief Element-wise difference: \f$z_k=x_k-y_k\f$, \f$k<n\f$
+     */
+    static void sub(const Interval* x, const Interval* y, Interval* z, Index n);
+
+    /**
+     * \brief Element-wise intersection: \f$z_k=x_k\cap y_k\f$, \f$k<n\f$
+     */
+    static void inter(const Interval* x, const Interval* y, Interval* z, Index n);
+
+    /**
+     * \brief Element-wise union hull: \f$z_k=x_k\sqcup y_k\f$, \f$k<n\f$
+     */
+    static void hull(const Interval* x, const Interval* y, Interval* z, Index n);
+
+    /**
+     * \brief Matrix product \f$\mathbf{z}=\mathbf{a}\mathbf{b}\f$, the matrices being stored
+     * in column-major order
+     *
+     * \param a left matrix, of size \f$r\times c\f$
+     * \param r number of rows of \f$\mathbf{a}\f$
+     * \param c number of columns of \f$\mathbf{a}\f$
+     * \param b right matrix, of size \f$c\times p\f$
+     * \param p number of columns of \f$\mathbf{b}\f$
+     * \param z result, of size \f$r\times p\f$, distinct from \f$\mathbf{a}\f$ and \f$\mathbf{b}\f$
+     */
+    static void mul(const Interval* a, Index r, Index c, const Interval* b, Index p, Interval* z);
+
+    /**
+     * \brief Element-wise sum of intervals given by separate arrays of bounds:
+     * \f$[z^-_k,z^+_k]=[x^-_k,x^+_k]+[y^-_k,y^+_k]\f$, \f$k<n\f$
+     *
+     * An empty interval is stored as \f$[\infty,-\infty]\f$, in the inputs and in the results.
+     */
+    static void add(const double* xl, const double* xu, const double* yl, const double* yu,
+      double* zl, double* zu, Index n);
+
+    /**
+     * \brief Element-wise difference of intervals given by separate arrays of bounds:
+     * \f$[z^-_k,z^+_k]=[x^-_k,x^+_k]-[y^-_k,y^+_k]\f$, \f$k<n\f$
+     *
+     * An empty interval is stored as \f$[\infty,-\infty]\f$, in the inputs and in the results.
+     */
+    static void sub(const double* xl, const double* xu, const double* yl, const double* yu,
+      double* zl, double* zu, Index n);
+
+    /**
+     * \brief Element-wise product of intervals given by separate arrays of bounds:
+     * \f$[z^-_k,z^+_k]=[x^-_k,x^+_k]\cdot[y^-_k,y^+_k]\f$, \f$k<n\f$
+     *
+     * An empty interval is stored as \f$[\infty,-\infty]\f$, in the inputs and in the results.
+     */
+    static void mul(const double* xl, const double* xu, const double* yl, const double* yu,
+      double* zl, double* zu, Index n);
+  };
+}
@@ -22,6 +22,7 @@
 #include <type_traits>
 #include "codac2_Interval.h"
 #include "codac2_Interval_operations.h"
+#include "codac2_interval_kernels.h"
 #include "codac2_assert.h"
 
 namespace Eigen
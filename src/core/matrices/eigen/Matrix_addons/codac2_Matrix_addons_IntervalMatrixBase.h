@@ -213,6 +213,14 @@ inline auto& operator&=(const MatrixBase<OtherDerived>& x)
       set_empty();
       return *this;
     }
+
+    // Contiguous storages of the same layout: bulk operation
+    if constexpr(IsIntervalDomain<Scalar> && std::is_base_of_v<PlainObjectBase<OtherDerived>,OtherDerived>
+      && (int)OtherDerived::IsRowMajor == (int)Base::IsRowMajor)
+    {
+      codac2::IntervalKernels::inter(this->data(), x.derived().data(), this->data(), this->size());
+      return *this;
+    }
   }
   
   for(Index i = 0 ; i < this->rows() ; i++)
@@ -243,6 +251,14 @@ inline auto& operator|=(const MatrixBase<OtherDerived>& x)
   {
     if(x.is_empty())
       return *this;
+
+    // Contiguous storages of the same layout: bulk operation
+    if constexpr(IsIntervalDomain<Scalar> && std::is_base_of_v<PlainObjectBase<OtherDerived>,OtherDerived>
+      && (int)OtherDerived::IsRowMajor == (int)Base::IsRowMajor)
+    {
+      codac2::IntervalKernels::hull(this->data(), x.derived().data(), this->data(), this->size());
+      return *this;
+    }
   }
 
   for(Index i = 0 ; i < this->rows() ; i++)
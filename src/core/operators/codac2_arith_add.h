@@ -12,6 +12,7 @@
 #include "codac2_Interval.h"
 #include "codac2_IntervalVector.h"
 #include "codac2_IntervalMatrix.h"
+#include "codac2_interval_kernels.h"
 #include "codac2_AnalyticType.h"
 #include "codac2_AnalyticExprWrapper.h"
 
@@ -255,7 +256,9 @@ namespace codac2
   inline IntervalVector AddOp::fwd(const IntervalVector& x1, const IntervalVector& x2)
   {
     assert(x1.size() == x2.size());
-    return x1 + x2;
+    IntervalVector y(x1.size());
+    IntervalKernels::add(x1.data(), x2.data(), y.data(), y.size());
+    return y;
   }
 
   inline VectorType AddOp::fwd_natural(const VectorType& x1, const VectorType& x2)
@@ -290,7 +293,9 @@ namespace codac2
   inline IntervalMatrix AddOp::fwd(const IntervalMatrix& x1, const IntervalMatrix& x2)
   {
     assert(x1.cols() == x2.cols() && x1.rows() == x2.rows());
-    return x1 + x2;
+    IntervalMatrix y(x1.rows(),x1.cols());
+    IntervalKernels::add(x1.data(), x2.data(), y.data(), y.size());
+    return y;
   }
 
   inline MatrixType AddOp::fwd_natural(const MatrixType& x1, const MatrixType& x2)
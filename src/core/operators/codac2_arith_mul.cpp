@@ -108,8 +108,8 @@ namespace codac2
         // "Tree matrix" attempt, works well in example.
         // Only contract x2.
         IntervalMatrix P = gauss_jordan(x1.mid());
-        IntervalVector b_tilde = P*y;
-        IntervalMatrix A_tilde = P*x1;
+        IntervalVector b_tilde = MulOp::fwd(P,y);
+        IntervalMatrix A_tilde = MulOp::fwd(P,x1);
         // A_tilde should be a tree matrix
             
         #if 1
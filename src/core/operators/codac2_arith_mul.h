@@ -13,6 +13,7 @@
 #include "codac2_IntervalVector.h"
 #include "codac2_IntervalRow.h"
 #include "codac2_IntervalMatrix.h"
+#include "codac2_interval_kernels.h"
 #include "codac2_AnalyticType.h"
 #include "codac2_AnalyticExprWrapper.h"
 #include "codac2_arith_add.h"
@@ -282,7 +283,9 @@ namespace codac2
   inline IntervalVector MulOp::fwd(const IntervalMatrix& x1, const IntervalVector& x2)
   {
     assert(x1.cols() == x2.size());
-    return x1 * x2;
+    IntervalVector y(x1.rows());
+    IntervalKernels::mul(x1.data(), x1.rows(), x1.cols(), x2.data(), 1, y.data());
+    return y;
   }
 
   inline VectorType MulOp::fwd_natural(const MatrixType& x1, const VectorType& x2)
@@ -318,7 +321,9 @@ namespace codac2
   inline IntervalMatrix MulOp::fwd(const IntervalMatrix& x1, const IntervalMatrix& x2)
   {
     assert(x1.cols() == x2.rows());
-    return x1 * x2;
+    IntervalMatrix y(x1.rows(),x2.cols());
+    IntervalKernels::mul(x1.data(), x1.rows(), x1.cols(), x2.data(), x2.cols(), y.data());
+    return y;
   }
 
   inline MatrixType MulOp::fwd_natural(const MatrixType& x1, const MatrixType& x2)
@@ -97,6 +97,48 @@ namespace codac2
         std::get<0>(this->_x)->bwd_eval(v);
       }
 
+      void compile(AnalyticTape& t) const
+      {
+        std::get<0>(this->_x)->compile(t);
+        t.add_step(*this, 1);
+      }
+
+      void fwd_eval_step(ValuesSlots& v, const Index* s, [[maybe_unused]] Index total_input_size, bool natural_eval) const
+      {
+        if(natural_eval)
+          AnalyticExpr<ScalarType>::init_value(
+            v, s[0], ComponentOp::fwd_natural(AnalyticExpr<VectorType>::value(v, s[1]), _i));
+        else
+          AnalyticExpr<ScalarType>::init_value(
+            v, s[0], ComponentOp::fwd_centered(AnalyticExpr<VectorType>::value(v, s[1]), _i));
+      }
+
+      void bwd_eval_step(ValuesSlots& v, const Index* s) const
+      {
+        ComponentOp::bwd(AnalyticExpr<ScalarType>::value(v, s[0]).a, AnalyticExpr<VectorType>::value(v, s[1]).a, _i);
+      }
+
+      void fwd_eval_batch_step(ValuesSlots& v, const Index* s, Index n, [[maybe_unused]] Index total_input_size, bool natural_eval) const
+      {
+        auto& x1 = AnalyticExpr<VectorType>::batch_value(v, s[1]);
+        if(natural_eval) // copy of the bounds of the component
+          AnalyticExpr<ScalarType>::init_batch_value(v, s[0]).set_components(x1, _i, 1, 1);
+        else
+          AnalyticExpr<ScalarType>::init_batch_value(
+            v, s[0], n, [&](Index k) { return ComponentOp::fwd_centered(x1.get(k), _i); });
+      }
+
+      void bwd_eval_batch_step(ValuesSlots& v, const Index* s) const
+      {
+        bwd_batch([&](auto& y, auto& x1) { ComponentOp::bwd(y, x1, _i); },
+          AnalyticExpr<ScalarType>::batch_value(v, s[0]), AnalyticExpr<VectorType>::batch_value(v, s[1]));
+      }
+
+      bool is_same_operation(const AnalyticExprBase& e) const
+      {
+        return dynamic_cast<const AnalyticOperationExpr<ComponentOp,ScalarType,VectorType>&>(e)._i == _i;
+      }
+
       std::pair<Index,Index> output_shape() const
       {
         return ComponentOp::output_shape(std::get<0>(this->_x),_i);
@@ -162,6 +204,49 @@ namespace codac2
         std::get<0>(this->_x)->bwd_eval(v);
       }
 
+      void compile(AnalyticTape& t) const
+      {
+        std::get<0>(this->_x)->compile(t);
+        t.add_step(*this, 1);
+      }
+
+      void fwd_eval_step(ValuesSlots& v, const Index* s, [[maybe_unused]] Index total_input_size, bool natural_eval) const
+      {
+        if(natural_eval)
+          AnalyticExpr<ScalarType>::init_value(
+            v, s[0], ComponentOp::fwd_natural(AnalyticExpr<MatrixType>::value(v, s[1]), _i, _j));
+        else
+          AnalyticExpr<ScalarType>::init_value(
+            v, s[0], ComponentOp::fwd_centered(AnalyticExpr<MatrixType>::value(v, s[1]), _i, _j));
+      }
+
+      void bwd_eval_step(ValuesSlots& v, const Index* s) const
+      {
+        ComponentOp::bwd(AnalyticExpr<ScalarType>::value(v, s[0]).a, AnalyticExpr<MatrixType>::value(v, s[1]).a, _i, _j);
+      }
+
+      void fwd_eval_batch_step(ValuesSlots& v, const Index* s, Index n, [[maybe_unused]] Index total_input_size, bool natural_eval) const
+      {
+        auto& x1 = AnalyticExpr<MatrixType>::batch_value(v, s[1]);
+        if(natural_eval) // copy of the bounds of the component
+          AnalyticExpr<ScalarType>::init_batch_value(v, s[0]).set_components(x1, _i+_j*x1.rows, 1, 1);
+        else
+          AnalyticExpr<ScalarType>::init_batch_value(
+            v, s[0], n, [&](Index k) { return ComponentOp::fwd_centered(x1.get(k), _i, _j); });
+      }
+
+      void bwd_eval_batch_step(ValuesSlots& v, const Index* s) const
+      {
+        bwd_batch([&](auto& y, auto& x1) { ComponentOp::bwd(y, x1, _i, _j); },
+          AnalyticExpr<ScalarType>::batch_value(v, s[0]), AnalyticExpr<MatrixType>::batch_value(v, s[1]));
+      }
+
+      bool is_same_operation(const AnalyticExprBase& e) const
+      {
+        const auto& e_ = dynamic_cast<const AnalyticOperationExpr<ComponentOp,ScalarType,MatrixType>&>(e);
+        return e_._i == _i && e_._j == _j;
+      }
+
       std::pair<Index,Index> output_shape() const
       {
         return ComponentOp::output_shape(std::get<0>(this->_x),_i,_j);
@@ -63,6 +63,10 @@ namespace codac2
     static ScalarType fwd_centered(const VectorType& x1, const VectorType& x2);
     static void bwd(const Interval& y, IntervalVector& x1, IntervalVector& x2);
 
+    // For two fixed-size 2d vectors (without heap allocation)
+    static Interval fwd(const IntervalVector_<2>& x1, const IntervalVector_<2>& x2);
+    static void bwd(const Interval& y, IntervalVector_<2>& x1, IntervalVector_<2>& x2);
+
     // For three vectors (merged into a 3×3 matrix)
     template<typename X1, typename X2, typename X3>
     static std::pair<Index,Index> output_shape([[maybe_unused]] const X1& s1, [[maybe_unused]] const X2& s2, [[maybe_unused]] const X3& s3)
@@ -178,9 +182,8 @@ namespace codac2
   inline Interval DetOp::fwd(const IntervalVector& x1, const IntervalVector& x2)
   {
     assert_release(x1.size() == 2 && x2.size() == 2 && "determinant only computable for pairs of 2d vectors");
-    IntervalMatrix m(2,2);
-    m.col(0) = x1; m.col(1) = x2;
-    return DetOp::fwd(m);
+    // Same as DetOp::fwd(m) for m = [x1 x2], without building the matrix
+    return x1[0]*x2[1]-x2[0]*x1[1];
   }
 
   inline ScalarType DetOp::fwd_natural(const VectorType& x1, const VectorType& x2)
@@ -222,11 +225,24 @@ namespace codac2
   inline void DetOp::bwd(const Interval& y, IntervalVector& x1, IntervalVector& x2)
   {
     assert_release(x1.size() == 2 && x2.size() == 2 && "determinant only computable for pairs of 2d vectors");
-    IntervalMatrix m(2,2);
-    m.col(0) = x1; m.col(1) = x2;
-    DetOp::bwd(y,m);
-    x1 &= m.col(0);
-    x2 &= m.col(1);
+    // Same as DetOp::bwd(y,m) for m = [x1 x2], the components being contracted in place
+    Interval z1 = x1[0]*x2[1], z2 = x1[1]*x2[0];
+    SubOp::bwd(y, z1, z2);
+    MulOp::bwd(z1, x1[0], x2[1]);
+    MulOp::bwd(z2, x1[1], x2[0]);
+  }
+
+  inline Interval DetOp::fwd(const IntervalVector_<2>& x1, const IntervalVector_<2>& x2)
+  {
+    return x1[0]*x2[1]-x2[0]*x1[1];
+  }
+
+  inline void DetOp::bwd(const Interval& y, IntervalVector_<2>& x1, IntervalVector_<2>& x2)
+  {
+    Interval z1 = x1[0]*x2[1], z2 = x1[1]*x2[0];
+    SubOp::bwd(y, z1, z2);
+    MulOp::bwd(z1, x1[0], x2[1]);
+    MulOp::bwd(z2, x1[1], x2[0]);
   }
 
   inline Interval DetOp::fwd(const IntervalVector& x1, const IntervalVector& x2, const IntervalVector& x3)
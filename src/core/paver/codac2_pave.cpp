@@ -7,13 +7,54 @@
  *  \license    GNU Lesser General Public License (LGPL)
  */
 
+#include <deque>
+#include <chrono>
 #include "codac2_pave.h"
+#include "codac2_parallel.h"
 
 using namespace std;
 using namespace codac2;
 
 namespace codac2
 {
+  // The processing of one node is shared by the serial and parallel algorithms,
+  // so that both of them provide the same paving. Returns true if the node has
+  // been bisected (its children are then to be processed).
+
+  static bool pave_node(const std::shared_ptr<PavingOut_Node>& n, const CtcBase<IntervalVector>& c, double eps, bool& boundary)
+  {
+    c.contract(get<0>(n->boxes()));
+    boundary = false;
+
+    if(!get<0>(n->boxes()).is_empty())
+    {
+      if(get<0>(n->boxes()).max_diam() > eps)
+      {
+        n->bisect();
+        return true;
+      }
+
+      boundary = true;
+    }
+
+    return false;
+  }
+
+  static bool pave_node(const std::shared_ptr<PavingInOut_Node>& n, const SepBase& s, double eps)
+  {
+    auto xs = s.separate(get<0>(n->boxes()));
+    auto boundary = (xs.inner & xs.outer);
+    n->boxes() = { xs.outer, xs.inner };
+
+    if(!boundary.is_empty() && boundary.max_diam() > eps)
+    {
+      n->bisect();
+      return true;
+    }
+
+    return false;
+  }
+
   PavingOut pave(const IntervalVector& x, std::shared_ptr<const CtcBase<IntervalVector>> c,
     double eps, bool verbose)
   {
@@ -49,20 +90,15 @@ namespace codac2
       n = l.front();
       l.pop_front();
 
-      c.contract(get<0>(n->boxes()));
-
-      if(!get<0>(n->boxes()).is_empty())
+      bool boundary;
+      if(pave_node(n, c, eps, boundary))
       {
-        if(get<0>(n->boxes()).max_diam() > eps)
-        {
-          n->bisect();
-          l.push_back(n->left());
-          l.push_back(n->right());
-        }
-        
-        else if(verbose)
-          n_boundary++;
+        l.push_back(n->left());
+        l.push_back(n->right());
       }
+
+      else if(boundary)
+        n_boundary++;
     }
 
     time = (double)(clock()-t_start)/CLOCKS_PER_SEC;
@@ -94,13 +130,8 @@ namespace codac2
       n = l.front();
       l.pop_front();
 
-      auto xs = s.separate(get<0>(n->boxes()));
-      auto boundary = (xs.inner & xs.outer);
-      n->boxes() = { xs.outer, xs.inner };
-
-      if(!boundary.is_empty() && boundary.max_diam() > eps)
+      if(pave_node(n, s, eps))
       {
-        n->bisect();
         l.push_back(n->left());
         l.push_back(n->right());
       }
@@ -111,6 +142,161 @@ namespace codac2
     return p;
   }
 
+  PavingOut parallel_pave(const IntervalVector& x, std::shared_ptr<const CtcBase<IntervalVector>> c,
+    double eps, std::size_t nb_threads, bool verbose)
+  {
+    return parallel_pave(x, *c, eps, nb_threads, verbose);
+  }
+
+  PavingOut parallel_pave(const IntervalVector& x, const CtcBase<IntervalVector>& c,
+    double eps, std::size_t nb_threads, bool verbose)
+  {
+    assert_release(eps > 0.);
+    assert_release(!x.is_empty());
+
+    // Wall-clock time: clock() would sum the CPU time of all the threads
+    auto t_start = chrono::steady_clock::now();
+    std::atomic<Index> n_boundary = 0;
+
+    PavingOut p(x);
+    // Same first level as for the serial algorithm, see pave()
+    p.tree()->bisect();
+    p.tree()->left()->boxes() = { x };
+    get<0>(p.tree()->right()->boxes()).set_empty();
+
+    work_stealing_process<std::shared_ptr<PavingOut_Node>>({ p.tree()->left() },
+      [&](const std::shared_ptr<PavingOut_Node>& n, const auto& push)
+      {
+        bool boundary;
+        if(pave_node(n, c, eps, boundary))
+        {
+          push(n->left());
+          push(n->right());
+        }
+
+        else if(boundary)
+          n_boundary++;
+      },
+      nb_threads);
+
+    if(verbose)
+      printf("Computation time: %.4fs, %ld boxes\n",
+        chrono::duration<double>(chrono::steady_clock::now()-t_start).count(), n_boundary.load());
+    return p;
+  }
+
+  PavingInOut parallel_pave(const IntervalVector& x, std::shared_ptr<const SepBase> s,
+    double eps, std::size_t nb_threads, bool verbose)
+  {
+    return parallel_pave(x, *s, eps, nb_threads, verbose);
+  }
+
+  PavingInOut parallel_pave(const IntervalVector& x, const SepBase& s,
+    double eps, std::size_t nb_threads, bool verbose)
+  {
+    assert_release(eps > 0.);
+    assert_release(!x.is_empty());
+
+    auto t_start = chrono::steady_clock::now();
+
+    PavingInOut p(x);
+
+    work_stealing_process<std::shared_ptr<PavingInOut_Node>>({ p.tree() },
+      [&](const std::shared_ptr<PavingInOut_Node>& n, const auto& push)
+      {
+        if(pave_node(n, s, eps))
+        {
+          push(n->left());
+          push(n->right());
+        }
+      },
+      nb_threads);
+
+    if(verbose)
+      printf("Computation time: %.4fs\n",
+        chrono::duration<double>(chrono::steady_clock::now()-t_start).count());
+    return p;
+  }
+
+  CompactPavingOut compact_pave(const IntervalVector& x, const CtcBase<IntervalVector>& c, double eps, bool verbose)
+  {
+    assert_release(eps > 0.);
+    assert_release(!x.is_empty());
+
+    clock_t t_start = clock();
+    Index n_boundary = 0;
+
+    CompactPavingOut p(x);
+    // Same first level as for the pave() function
+    p.bisect(0);
+    p.set_box(p.left(0), 0, x);
+    p.set_box(p.right(0), 0, IntervalVector::empty(x.size()));
+
+    std::deque<CompactPavingOut::NodeIndex_> l { p.left(0) };
+    IntervalVector b(x);
+
+    while(!l.empty())
+    {
+      auto i = l.front();
+      l.pop_front();
+
+      b = p.box(i, 0);
+      c.contract(b);
+      p.set_box(i, 0, b);
+
+      if(!b.is_empty())
+      {
+        if(b.max_diam() > eps)
+        {
+          p.bisect(i);
+          l.push_back(p.left(i));
+          l.push_back(p.right(i));
+        }
+
+        else
+          n_boundary++;
+      }
+    }
+
+    if(verbose)
+      printf("Computation time: %.4fs, %ld boxes, %ld nodes\n",
+        (double)(clock()-t_start)/CLOCKS_PER_SEC, n_boundary, (Index)p.nb_nodes());
+    return p;
+  }
+
+  CompactPavingInOut compact_pave(const IntervalVector& x, const SepBase& s, double eps, bool verbose)
+  {
+    assert_release(eps > 0.);
+    assert_release(!x.is_empty());
+
+    clock_t t_start = clock();
+
+    CompactPavingInOut p(x);
+    std::deque<CompactPavingInOut::NodeIndex_> l { 0 };
+
+    while(!l.empty())
+    {
+      auto i = l.front();
+      l.pop_front();
+
+      auto xs = s.separate(p.box(i, 0));
+      auto boundary = (xs.inner & xs.outer);
+      p.set_node_boxes(i, { xs.outer, xs.inner });
+
+      if(!boundary.is_empty() && boundary.max_diam() > eps)
+      {
+        p.bisect(i);
+        l.push_back(p.left(i));
+        l.push_back(p.right(i));
+      }
+    }
+
+    if(verbose)
+      printf("Computation time: %.4fs, %ld nodes\n",
+        (double)(clock()-t_start)/CLOCKS_PER_SEC, (Index)p.nb_nodes());
+    return p;
+  }
+
   PavingInOut regular_pave(const IntervalVector& x,
     const std::function<BoolInterval(const IntervalVector&)>& test,
     double eps, bool verbose)
@@ -10,6 +10,7 @@
 #pragma once
 
 #include "codac2_Paving.h"
+#include "codac2_CompactPaving.h"
 #include "codac2_Ctc.h"
 #include "codac2_Sep.h"
 #include "codac2_AnalyticFunction.h"
@@ -26,6 +27,23 @@ namespace codac2
   PavingInOut pave(const IntervalVector& x, std::shared_ptr<const SepBase> s, double eps, bool verbose = false);
   PavingInOut pave(const IntervalVector& x, const SepBase& s, double eps, bool verbose = false);
 
+  // Parallel versions: the boxes are processed by nb_threads threads (0 for the number of
+  // hardware threads) with a work-stealing load balancing. The resulting paving is the same
+  // as the one computed by the serial pave() functions. The contractor (or separator) is
+  // called concurrently on different boxes: see the thread-safety requirements of CtcBase and SepBase.
+
+  PavingOut parallel_pave(const IntervalVector& x, std::shared_ptr<const CtcBase<IntervalVector>> c, double eps, std::size_t nb_threads = 0, bool verbose = false);
+  PavingOut parallel_pave(const IntervalVector& x, const CtcBase<IntervalVector>& c, double eps, std::size_t nb_threads = 0, bool verbose = false);
+
+  PavingInOut parallel_pave(const IntervalVector& x, std::shared_ptr<const SepBase> s, double eps, std::size_t nb_threads = 0, bool verbose = false);
+  PavingInOut parallel_pave(const IntervalVector& x, const SepBase& s, double eps, std::size_t nb_threads = 0, bool verbose = false);
+
+  // Versions building compact pavings (contiguous storage of the nodes, see CompactPaving),
+  // with the same tree structure as the one obtained from the pave() functions.
+
+  CompactPavingOut compact_pave(const IntervalVector& x, const CtcBase<IntervalVector>& c, double eps, bool verbose = false);
+  CompactPavingInOut compact_pave(const IntervalVector& x, const SepBase& s, double eps, bool verbose = false);
+
   PavingInOut regular_pave(const IntervalVector& x, const std::function<BoolInterval(const IntervalVector&)>& test, double eps, bool verbose = false);
 
   template<typename Y>
@@ -46,6 +46,14 @@ namespace codac2
     return os;
   }
 
+  /**
+   * \class SepBase
+   * \brief Base class of the separators.
+   *
+   * \note Thread safety: the method ``separate()`` is ``const`` and may be called
+   * concurrently on different boxes, for instance by ``parallel_pave()``. The same
+   * requirements as for ``CtcBase::contract()`` apply to its implementations.
+   */
   class SepBase
   {
     public:
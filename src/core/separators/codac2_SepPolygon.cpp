@@ -9,8 +9,7 @@
 
 #include <list>
 #include "codac2_SepPolygon.h"
-#include "codac2_CtcUnion.h"
-#include "codac2_CtcSegment.h"
+#include "codac2_CtcPolygon.h"
 #include "codac2_geometry.h"
 
 using namespace std;
@@ -18,22 +17,20 @@ using namespace std;
 namespace codac2
 {
   SepPolygon::SepPolygon(const Polygon& p)
+    : SepPolygon(make_shared<const IndexedPolygon>(p))
+  { }
+
+  SepPolygon::SepPolygon(const shared_ptr<const IndexedPolygon>& p)
     : SepCtcBoundary(
 
       // Contractor on the boundary
-      [p]
-      {
-        CtcUnion<IntervalVector> ctc_segments(2);
-        for(const auto& edge_i : p.edges())
-          ctc_segments |= CtcSegment(edge_i[0],edge_i[1]);
-        return ctc_segments;
-      }(),
+      CtcPolygonBoundary(p),
 
       // Tests if a point of a box is inside the polygon
       [p](const Vector& x) -> BoolInterval
       {
         assert_release(x.size() == 2);
-        return p.contains(x);
+        return p->contains(x);
       }
     )
   { }
@@ -20,5 +20,9 @@ namespace codac2
 
       SepPolygon(const Polygon& p);
       BoxPair separate(const IntervalVector& x) const;
+
+    protected:
+
+      SepPolygon(const std::shared_ptr<const IndexedPolygon>& p);
   };
 }
\ No newline at end of file
@@ -18,29 +18,141 @@ BoxPair SepWrapper<IntervalVector>::separate(const IntervalVector& x) const
   return SepCtcPair::separate(x);
 }
 
+namespace
+{
+  // Operations on boxes stored as arrays of n intervals
+
+  bool intersects(const Interval* x, const Interval* y, Index n)
+  {
+    for(Index k = 0 ; k < n ; k++)
+      if(!x[k].intersects(y[k]))
+        return false;
+    return true;
+  }
+
+  bool is_subset(const Interval* x, const Interval* y, Index n)
+  {
+    for(Index k = 0 ; k < n ; k++)
+      if(!x[k].is_subset(y[k]))
+        return false;
+    return true;
+  }
+
+  void add(Interval* h, const Interval* x, Index n)
+  {
+    if(!x[0].is_empty())
+      for(Index k = 0 ; k < n ; k++)
+        h[k] |= x[k];
+  }
+
+  // Adds the intersection of x and y to h, the two boxes being assumed to intersect
+  void add_inter(Interval* h, const Interval* x, const Interval* y, Index n)
+  {
+    for(Index k = 0 ; k < n ; k++)
+      h[k] |= x[k] & y[k];
+  }
+}
+
+SepWrapper<PavingInOut>::SepWrapper(const PavingInOut& P)
+  : Sep<SepWrapper<PavingInOut>>(P.size())
+{
+  // As in PavingNode::visit, the first level of the tree
+  // is ignored if it is redundant with the second one
+  auto root = P.tree();
+  if(!root->right() && root->left() && root->left()->boxes() == root->boxes())
+    root = root->left();
+
+  add_node(root);
+}
+
+size_t SepWrapper<PavingInOut>::add_node(const PavingInOut::Node_& n)
+{
+  const Index d = size();
+  const size_t i = _nodes.size();
+  _nodes.push_back({});
+  _summaries.resize(_summaries.size()+3*d, Interval::empty());
+
+  auto push_boxes = [&](const list<IntervalVector>& l, size_t summary)
+  {
+    for(const auto& b : l)
+      if(!b.is_empty())
+      {
+        _boxes.insert(_boxes.end(), b.data(), b.data()+d);
+        add(&_summaries[(3*i+summary)*d], b.data(), d);
+      }
+  };
+
+  // The outer complementary part and the boundary of the node are inner boxes
+  // of the separation, the inner part and the boundary are outer boxes
+  auto bound = PavingInOut::bound_value(n);
+  size_t first = _boxes.size()/d;
+  push_boxes(PavingInOut::outer_complem_value(n), 1);
+  push_boxes(bound, 1);
+  size_t mid = _boxes.size()/d;
+  push_boxes(PavingInOut::inner_value(n), 2);
+  push_boxes(bound, 2);
+  size_t last = _boxes.size()/d;
+
+  IntervalVector h = n->hull();
+  add(&_summaries[3*i*d], h.data(), d);
+
+  size_t left = n->left() ? add_node(n->left()) : 0;
+  size_t right = n->right() ? add_node(n->right()) : 0;
+  _nodes[i] = { first, mid, last, left, right };
+
+  for(size_t c : { left, right })
+    if(c)
+      for(size_t s = 0 ; s < 3 ; s++)
+        add(&_summaries[(3*i+s)*d], &_summaries[(3*c+s)*d], d);
+
+  return i;
+}
+
 BoxPair SepWrapper<PavingInOut>::separate(const IntervalVector& x) const
 {
-  assert_release(x.size() == _P.size());
+  assert_release(x.size() == size());
 
   BoxPair result {
     IntervalVector::empty(x.size()),
     IntervalVector::empty(x.size())
   };
 
-  // Inner computation
-  for(const auto &box: _P.boxes(PavingInOut::outer_complem, x))
-    result.inner |= (box & x);
+  separate(0, x.data(), result.inner.data(), result.outer.data());
+  return result;
+}
 
-  // Outer computation
-  for(const auto &box: _P.boxes(PavingInOut::inner, x))
-    result.outer |= (box & x);
+void SepWrapper<PavingInOut>::separate(size_t i, const Interval* x, Interval* inner, Interval* outer) const
+{
+  const Index d = size();
+  const Interval* h = &_summaries[3*i*d];
 
-  // The boundary belongs to both inner and outer
-  for(const auto &box: _P.boxes(PavingInOut::bound, x))
+  if(!intersects(h, x, d))
+    return;
+
+  // The boxes of the subtree are all enclosed in x
+  if(is_subset(h, x, d))
   {
-    result.inner |= (box & x);
-    result.outer |= (box & x);
+    add(inner, h+d, d);
+    add(outer, h+2*d, d);
+    return;
   }
 
-  return result;
+  // The subtree cannot enlarge the current result
+  bool enclosed = true;
+  for(Index k = 0 ; k < d && enclosed ; k++)
+  {
+    Interval hk = h[k] & x[k];
+    enclosed = hk.is_subset(inner[k]) && hk.is_subset(outer[k]);
+  }
+
+  if(enclosed)
+    return;
+
+  const Node& n = _nodes[i];
+  for(size_t j = n.first ; j < n.last ; j++)
+    if(intersects(&_boxes[j*d], x, d))
+      add_inter(j < n.mid ? inner : outer, &_boxes[j*d], x, d);
+
+  if(n.left) separate(n.left, x, inner, outer);
+  if(n.right) separate(n.right, x, inner, outer);
 }
\ No newline at end of file
@@ -61,14 +61,36 @@ namespace codac2
   {
     public:
 
-      SepWrapper(const PavingInOut& P)
-        : Sep<SepWrapper<PavingInOut>>(P.size()), _P(P)
-      { }
+      /**
+       * \brief Creates a separator from the inner and outer approximations of a set,
+       * given by a paving.
+       *
+       * The boxes of the paving are copied in contiguous arrays, together with a summary
+       * of each subtree: its hull, and the hulls of its inner and outer boxes. A separation
+       * is then computed in a single traversal of the tree, without memory allocation,
+       * the subtrees enclosed in the separated box being accounted for by their summary.
+       *
+       * \note Later modifications of the paving are not taken into account by the separator.
+       *
+       * \param P paving
+       */
+      SepWrapper(const PavingInOut& P);
 
       BoxPair separate(const IntervalVector& x) const;
 
     protected:
-    
-      const PavingInOut _P;
+
+      struct Node
+      {
+        size_t first, mid, last; // boxes of the node in _boxes: [first,mid) for the inner part, [mid,last) for the outer one
+        size_t left, right; // ranks of the children, 0 if none
+      };
+
+      size_t add_node(const PavingInOut::Node_& n);
+      void separate(size_t i, const Interval* x, Interval* inner, Interval* outer) const;
+
+      std::vector<Node> _nodes; // nodes, the root being the first one
+      std::vector<Interval> _summaries; // for each node: hulls of the subtree, of its inner boxes and of its outer boxes
+      std::vector<Interval> _boxes; // inner and outer boxes of the nodes, stored contiguously
   };
 }
\ No newline at end of file
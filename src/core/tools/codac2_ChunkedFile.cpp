@@ -0,0 +1,229 @@
+/**
+ *  codac2_ChunkedFile.cpp
+ * ----------------------------------------------------------------------------
+ *  \date       2025
+ *  \author     Simon Rohou
+ *  \copyright  Copyright 2025 Codac Team
+ *  \license    GNU Lesser General Public License (LGPL)
+ */
+
+#include <cstring>
+#include <filesystem>
+#include "codac2_ChunkedFile.h"
+
+#if !defined(_WIN32)
+  #include <fcntl.h>
+  #include <unistd.h>
+  #include <sys/mman.h>
+#endif
+
+using namespace std;
+
+namespace codac2
+{
+  namespace
+  {
+    const uint32_t CHUNKED_FILE_VERSION = 1;
+    const char CHUNKED_FILE_MAGIC[8] = { 'C','O','D','A','C','C','H','K' };
+    const char CHUNKED_FILE_CHUNK_MAGIC[8] = { 'C','H','U','N','K',0,0,0 };
+
+    static_assert(sizeof(ChunkedFileHeader) == 56 && sizeof(ChunkedFileChunkHeader) == 16,
+      "the blocks of doubles must be 8-byte aligned in the file");
+  }
+
+  ChunkedFileWriter::ChunkedFileWriter(const string& file_path, bool append)
+  {
+    if(append && filesystem::exists(file_path) && filesystem::file_size(file_path) > 0)
+    {
+      size_t end;
+
+      {
+        ChunkedFileReader r(file_path);
+        _header = r.header();
+        end = r._end;
+      }
+
+      filesystem::resize_file(file_path, end); // removing an incomplete last chunk, if any
+      _has_header = true;
+      _f.open(file_path, ios::binary | ios::app);
+    }
+
+    else
+      _f.open(file_path, ios::binary | ios::trunc);
+
+    assert_release(_f.is_open() && "unable to open the file");
+  }
+
+  void ChunkedFileWriter::write_chunk(ChunkedFileContent content, ChunkedFileValueType value_type,
+    Index rows, Index cols, size_t n, const double* t, const double* x)
+  {
+    if(n == 0)
+      return;
+
+    const uint64_t time_stride = content == ChunkedFileContent::SAMPLED_TRAJ ? 1 : 2;
+    const uint64_t value_stride = time_stride*rows*cols;
+
+    if(!_has_header)
+    {
+      memcpy(_header.magic, CHUNKED_FILE_MAGIC, 8);
+      _header.version = CHUNKED_FILE_VERSION;
+      _header.content = content;
+      _header.value_type = value_type;
+      _header.reserved = 0;
+      _header.rows = rows;
+      _header.cols = cols;
+      _header.time_stride = time_stride;
+      _header.value_stride = value_stride;
+      _f.write(reinterpret_cast<const char*>(&_header), sizeof(ChunkedFileHeader));
+      _has_header = true;
+    }
+
+    else
+      assert_release(_header.content == content && _header.value_type == value_type
+        && _header.rows == rows && _header.cols == cols
+        && "the chunk is not consistent with the content of the file");
+
+    ChunkedFileChunkHeader h;
+    memcpy(h.magic, CHUNKED_FILE_CHUNK_MAGIC, 8);
+    h.nb_records = n;
+
+    _f.write(reinterpret_cast<const char*>(&h), sizeof(ChunkedFileChunkHeader));
+    _f.write(reinterpret_cast<const char*>(t), n*time_stride*sizeof(double));
+    _f.write(reinterpret_cast<const char*>(x), n*value_stride*sizeof(double));
+    _f.flush(); // the chunk is then available for readers
+    assert_release(_f.good() && "unable to write the chunk");
+  }
+
+  ChunkedFileReader::ChunkedFileReader(const string& file_path)
+    : _file_path(file_path)
+  {
+    assert_release(filesystem::exists(file_path) && "unable to open the file");
+    refresh();
+    assert_release(_end != 0 && "invalid chunked file");
+  }
+
+  ChunkedFileReader::~ChunkedFileReader()
+  {
+    unmap();
+  }
+
+  bool ChunkedFileReader::refresh()
+  {
+    size_t size = filesystem::file_size(_file_path);
+    if(size == _size || size < sizeof(ChunkedFileHeader))
+      return false;
+
+    assert_release(size > _size && "the file has been truncated");
+    map(size);
+
+    if(_end == 0) // first mapping
+    {
+      memcpy(&_header, _data, sizeof(ChunkedFileHeader));
+      assert_release(memcmp(_header.magic, CHUNKED_FILE_MAGIC, 8) == 0 && "invalid chunked file");
+      assert_release(_header.version <= CHUNKED_FILE_VERSION && "unsupported version of chunked file");
+      _end = sizeof(ChunkedFileHeader);
+    }
+
+    // New complete chunks (the last one may be being written)
+    size_t nb_chunks = _chunks.size();
+    while(_end + sizeof(ChunkedFileChunkHeader) <= _size)
+    {
+      ChunkedFileChunkHeader h;
+      memcpy(&h, _data+_end, sizeof(ChunkedFileChunkHeader));
+      assert_release(memcmp(h.magic, CHUNKED_FILE_CHUNK_MAGIC, 8) == 0 && "corrupted chunked file");
+
+      size_t chunk_size = sizeof(ChunkedFileChunkHeader)
+        + h.nb_records*(_header.time_stride+_header.value_stride)*sizeof(double);
+      if(_end + chunk_size > _size)
+        break;
+
+      _chunks.push_back({ _end + sizeof(ChunkedFileChunkHeader), h.nb_records });
+      _end += chunk_size;
+    }
+
+    return _chunks.size() > nb_chunks;
+  }
+
+  const ChunkedFileHeader& ChunkedFileReader::header() const
+  {
+    return _header;
+  }
+
+  ChunkedFileContent ChunkedFileReader::content() const
+  {
+    return _header.content;
+  }
+
+  ChunkedFileValueType ChunkedFileReader::value_type() const
+  {
+    return _header.value_type;
+  }
+
+  size_t ChunkedFileReader::nb_chunks() const
+  {
+    return _chunks.size();
+  }
+
+  size_t ChunkedFileReader::nb_records() const
+  {
+    size_t n = 0;
+    for(const auto& c : _chunks)
+      n += c.nb_records;
+    return n;
+  }
+
+  ChunkedFileReader::Chunk ChunkedFileReader::chunk(size_t i) const
+  {
+    assert_release(i < _chunks.size());
+    const double* t = reinterpret_cast<const double*>(_data + _chunks[i].offset);
+    return { _chunks[i].nb_records, t, t + _chunks[i].nb_records*_header.time_stride };
+  }
+
+  Interval ChunkedFileReader::tdomain() const
+  {
+    if(_chunks.empty())
+      return Interval::empty();
+
+    Chunk first = chunk(0), last = chunk(_chunks.size()-1);
+    return { first.t[0], last.t[last.nb_records*_header.time_stride-1] };
+  }
+
+  void ChunkedFileReader::map(size_t size)
+  {
+    unmap();
+
+    #if defined(_WIN32)
+
+      _buffer.resize(size);
+      ifstream f(_file_path, ios::binary);
+      f.read(_buffer.data(), size);
+      assert_release(f.good() && "unable to read the file");
+      _data = _buffer.data();
+
+    #else
+
+      int fd = open(_file_path.c_str(), O_RDONLY);
+      assert_release(fd >= 0 && "unable to open the file");
+      void* data = mmap(nullptr, size, PROT_READ, MAP_SHARED, fd, 0);
+      close(fd);
+      assert_release(data != MAP_FAILED && "unable to map the file");
+      _data = static_cast<const char*>(data);
+
+    #endif
+
+    _size = size;
+  }
+
+  void ChunkedFileReader::unmap()
+  {
+    #if defined(_WIN32)
+      _buffer.clear();
+    #else
+      if(_data)
+        munmap(const_cast<char*>(_data), _size);
+    #endif
+
+    _data = nullptr;
+    _size = 0;
+  }
+}
@@ -0,0 +1,408 @@
+/**
+ *  \file codac2_ChunkedFile.h
+ * ----------------------------------------------------------------------------
+ *  \date       2025
+ *  \author     Simon Rohou
+ *  \copyright  Copyright 2025 Codac Team
+ *  \license    GNU Lesser General Public License (LGPL)
+ */
+
+#pragma once
+
+#include <string>
+#include <vector>
+#include <fstream>
+#include <cstdint>
+#include "codac2_SampledTraj.h"
+#include "codac2_SlicedTube.h"
+
+namespace codac2
+{
+  /**
+   * \enum ChunkedFileContent
+   * \brief Type of the records stored in a chunked file
+   */
+  enum class ChunkedFileContent : uint32_t
+  {
+    SAMPLED_TRAJ = 1, //!< samples \f$(t_i,\mathbf{x}_i)\f$ of a ``SampledTraj``
+    SLICED_TUBE = 2 //!< slices \f$([t_i^-,t_i^+],[\mathbf{x}_i])\f$ of a ``SlicedTube``
+  };
+
+  /**
+   * \enum ChunkedFileValueType
+   * \brief Type of the values (or of the codomains) stored in a chunked file
+   */
+  enum class ChunkedFileValueType : uint32_t
+  {
+    SCALAR = 0, //!< ``double`` or ``Interval`` values
+    VECTOR = 1, //!< ``Vector`` or ``IntervalVector`` values
+    MATRIX = 2 //!< ``Matrix`` or ``IntervalMatrix`` values
+  };
+
+  /**
+   * \brief Header of a chunked file
+   */
+  struct ChunkedFileHeader
+  {
+    char magic[8]; //!< ``CODACCHK``
+    uint32_t version; //!< version of the format
+    ChunkedFileContent content; //!< type of the records
+    ChunkedFileValueType value_type; //!< type of the values
+    uint32_t reserved; //!< unused
+    int64_t rows; //!< number of rows of the values
+    int64_t cols; //!< number of columns of the values
+    uint64_t time_stride; //!< number of doubles per record in the time blocks
+    uint64_t value_stride; //!< number of doubles per record in the value blocks
+  };
+
+  /**
+   * \brief Header of a chunk of records
+   */
+  struct ChunkedFileChunkHeader
+  {
+    char magic[8]; //!< ``CHUNK``
+    uint64_t nb_records; //!< number of records in the chunk
+  };
+
+  /**
+   * \brief Returns the type of values corresponding to ``T``
+   *
+   * \tparam T type of the values of a trajectory, or of the codomains of a tube
+   * \return type of the values
+   */
+  template<typename T>
+  constexpr ChunkedFileValueType chunked_file_value_type()
+  {
+    if constexpr(std::is_same_v<T,double> || std::is_same_v<T,Interval>)
+      return ChunkedFileValueType::SCALAR;
+    else if constexpr(std::is_same_v<T,Vector> || std::is_same_v<T,IntervalVector>)
+      return ChunkedFileValueType::VECTOR;
+    else
+      return ChunkedFileValueType::MATRIX;
+  }
+
+  /**
+   * \class ChunkedFileWriter
+   * \brief Writes trajectories or tubes in a chunked binary file.
+   *
+   * A chunked file is made of a header followed by chunks of records. Each chunk is
+   * made of a small header, a time block and a value block, with a fixed stride per record:
+   *
+   * - records of a ``SampledTraj``: time block \f$[t_0][t_1]\dots\f$, value block
+   *   \f$[\mathbf{x}_0][\mathbf{x}_1]\dots\f$, each value being made of \f$m\f$ doubles;
+   * - records of a ``SlicedTube``: time block \f$[t_0^-][t_0^+][t_1^-][t_1^+]\dots\f$,
+   *   value block \f$[\mathbf{x}_0][\mathbf{x}_1]\dots\f$, each codomain being made of
+   *   \f$m\f$ intervals stored as \f$[x^-][x^+]\f$ pairs (gates have \f$t_i^-=t_i^+\f$).
+   *
+   * The components of the values are stored in the column-major order of Eigen.
+   * Each chunk is flushed once written: a reader can then access it while new chunks
+   * are appended, for instance during a mission. The records are expected to be
+   * written in time order.
+   */
+  class ChunkedFileWriter
+  {
+    public:
+
+      /**
+       * \brief Opens a chunked file for writing
+       *
+       * \param file_path path of the file
+       * \param append if ``true`` and if the file exists, the new chunks are appended to
+       *        the existing ones (an incomplete last chunk is removed), otherwise the file is created
+       */
+      explicit ChunkedFileWriter(const std::string& file_path, bool append = false);
+
+      /**
+       * \brief Writes a chunk of records, the header of the file being written with the first chunk
+       *
+       * \param content type of the records, identical for all the chunks of the file
+       * \param value_type type of the values, identical for all the chunks of the file
+       * \param rows number of rows of the values
+       * \param cols number of columns of the values
+       * \param n number of records (nothing is written if \f$n=0\f$)
+       * \param t time block, made of \f$n\f$ times (or \f$n\f$ time intervals for tubes)
+       * \param x value block, made of \f$n\f$ values (or \f$n\f$ interval values for tubes)
+       */
+      void write_chunk(ChunkedFileContent content, ChunkedFileValueType value_type,
+        Index rows, Index cols, size_t n, const double* t, const double* x);
+
+      /**
+       * \brief Writes the samples of a trajectory as a new chunk
+       *
+       * The samples are written directly from the buffers of the trajectory.
+       *
+       * \param x trajectory
+       * \param first rank of the first sample to be written, for writing only the
+       *        samples added since a previous chunk
+       */
+      template<typename T>
+      void write(const SampledTraj<T>& x, size_t first = 0)
+      {
+        assert_release(first <= x.nb_samples());
+        auto [r,c] = x.shape();
+        write_chunk(ChunkedFileContent::SAMPLED_TRAJ, chunked_file_value_type<T>(),
+          r, c, x.nb_samples()-first, x.times().data()+first, x.values().data()+first*r*c);
+      }
+
+      /**
+       * \brief Writes the slices of a tube as a new chunk
+       *
+       * \param x tube
+       * \param first rank of the first slice (or gate) to be written, for writing only
+       *        the slices added at the end of the temporal domain since a previous chunk
+       */
+      template<typename T>
+      void write(const SlicedTube<T>& x, size_t first = 0)
+      {
+        std::vector<double> vt, vx;
+        auto [r,c] = x.shape();
+        size_t i = 0;
+
+        for(const auto& s : x)
+          if(i++ >= first)
+          {
+            vt.push_back(s.t0_tf().lb());
+            vt.push_back(s.t0_tf().ub());
+
+            if constexpr(std::is_same_v<T,Interval>)
+            {
+              vx.push_back(s.codomain().lb());
+              vx.push_back(s.codomain().ub());
+            }
+
+            else
+              for(Index k = 0 ; k < s.codomain().size() ; k++)
+              {
+                vx.push_back(s.codomain().data()[k].lb());
+                vx.push_back(s.codomain().data()[k].ub());
+              }
+          }
+
+        write_chunk(ChunkedFileContent::SLICED_TUBE, chunked_file_value_type<T>(),
+          r, c, vt.size()/2, vt.data(), vx.data());
+      }
+
+    protected:
+
+      std::ofstream _f;
+      bool _has_header = false;
+      ChunkedFileHeader _header;
+  };
+
+  /**
+   * \class ChunkedFileReader
+   * \brief Reads a chunked binary file (see ``ChunkedFileWriter``), mapped in memory.
+   *
+   * The file is mapped in memory (with ``mmap``): the records are then read lazily,
+   * only the accessed chunks being loaded by the system, and the blocks of times and
+   * values are accessed without copy. The chunks appended to the file after its
+   * opening are taken into account by ``refresh()``.
+   *
+   * \note On Windows, the file is read in memory instead of being mapped.
+   */
+  class ChunkedFileReader
+  {
+    public:
+
+      /**
+       * \struct Chunk
+       * \brief Blocks of a chunk of records, pointing to the mapped memory
+       */
+      struct Chunk
+      {
+        size_t nb_records; //!< number of records
+        const double* t; //!< time block
+        const double* x; //!< value block
+      };
+
+      /**
+       * \brief Opens and maps a chunked file
+       *
+       * \param file_path path of the file
+       */
+      explicit ChunkedFileReader(const std::string& file_path);
+
+      ChunkedFileReader(const ChunkedFileReader&) = delete;
+      ChunkedFileReader& operator=(const ChunkedFileReader&) = delete;
+
+      ~ChunkedFileReader();
+
+      /**
+       * \brief Maps again the file, for reading the chunks appended since the last mapping
+       *
+       * The pointers of the chunks previously obtained are then invalidated.
+       *
+       * \return ``true`` if new chunks are available
+       */
+      bool refresh();
+
+      /**
+       * \brief Header of the file
+       *
+       * \return header
+       */
+      const ChunkedFileHeader& header() const;
+
+      /**
+       * \brief Type of the records of the file
+       *
+       * \return type of the records
+       */
+      ChunkedFileContent content() const;
+
+      /**
+       * \brief Type of the values of the file
+       *
+       * \return type of the values
+       */
+      ChunkedFileValueType value_type() const;
+
+      /**
+       * \brief Number of complete chunks in the file
+       *
+       * \return number of chunks
+       */
+      size_t nb_chunks() const;
+
+      /**
+       * \brief Total number of records in the file
+       *
+       * \return number of records
+       */
+      size_t nb_records() const;
+
+      /**
+       * \brief Returns the blocks of the \f$i\f$-th chunk
+       *
+       * \param i rank of the chunk
+       * \return blocks of the chunk
+       */
+      Chunk chunk(size_t i) const;
+
+      /**
+       * \brief Temporal domain covered by the records of the file
+       *
+       * \return temporal domain, empty if the file contains no record
+       */
+      Interval tdomain() const;
+
+      /**
+       * \brief Builds a trajectory from the samples of the file
+       *
+       * Only the chunks intersecting \f$[t]\f$ are read.
+       *
+       * \param t time interval of the samples to be read
+       * \return trajectory made of the samples \f$(t_i,\mathbf{x}_i)\f$, \f$t_i\in[t]\f$
+       */
+      template<typename T>
+      SampledTraj<T> sampled_traj(const Interval& t = Interval()) const
+      {
+        assert_release(content() == ChunkedFileContent::SAMPLED_TRAJ
+          && value_type() == chunked_file_value_type<T>()
+          && "the file does not contain such trajectory");
+
+        const Index r = _header.rows, c = _header.cols;
+        SampledTraj<T> x;
+        x.reserve(nb_records());
+
+        for(size_t i = 0 ; i < nb_chunks() ; i++)
+        {
+          Chunk ch = chunk(i);
+          if(!t.intersects({ ch.t[0], ch.t[ch.nb_records-1] }))
+            continue;
+
+          for(size_t k = 0 ; k < ch.nb_records ; k++)
+            if(t.contains(ch.t[k]))
+            {
+              const double* xk = ch.x+k*r*c;
+              if constexpr(std::is_same_v<T,double>)
+                x.set(*xk, ch.t[k]);
+              else
+                x.set(T(Eigen::Map<const T>(xk, r, c)), ch.t[k]);
+            }
+        }
+
+        return x;
+      }
+
+      /**
+       * \brief Builds a tube from the slices of the file, on a new temporal domain
+       *
+       * \return tube made of the slices (and gates) of the file
+       */
+      template<typename T>
+      SlicedTube<T> sliced_tube() const
+      {
+        assert_release(content() == ChunkedFileContent::SLICED_TUBE
+          && value_type() == chunked_file_value_type<T>()
+          && "the file does not contain such tube");
+        assert_release(nb_records() > 0);
+
+        // Temporal domain: sampled at the lower bounds of the slices
+        auto tdomain = create_tdomain(this->tdomain());
+        for(size_t i = 0 ; i < nb_chunks() ; i++)
+        {
+          Chunk ch = chunk(i);
+          for(size_t k = 0 ; k < ch.nb_records ; k++)
+          {
+            bool gate = (ch.t[2*k] == ch.t[2*k+1]);
+            if(gate || ch.t[2*k] > tdomain->t0_tf().lb())
+              tdomain->sample(ch.t[2*k], gate);
+          }
+        }
+
+        assert_release(tdomain->nb_tslices() == nb_records()
+          && "the slices of the file do not form a partition of the temporal domain");
+
+        const Index r = _header.rows, c = _header.cols;
+        SlicedTube<T> x(tdomain, [r,c]() {
+          if constexpr(std::is_same_v<T,Interval>)
+            return Interval();
+          else if constexpr(std::is_same_v<T,IntervalVector>)
+            return IntervalVector(r);
+          else
+            return IntervalMatrix(r,c);
+        }());
+
+        Slice<T>* s = x.first_slice().get();
+        for(size_t i = 0 ; i < nb_chunks() ; i++)
+        {
+          Chunk ch = chunk(i);
+          for(size_t k = 0 ; k < ch.nb_records ; k++, s = s->next_slice_ptr())
+          {
+            const double* xk = ch.x+2*k*r*c;
+            T y(s->codomain());
+            if constexpr(std::is_same_v<T,Interval>)
+              y = Interval(xk[0],xk[1]);
+            else
+              for(Index l = 0 ; l < r*c ; l++)
+                y.data()[l] = Interval(xk[2*l],xk[2*l+1]);
+            s->set(y, false);
+          }
+        }
+
+        return x;
+      }
+
+    protected:
+
+      friend class ChunkedFileWriter;
+
+      void map(size_t size);
+      void unmap();
+
+      struct ChunkInfo
+      {
+        size_t offset; // offset of the time block
+        size_t nb_records;
+      };
+
+      const std::string _file_path;
+      const char* _data = nullptr;
+      size_t _size = 0;
+      std::vector<char> _buffer; // used instead of a mapping on Windows
+      ChunkedFileHeader _header;
+      std::vector<ChunkInfo> _chunks;
+      size_t _end = 0; // offset following the last complete chunk
+  };
+}
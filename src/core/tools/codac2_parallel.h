@@ -0,0 +1,248 @@
+/**
+ *  \file codac2_parallel.h
+ * ----------------------------------------------------------------------------
+ *  \date       2025
+ *  \author     Simon Rohou
+ *  \copyright  Copyright 2025 Codac Team
+ *  \license    GNU Lesser General Public License (LGPL)
+ */
+
+#pragma once
+
+#include <list>
+#include <deque>
+#include <vector>
+#include <mutex>
+#include <thread>
+#include <atomic>
+#include <exception>
+#include <tuple>
+#include "codac2_Interval.h"
+
+namespace codac2
+{
+  /**
+   * \brief Returns the number of threads used by default by the parallel algorithms
+   * of the library, that is the number of concurrent threads supported by the hardware.
+   *
+   * \return number of threads (at least 1)
+   */
+  inline std::size_t default_nb_threads()
+  {
+    return std::max(1u, std::thread::hardware_concurrency());
+  }
+
+  /**
+   * \class WorkStealingQueues
+   * \brief Set of double-ended task queues, one per worker thread.
+   *
+   * Each worker pushes and pops tasks at the back of its own queue (depth-first
+   * order, good data locality), and steals tasks from the front of the other queues
+   * when its own queue is empty (largest remaining sub-problems first).
+   */
+  template<typename T>
+  class WorkStealingQueues
+  {
+    public:
+
+      /**
+       * \brief Creates \p n empty queues
+       *
+       * \param n number of worker threads
+       */
+      explicit WorkStealingQueues(std::size_t n)
+        : _q(n)
+      { }
+
+      /**
+       * \brief Adds a task at the back of the queue of the worker \p i
+       *
+       * \param i index of the worker
+       * \param t task to be added
+       */
+      void push(std::size_t i, T&& t)
+      {
+        std::lock_guard<std::mutex> lock(_q[i].m);
+        _q[i].d.push_back(std::move(t));
+      }
+
+      /**
+       * \brief Gets a task for the worker \p i, from its own queue if
+       * not empty, or stolen from the queue of another worker otherwise
+       *
+       * \param i index of the worker
+       * \param t retrieved task, if any
+       * \return ``true`` if a task has been retrieved
+       */
+      bool pop(std::size_t i, T& t)
+      {
+        {
+          std::lock_guard<std::mutex> lock(_q[i].m);
+          if(!_q[i].d.empty())
+          {
+            t = std::move(_q[i].d.back());
+            _q[i].d.pop_back();
+            return true;
+          }
+        }
+
+        for(std::size_t k = 1 ; k < _q.size() ; k++)
+        {
+          auto& qk = _q[(i+k) % _q.size()];
+          std::lock_guard<std::mutex> lock(qk.m);
+          if(!qk.d.empty())
+          {
+            t = std::move(qk.d.front());
+            qk.d.pop_front();
+            return true;
+          }
+        }
+
+        return false;
+      }
+
+    protected:
+
+      struct Queue
+      {
+        std::mutex m;
+        std::deque<T> d;
+      };
+
+      std::vector<Queue> _q;
+  };
+
+  /**
+   * \brief Processes a dynamically growing set of independent tasks on several threads,
+   * with a work-stealing load balancing.
+   *
+   * The function ``process(t,push)`` is called once for each task ``t``, and possibly
+   * creates new tasks by calling ``push(t_)``. The function returns when all the
+   * tasks (initial or created) have been processed. If ``process`` throws an exception,
+   * the remaining tasks are dropped and the first exception is rethrown in the calling thread.
+   *
+   * \note Each task is processed by one thread only, but ``process`` is called
+   * concurrently on different tasks: it must not modify data shared between tasks
+   * without synchronization.
+   *
+   * \param tasks initial tasks
+   * \param process function processing one task
+   * \param nb_threads number of threads (the calling thread is one of them),
+   *        ``0`` for ``default_nb_threads()``
+   */
+  template<typename T, typename F>
+  void work_stealing_process(std::list<T> tasks, const F& process, std::size_t nb_threads = 0)
+  {
+    if(nb_threads == 0)
+      nb_threads = default_nb_threads();
+
+    WorkStealingQueues<T> q(nb_threads);
+    std::atomic<std::size_t> nb_pending_tasks = tasks.size();
+    std::atomic<bool> abort = false;
+    std::exception_ptr error = nullptr;
+    std::mutex error_mutex;
+
+    std::size_t k = 0;
+    for(auto& t : tasks)
+      q.push((k++) % nb_threads, std::move(t));
+
+    auto worker = [&](std::size_t i)
+    {
+      // The rounding mode is a per-thread state: Gaol expects
+      // it to be set upward before any interval computation.
+      gaol::round_upward();
+
+      T t;
+      while(!abort && nb_pending_tasks > 0)
+      {
+        if(!q.pop(i, t))
+        {
+          std::this_thread::yield();
+          continue;
+        }
+
+        try
+        {
+          process(t, [&](T&& t_)
+            {
+              nb_pending_tasks++;
+              q.push(i, std::move(t_));
+            });
+        }
+
+        catch(...)
+        {
+          std::lock_guard<std::mutex> lock(error_mutex);
+          if(!error)
+            error = std::current_exception();
+          abort = true;
+        }
+
+        nb_pending_tasks--;
+      }
+    };
+
+    std::vector<std::thread> threads;
+    for(std::size_t i = 1 ; i < nb_threads ; i++)
+      threads.emplace_back(worker, i);
+    worker(0);
+
+    for(auto& th : threads)
+      th.join();
+
+    if(error)
+      std::rethrow_exception(error);
+  }
+
+  /**
+   * \brief Processes the slices of tubes sharing the same temporal domain on several threads.
+   *
+   * The slices are split into chunks of adjacent slices, processed with ``work_stealing_process()``.
+   * The function ``process(s...)`` is called once for each set of slices ``s...`` defined on the
+   * same tslice, the slices being obtained from the links between adjacent slices.
+   *
+   * \note The function ``process`` is called concurrently on different slices: it must only
+   * modify the slices it is called with.
+   *
+   * \param process function processing the slices of one tslice
+   * \param nb_threads number of threads, ``0`` for ``default_nb_threads()``
+   * \param s first slices of the tubes
+   */
+  template<typename F, typename... S>
+  void parallel_slices_process(const F& process, std::size_t nb_threads, S*... s)
+  {
+    if(nb_threads == 0)
+      nb_threads = default_nb_threads();
+
+    auto next = [](std::tuple<S*...>& sk)
+    {
+      std::apply([](auto&... si) { ((si = si->next_slice_ptr()), ...); }, sk);
+    };
+
+    std::size_t n = 0;
+    for(auto si = std::get<0>(std::make_tuple(s...)) ; si ; si = si->next_slice_ptr())
+      n++;
+
+    // Several chunks per thread, for the load balancing
+    std::size_t nb_chunks = std::min(n, 4*nb_threads);
+    std::list<std::pair<std::tuple<S*...>,std::size_t>> chunks;
+
+    auto sk = std::make_tuple(s...);
+    for(std::size_t k = 0 ; k < nb_chunks ; k++)
+    {
+      std::size_t m = (k+1)*n/nb_chunks - k*n/nb_chunks;
+      chunks.push_back({ sk, m });
+      for(std::size_t i = 0 ; i < m ; i++)
+        next(sk);
+    }
+
+    work_stealing_process(std::move(chunks),
+      [&process,&next](std::pair<std::tuple<S*...>,std::size_t>& c, const auto&)
+      {
+        auto& [sk,m] = c;
+        for(std::size_t i = 0 ; i < m ; i++, next(sk))
+          std::apply(process, sk);
+      },
+      nb_threads);
+  }
+}
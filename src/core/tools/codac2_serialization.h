@@ -170,7 +170,7 @@ namespace codac2
       for(const auto& [ti, xi] : x)
       {
         serialize(f, ti);
-        serialize(f, xi);
+        serialize(f, T(xi)); // xi is a reference to the buffer of values
       }
     }
 
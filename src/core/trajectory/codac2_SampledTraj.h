@@ -10,29 +10,213 @@
 #pragma once
 
 #include <map>
+#include <list>
+#include <mutex>
+#include <atomic>
+#include <iterator>
+#include <compare>
+#include <stdexcept>
+#include <vector>
+#include <utility>
+#include <optional>
 #include "codac2_math.h"
 #include "codac2_TrajBase.h"
+#include "codac2_TrajHullIndex.h"
 #include "codac2_analytic_variables.h"
 #include "codac2_template_tools.h"
 #include "codac2_Traj_operator.h"
 
 namespace codac2
 {
+  /**
+   * \class SampledTraj
+   * \brief Trajectory defined by a set of values sampled over time, linearly
+   * interpolated between two samples.
+   *
+   * The samples are stored in a columnar way: the times in a sorted array, and the
+   * values in a single contiguous buffer, sample after sample (each value being made
+   * of \f$m\f$ components stored in the column-major order of Eigen, \f$m=1\f$ for
+   * scalar trajectories). The addition of a sample after the last one is then done
+   * in amortized constant time, and the evaluations at \f$t\f$ are obtained by
+   * binary search.
+   *
+   * The samples can be iterated as in a ``std::map<double,T>``: the iterators provide
+   * pairs ``(first,second)`` in which ``second`` is a reference to the value
+   * (a ``double&`` or an ``Eigen::Map`` over the buffer).
+   */
   template<typename T>
-  class SampledTraj : public TrajBase<T>, public std::map<double,T>
+  class SampledTraj : public TrajBase<T>
   {
     public:
 
       using Type = typename ExprType<T>::Type;
 
+      /**
+       * \brief Reference to the value of a sample in the buffer of values
+       */
+      using ValueRef = std::conditional_t<std::is_same_v<T,double>,double&,Eigen::Map<T>>;
+
+      /**
+       * \brief Constant reference to the value of a sample in the buffer of values
+       */
+      using ConstValueRef = std::conditional_t<std::is_same_v<T,double>,const double&,Eigen::Map<const T>>;
+
+      /**
+       * \brief Sample ``(first,second)`` obtained by the dereference of an iterator
+       */
+      template<typename R>
+      struct Sample
+      {
+        const double& first;
+        R second;
+
+        operator std::pair<double,T>() const
+        {
+          return { first, T(second) };
+        }
+      };
+
+      template<bool Const>
+      class SampleIterator
+      {
+        public:
+
+          using Traj = std::conditional_t<Const,const SampledTraj<T>,SampledTraj<T>>;
+          using iterator_category = std::random_access_iterator_tag;
+          using difference_type = std::ptrdiff_t;
+          using value_type = std::pair<double,T>;
+          using reference = Sample<std::conditional_t<Const,ConstValueRef,ValueRef>>;
+
+          struct pointer
+          {
+            reference s;
+
+            reference* operator->()
+            {
+              return &s;
+            }
+          };
+
+          SampleIterator() = default;
+
+          SampleIterator(Traj* x, size_t i)
+            : _x(x), _i(i)
+          { }
+
+          operator SampleIterator<true>() const
+            requires (!Const)
+          {
+            return { _x, _i };
+          }
+
+          reference operator*() const
+          {
+            return { _x->_t[_i], _x->value(_i) };
+          }
+
+          pointer operator->() const
+          {
+            return { **this };
+          }
+
+          reference operator[](difference_type k) const
+          {
+            return *(*this+k);
+          }
+
+          SampleIterator& operator++() { _i++; return *this; }
+          SampleIterator& operator--() { _i--; return *this; }
+          SampleIterator operator++(int) { auto it = *this; _i++; return it; }
+          SampleIterator operator--(int) { auto it = *this; _i--; return it; }
+          SampleIterator& operator+=(difference_type k) { _i += k; return *this; }
+          SampleIterator& operator-=(difference_type k) { _i -= k; return *this; }
+
+          friend SampleIterator operator+(SampleIterator it, difference_type k) { return it += k; }
+          friend SampleIterator operator+(difference_type k, SampleIterator it) { return it += k; }
+          friend SampleIterator operator-(SampleIterator it, difference_type k) { return it -= k; }
+
+          friend difference_type operator-(const SampleIterator& it1, const SampleIterator& it2)
+          {
+            return (difference_type)it1._i - (difference_type)it2._i;
+          }
+
+          friend bool operator==(const SampleIterator& it1, const SampleIterator& it2)
+          {
+            return it1._i == it2._i;
+          }
+
+          friend auto operator<=>(const SampleIterator& it1, const SampleIterator& it2)
+          {
+            return it1._i <=> it2._i;
+          }
+
+          /**
+           * \brief Rank of the pointed sample
+           *
+           * \return rank of the sample in the trajectory
+           */
+          size_t index() const
+          {
+            return _i;
+          }
+
+        protected:
+
+          Traj* _x = nullptr;
+          size_t _i = 0;
+      };
+
+      using iterator = SampleIterator<false>;
+      using const_iterator = SampleIterator<true>;
+      using reverse_iterator = std::reverse_iterator<iterator>;
+      using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
       SampledTraj()
-        : TrajBase<T>(), std::map<double,T>()
+        : TrajBase<T>()
       { }
 
+      // The possible range-hull index is not copied: it is built again by the first query
+      // on the copy (see enable_hull_index())
+
+      SampledTraj(const SampledTraj<T>& x)
+        : TrajBase<T>(x), _t(x._t), _x(x._x), _rows(x._rows), _cols(x._cols),
+          _hull_index_enabled(x._hull_index_enabled)
+      { }
+
+      SampledTraj(SampledTraj<T>&& x) noexcept
+        : TrajBase<T>(x), _t(std::move(x._t)), _x(std::move(x._x)), _rows(x._rows), _cols(x._cols),
+          _hull_index_enabled(x._hull_index_enabled), _hull_index(std::move(x._hull_index)),
+          _hull_index_valid(x._hull_index_valid.load())
+      { }
+
+      SampledTraj<T>& operator=(const SampledTraj<T>& x)
+      {
+        if(this != &x)
+        {
+          _t = x._t; _x = x._x;
+          _rows = x._rows; _cols = x._cols;
+          _hull_index_enabled = x._hull_index_enabled;
+          _hull_index.reset();
+          _hull_index_valid = false;
+        }
+        return *this;
+      }
+
+      SampledTraj<T>& operator=(SampledTraj<T>&& x) noexcept
+      {
+        _t = std::move(x._t); _x = std::move(x._x);
+        _rows = x._rows; _cols = x._cols;
+        _hull_index_enabled = x._hull_index_enabled;
+        _hull_index = std::move(x._hull_index);
+        _hull_index_valid = x._hull_index_valid.load();
+        return *this;
+      }
+
       SampledTraj(const std::list<double>& l_t, const std::list<T>& l_x)
         : SampledTraj()
       {
         assert_release(l_t.size() == l_x.size());
+        reserve(l_t.size());
         auto it_t = l_t.begin(); auto it_x = l_x.begin();
         while(it_t != l_t.end())
         {
@@ -42,10 +226,14 @@ namespace codac2
       }
 
       SampledTraj(const std::map<double,T>& m)
-        : TrajBase<T>(), std::map<double,T>(m)
-      { }
+        : SampledTraj()
+      {
+        reserve(m.size());
+        for(const auto& [ti,xi] : m)
+          this->set(xi, ti);
+      }
 
-      // size is not the std::map<double,T>::size() !
+      // size is not the number of samples!
       virtual Index size() const
       {
         if constexpr(std::is_same_v<Type,ScalarType>)
@@ -56,7 +244,7 @@ namespace codac2
           if(this->empty())
             return 0;
           else
-            return this->begin()->second.size();
+            return _rows*_cols;
         }
       }
 
@@ -69,18 +257,115 @@ namespace codac2
           if(this->empty())
             return {0,0};
           else
-            return {this->begin()->second.rows(),this->begin()->second.cols()};
+            return {_rows,_cols};
         }
       }
 
       size_t nb_samples() const
       {
-        return std::map<double,T>::size();
+        return _t.size();
+      }
+
+      bool empty() const
+      {
+        return _t.empty();
       }
 
       virtual bool is_empty() const
       {
-        return std::map<double,T>::empty();
+        return empty();
+      }
+
+      void clear()
+      {
+        _t.clear();
+        _x.clear();
+        invalidate_hull_index();
+      }
+
+      /**
+       * \brief Allocates the memory for \f$n\f$ samples, for further additions
+       *
+       * \param n expected number of samples
+       */
+      void reserve(size_t n)
+      {
+        _t.reserve(n);
+        if(std::is_same_v<T,double> || !this->empty()) // otherwise, the size of the values is not known yet
+          _x.reserve(n*dim());
+      }
+
+      /**
+       * \brief Sampled times, in increasing order
+       *
+       * \return times of the samples
+       */
+      const std::vector<double>& times() const
+      {
+        return _t;
+      }
+
+      /**
+       * \brief Sampled values, stored contiguously in the order of the samples
+       *
+       * \return buffer of the values, made of ``nb_samples()*size()`` components
+       */
+      const std::vector<double>& values() const
+      {
+        return _x;
+      }
+
+      /**
+       * \brief Pointer to the buffer of the values, for direct modifications
+       *
+       * \note The possible range-hull index is then outdated, see ``enable_hull_index()``.
+       *
+       * \return pointer to the first component of the first value
+       */
+      double* data()
+      {
+        invalidate_hull_index();
+        return _x.data();
+      }
+
+      const_iterator begin() const { return { this, 0 }; }
+      const_iterator end() const { return { this, nb_samples() }; }
+      const_iterator cbegin() const { return begin(); }
+      const_iterator cend() const { return end(); }
+      const_reverse_iterator rbegin() const { return const_reverse_iterator(end()); }
+      const_reverse_iterator rend() const { return const_reverse_iterator(begin()); }
+
+      // The values may be modified through non-const iterators,
+      // the possible range-hull index is then outdated
+      iterator begin() { invalidate_hull_index(); return { this, 0 }; }
+      iterator end() { invalidate_hull_index(); return { this, nb_samples() }; }
+      reverse_iterator rbegin() { return reverse_iterator(end()); }
+      reverse_iterator rend() { return reverse_iterator(begin()); }
+
+      const_iterator lower_bound(double t) const { return { this, lower_index(t) }; }
+      const_iterator upper_bound(double t) const { return { this, upper_index(t) }; }
+      iterator lower_bound(double t) { invalidate_hull_index(); return { this, lower_index(t) }; }
+      iterator upper_bound(double t) { invalidate_hull_index(); return { this, upper_index(t) }; }
+
+      ConstValueRef at(double t) const
+      {
+        return value(index_at(t));
+      }
+
+      ValueRef at(double t)
+      {
+        size_t i = index_at(t);
+        invalidate_hull_index();
+        return value(i);
+      }
+
+      iterator erase(const_iterator it)
+      {
+        size_t i = it.index();
+        _t.erase(_t.begin()+i);
+        _x.erase(_x.begin()+i*dim(), _x.begin()+(i+1)*dim());
+        invalidate_hull_index();
+        return { this, i };
       }
 
       virtual Interval tdomain() const
@@ -88,7 +373,7 @@ namespace codac2
         if(this->empty())
           return Interval::empty();
         else
-          return { this->begin()->first, this->rbegin()->first };
+          return { _t.front(), _t.back() };
       }
 
       virtual void truncate_tdomain(const Interval& new_tdomain)
@@ -99,17 +384,15 @@ namespace codac2
         T y_lb = (*this)(new_tdomain.lb());
         T y_ub = (*this)(new_tdomain.ub());
 
-        auto it = this->begin();
-        while(it != this->end())
-        {
-          if(!new_tdomain.contains(it->first))
-            it = this->erase(it);
-          else
-            ++it;
-        }
+        size_t i = lower_index(new_tdomain.lb()), j = upper_index(new_tdomain.ub());
+        _t.erase(_t.begin()+j, _t.end());
+        _t.erase(_t.begin(), _t.begin()+i);
+        _x.erase(_x.begin()+j*dim(), _x.end());
+        _x.erase(_x.begin(), _x.begin()+i*dim());
+        invalidate_hull_index();
 
-        this->set(y_lb, new_tdomain.lb()); // clean truncation
-        this->set(y_ub, new_tdomain.ub());
+        set(y_lb, new_tdomain.lb()); // clean truncation
+        set(y_ub, new_tdomain.ub());
       }
 
       virtual typename Wrapper<T>::Domain codomain() const
@@ -124,10 +407,10 @@ namespace codac2
             return IntervalMatrix::empty(0,0);
         }
 
-        typename Wrapper<T>::Domain hull(this->begin()->second);
-        for(const auto& [t,v] : *this)
-          hull |= v;
-        return hull;
+        if(const TrajHullIndex<T>* h = hull_index())
+          return h->hull();
+
+        return hull_of_samples(0, nb_samples());
       }
 
       virtual T operator()(double t) const
@@ -135,41 +418,157 @@ namespace codac2
         if(!this->tdomain().contains(t))
           return this->nan_value();
 
-        auto it_lower = this->lower_bound(t);
-        if(it_lower->first == t)
-          return it_lower->second;
-
-        auto it_upper = it_lower;
-        it_lower--;
+        size_t i = lower_index(t);
+        if(_t[i] == t)
+          return T(value(i));
 
         // Linear interpolation
-        return it_lower->second +
-               (t - it_lower->first) * (it_upper->second - it_lower->second) /
-               (it_upper->first - it_lower->first);
+        return value(i-1) +
+               (t - _t[i-1]) * (value(i) - value(i-1)) /
+               (_t[i] - _t[i-1]);
       }
 
       virtual typename Wrapper<T>::Domain operator()(const Interval& t) const
       {
         // We obtain the output dimension by an evalution...
-        typename Wrapper<T>::Domain hull(this->begin()->second);
+        typename Wrapper<T>::Domain hull(T(value(0)));
 
         if(!this->tdomain().is_superset(t))
           return hull.init(Interval(-oo,oo));
 
         else
         {
+          size_t i = lower_index(t.lb()), j = upper_index(t.ub());
           hull = (*this)(t.lb());
-          for(auto it = this->lower_bound(t.lb()) ; it != this->upper_bound(t.ub()) ; it++)
-            hull |= it->second;
+          if(const TrajHullIndex<T>* h = hull_index())
+            hull |= h->hull(i,j);
+          else
+            hull |= hull_of_samples(i,j);
           hull |= (*this)(t.ub());
           return hull;
         }
       }
 
+      // Inversion: hull of the times of [t] at which the values, linearly interpolated
+      // between the samples, belong to [y]. Only the first and the last segments reaching [y]
+      // are computed, found in O(log n) with the range-hull index if enabled (see
+      // enable_hull_index()), or by a linear scan otherwise. The trajectory being only
+      // defined over its tdomain, the inversion is restricted to [t] inter tdomain.
+
+      Interval invert(const typename Wrapper<T>::Domain& y, const Interval& t_ = Interval()) const
+      {
+        if(t_.is_empty() || y.is_empty() || is_empty())
+          return Interval::empty();
+
+        assert_release(y.size() == this->size());
+        const Interval t = t_ & this->tdomain();
+        if(t.is_empty())
+          return t;
+
+        const size_t n = nb_samples();
+
+        if(n == 1)
+          return invert_segment(0, y, t);
+
+        // Segments k overlapping [t], joining the samples k and k+1
+        const size_t i = std::max<size_t>(lower_index(t.lb()), 1) - 1;
+        const size_t j = std::min(upper_index(t.ub()), n-1);
+
+        Interval inv = Interval::empty();
+        for(size_t k = first_segment(i, j, y) ; k < n ; k = first_segment(k+1, j, y))
+          if(!(inv = invert_segment(k, y, t)).is_empty())
+            break;
+
+        if(!inv.is_empty())
+          for(size_t k = last_segment(i, j, y) ; k < n ; k = last_segment(i, k, y))
+          {
+            Interval inv_k = invert_segment(k, y, t);
+            if(!inv_k.is_empty())
+            {
+              inv |= inv_k;
+              break;
+            }
+          }
+
+        return inv;
+      }
+
       void set(const T& x, double t)
       {
         assert(this->empty() || size_of(x) == this->size());
-        std::map<double,T>::operator[](t) = x;
+
+        if constexpr(!std::is_same_v<T,double>)
+          if(this->empty())
+          {
+            _rows = x.rows();
+            _cols = x.cols();
+            _x.reserve(_t.capacity()*dim());
+          }
+
+        const size_t n = nb_samples();
+        const size_t i = (n == 0 || t > _t.back()) ? n : lower_index(t);
+        const bool new_sample = (i == n || _t[i] != t);
+
+        if(new_sample)
+          _t.insert(_t.begin()+i, t);
+
+        if constexpr(std::is_same_v<T,double>)
+        {
+          if(new_sample)
+            _x.insert(_x.begin()+i, x);
+          else
+            _x[i] = x;
+        }
+
+        else
+        {
+          if(new_sample)
+            _x.insert(_x.begin()+i*dim(), x.data(), x.data()+dim());
+          else
+            std::copy(x.data(), x.data()+dim(), _x.begin()+i*dim());
+        }
+
+        if(has_hull_index())
+        {
+          if(n == 0 || (new_sample && i != n))
+            invalidate_hull_index(); // built again by the next query
+          else if(new_sample)
+            _hull_index->push_back(_x.data()+i*dim());
+          else
+            _hull_index->update(i, _x.data()+i*dim());
+        }
+      }
+
+      // Range-hull index: when enabled, the hull of the values over a time interval
+      // (see operator()(const Interval&) and codomain()) is computed in O(log n) instead
+      // of O(n). The index is updated by set() in O(log n) when a value is modified or
+      // added after the last sample. It is outdated by other insertions, or when the values
+      // may be modified through non-const iterators or data(): it is then built again in
+      // O(n) by the next query (or by update_hull_index()).
+
+      void enable_hull_index(bool enable = true)
+      {
+        _hull_index_enabled = enable;
+
+        if(!enable)
+        {
+          _hull_index.reset();
+          _hull_index_valid = false;
+        }
+
+        else
+          update_hull_index();
+      }
+
+      // True if the index is enabled and up to date
+      bool has_hull_index() const
+      {
+        return _hull_index_enabled && _hull_index_valid.load(std::memory_order_acquire);
+      }
+
+      void update_hull_index()
+      {
+        hull_index();
       }
 
       virtual SampledTraj<T> sampled(double dt) const
@@ -186,9 +585,9 @@ namespace codac2
 
         if(keep_original_values)
         {
-          // Appending values from the initial map:
+          // Appending values from the initial samples:
           for(const auto& [ti,xi] : *this)
-            straj.set(xi, ti);
+            straj.set(T(xi), ti);
         }
         
         return straj;
@@ -206,32 +605,28 @@ namespace codac2
         SampledTraj<T> straj = TrajBase<T>::sampled_as(x);
         if(keep_original_values)
           for(const auto& [ti,xi] : *this)
-            straj.set(xi, ti);
+            straj.set(T(xi), ti);
         return straj;
       }
 
       SampledTraj<T>& shift_tdomain(double shift)
       {
-        std::map<double,T> save = *this;
-        this->clear();
-        for(const auto& [ti,xi] : save)
-          this->std::map<double,T>::operator[](ti+shift) = xi;
+        // The order of the samples is unchanged, as well as the range-hull index
+        for(auto& ti : _t)
+          ti += shift;
         return *this;
       }
 
       SampledTraj<T>& stretch_tdomain(const Interval& tdomain)
       {
         Interval a = this->tdomain(), b = tdomain;
-        std::map<double,T> save = *this;
-        this->clear();
-        for(const auto& [ti,xi] : save)
-            this->std::map<double,T>::operator[]([&]() {
+        for(auto& ti : _t)
+          ti = [&]() {
               if(ti == a.ub())
                 return b.ub(); // due to floating point possible error
               else
                 return ((ti-a.lb())*b.diam()/a.diam())+b.lb();
-            }()
-          ) = xi;
+            }();
         assert(this->tdomain() == tdomain);
         return *this;
       }
@@ -241,14 +636,12 @@ namespace codac2
       SampledTraj<double> operator[](Index i) const
       {
         assert_release(i >= 0 && i < size());
-        std::map<double,double> m;
-        for(const auto& [t,y] : *this)
-        {
-          assert(i < y.size());
-          m[t] = y[i];
-        }
-
-        return { m };
+        SampledTraj<double> y;
+        y._t = _t;
+        y._x.resize(nb_samples());
+        for(size_t k = 0 ; k < nb_samples() ; k++)
+          y._x[k] = _x[k*dim()+i];
+        return y;
       }
 
       template<typename T_=T>
@@ -256,14 +649,13 @@ namespace codac2
       SampledTraj<Vector> subvector(Index i, Index j) const
       {
         assert_release(i >= 0 && i <= j && j < size());
-        std::map<double,Vector> m;
-        for(const auto& [t,y] : *this)
-        {
-          assert(j < y.size());
-          m[t] = y.subvector(i,j);
-        }
-
-        return { m };
+        SampledTraj<Vector> y;
+        y._t = _t;
+        y._rows = j-i+1;
+        y._x.resize(nb_samples()*y.dim());
+        for(size_t k = 0 ; k < nb_samples() ; k++)
+          std::copy(_x.begin()+k*dim()+i, _x.begin()+k*dim()+j+1, y._x.begin()+k*y.dim());
+        return y;
       }
 
       AnalyticFunction<Type> as_function() const
@@ -283,15 +675,16 @@ namespace codac2
           if constexpr(std::is_same_v<T,double>)
             return 0.;
           else
-            return T(this->begin()->second).init(0.);
+            return T(value(0)).init(0.);
         }();
         SampledTraj<T> p;
-        p.set(s, this->begin()->first);
+        p.reserve(nb_samples());
+        p.set(s, _t[0]);
 
-        for(auto it = std::next(this->begin()) ; it != this->end() ; it++)
+        for(size_t i = 1 ; i < nb_samples() ; i++)
         {
-          s += (prev(it)->second + it->second) * (it->first - prev(it)->first) / 2.;
-          p.set(s, it->first);
+          s += (value(i-1) + value(i)) * (_t[i] - _t[i-1]) / 2.;
+          p.set(s, _t[i]);
         }
 
         return p;
@@ -301,15 +694,13 @@ namespace codac2
       {
         SampledTraj<T> d;
         assert_release(this->nb_samples() >= 3);
-
-        auto it1 = this->begin();
-        auto it2 = std::next(it1);
+        d.reserve(nb_samples());
+        const size_t n = nb_samples();
 
         // First value (forward)
         {
-          auto it3 = std::next(it2);
-          double t1 = it1->first, t2 = it2->first, t3 = it3->first;
-          const T& x1 = it1->second; const T& x2 = it2->second; const T& x3 = it3->second;
+          double t1 = _t[0], t2 = _t[1], t3 = _t[2];
+          ConstValueRef x1 = value(0); ConstValueRef x2 = value(1); ConstValueRef x3 = value(2);
           double dt1 = t2-t1, dt2 = t3-t2;
 
           // Derivative at t1
@@ -318,35 +709,25 @@ namespace codac2
         }
 
         // Intermediate values
+        for(size_t i = 1 ; i+1 < n ; i++)
         {
-          auto it_prev = this->begin();
-          auto it = std::next(it_prev);
-          auto it_next = std::next(it);
+          double t_prev = _t[i-1];
+          double t = _t[i];
+          double t_next = _t[i+1];
 
-          for(; it_next != this->end(); ++it_prev, ++it, ++it_next)
-          {
-            double t_prev = it_prev->first;
-            double t = it->first;
-            double t_next = it_next->first;
-
-            const T& x_prev = it_prev->second;
-            const T& x = it->second;
-            const T& x_next = it_next->second;
-            double dt_prev = t-t_prev, dt_next = t_next-t;
+          ConstValueRef x_prev = value(i-1);
+          ConstValueRef x = value(i);
+          ConstValueRef x_next = value(i+1);
+          double dt_prev = t-t_prev, dt_next = t_next-t;
 
-            T num = std::pow(dt_prev,2)*(x_next-x) / dt_next + std::pow(dt_next,2)*(x-x_prev) / dt_prev;
-            d.set(2*num/std::pow(dt_prev+dt_next,2), t);
-          }
+          T num = std::pow(dt_prev,2)*(x_next-x) / dt_next + std::pow(dt_next,2)*(x-x_prev) / dt_prev;
+          d.set(2*num/std::pow(dt_prev+dt_next,2), t);
         }
 
         // Last value (backward)
         {
-          auto it3 = std::prev(this->end());
-          auto it2b = std::prev(it3);
-          auto it1b = std::prev(it2b);
-
-          double t1 = it1b->first, t2 = it2b->first, t3 = it3->first;
-          const T& x1 = it1b->second; const T& x2 = it2b->second; const T& x3 = it3->second;
+          double t1 = _t[n-3], t2 = _t[n-2], t3 = _t[n-1];
+          ConstValueRef x1 = value(n-3); ConstValueRef x2 = value(n-2); ConstValueRef x3 = value(n-1);
           double dt1 = t2-t1, dt2 = t3-t2;
 
           // Derivative at t3 (t last)
@@ -362,21 +743,20 @@ namespace codac2
         if(this->empty())
           return this->nan_value();
 
-        auto it = this->begin();
-        double t_prev = it->first;
-        T x_prev = it->second;
+        double t_prev = _t[0];
+        T x_prev = T(value(0));
 
         T sum = x_prev;
         double total_time = 0.;
 
-        for(++it; it != this->end(); ++it)
+        for(size_t i = 1 ; i < nb_samples() ; i++)
         {
-          double dt = it->first - t_prev;
-          sum += (x_prev + it->second) * 0.5 * dt;
+          double dt = _t[i] - t_prev;
+          sum += (x_prev + value(i)) * 0.5 * dt;
           total_time += dt;
 
-          t_prev = it->first;
-          x_prev = it->second;
+          t_prev = _t[i];
+          x_prev = value(i);
         }
 
         return sum / total_time;
@@ -385,18 +765,167 @@ namespace codac2
       template<typename X1, typename X2>
       static bool same_sampling(const SampledTraj<X1>& x1, const SampledTraj<X2>& x2)
       {
-        auto it1 = x1.cbegin();
-        auto it2 = x2.cbegin();
+        return x1.times() == x2.times();
+      }
+
+    protected:
+
+      template<typename>
+      friend class SampledTraj;
+
+      size_t dim() const
+      {
+        return _rows*_cols;
+      }
+
+      size_t lower_index(double t) const
+      {
+        return std::lower_bound(_t.begin(), _t.end(), t) - _t.begin();
+      }
+
+      size_t upper_index(double t) const
+      {
+        return std::upper_bound(_t.begin(), _t.end(), t) - _t.begin();
+      }
+
+      // Rank of the sample at t, throws std::out_of_range if t is not sampled
+      size_t index_at(double t) const
+      {
+        size_t i = lower_index(t);
+        if(i == nb_samples() || _t[i] != t)
+          throw std::out_of_range("SampledTraj: no sample at t");
+        return i;
+      }
+
+      ConstValueRef value(size_t i) const
+      {
+        if constexpr(std::is_same_v<T,double>)
+          return _x[i];
+        else
+          return ConstValueRef(_x.data()+i*dim(), _rows, _cols);
+      }
+
+      ValueRef value(size_t i)
+      {
+        if constexpr(std::is_same_v<T,double>)
+          return _x[i];
+        else
+          return ValueRef(_x.data()+i*dim(), _rows, _cols);
+      }
+
+      // Hull of the values of the samples of ranks i <= k < j
+      typename Wrapper<T>::Domain hull_of_samples(size_t i, size_t j) const
+      {
+        typename Wrapper<T>::Domain hull = [this]() {
+          if constexpr(std::is_same_v<T,double>)
+            return Interval::empty();
+          else if constexpr(std::is_same_v<T,Vector>)
+            return IntervalVector::empty(_rows);
+          else
+            return IntervalMatrix::empty(_rows,_cols);
+        }();
 
-        while(it1 != x1.cend() && it2 != x2.cend())
+        for(size_t k = i ; k < j ; k++)
         {
-          if(it1->first != it2->first)
-            return false;
-          it1++; it2++;
+          if constexpr(std::is_same_v<T,double>)
+            hull |= _x[k];
+          else
+            for(size_t l = 0 ; l < dim() ; l++)
+              hull.data()[l] |= _x[k*dim()+l];
         }
 
-        return it1 == x1.cend() && it2 == x2.cend();
+        return hull;
+      }
+
+      // First (or last) segment of ranks i <= k < j whose hull intersects [y], n if none
+      size_t first_segment(size_t i, size_t j, const typename Wrapper<T>::Domain& y) const
+      {
+        if(const TrajHullIndex<T>* h = hull_index())
+          return h->first_segment(i, j, y);
+
+        for(size_t k = i ; k < j ; k++)
+          if(hull_of_samples(k, k+2).intersects(y))
+            return k;
+        return nb_samples();
       }
+
+      size_t last_segment(size_t i, size_t j, const typename Wrapper<T>::Domain& y) const
+      {
+        if(const TrajHullIndex<T>* h = hull_index())
+          return h->last_segment(i, j, y);
+
+        for(size_t k = j ; k > i ; k--)
+          if(hull_of_samples(k-1, k+1).intersects(y))
+            return k-1;
+        return nb_samples();
+      }
+
+      // Times of [t] at which the k-th segment (or the k-th sample, if it is the last one)
+      // belongs to [y], by an inversion of the linear interpolation
+      Interval invert_segment(size_t k, const typename Wrapper<T>::Domain& y, const Interval& t) const
+      {
+        const size_t k_ = std::min(k+1, nb_samples()-1);
+        const Interval* y_ = [&y]() {
+          if constexpr(std::is_same_v<T,double>)
+            return &y;
+          else
+            return y.data();
+        }();
+
+        // Ratio of the segment, in [0,1]
+        Interval r = k_ == k ? Interval(0.) : Interval(0.,1.);
+        for(size_t l = 0 ; l < dim() && !r.is_empty() ; l++)
+        {
+          const double a = _x[k*dim()+l], b = _x[k_*dim()+l];
+          if(a == b)
+          {
+            if(!y_[l].contains(a))
+              return Interval::empty();
+          }
+          else
+            r &= (y_[l] - a) / (Interval(b) - a);
+        }
+
+        if(r.is_empty())
+          return r;
+        return (_t[k] + r*(Interval(_t[k_]) - _t[k])) & Interval(_t[k],_t[k_]) & t;
+      }
+
+      void invalidate_hull_index()
+      {
+        _hull_index_valid.store(false, std::memory_order_relaxed);
+      }
+
+      // Index of the values, built again if outdated, or nullptr if not enabled. The index
+      // may be built by concurrent queries, but not during a modification of the trajectory.
+      const TrajHullIndex<T>* hull_index() const
+      {
+        if(!_hull_index_enabled)
+          return nullptr;
+
+        if(!_hull_index_valid.load(std::memory_order_acquire))
+        {
+          std::lock_guard<std::mutex> lock(_hull_index_mutex);
+          if(!_hull_index_valid.load(std::memory_order_relaxed))
+          {
+            if(_hull_index)
+              _hull_index->build(_x.data(), nb_samples(), _rows, _cols);
+            else
+              _hull_index.emplace(_x.data(), nb_samples(), _rows, _cols);
+            _hull_index_valid.store(true, std::memory_order_release);
+          }
+        }
+
+        return &*_hull_index;
+      }
+
+      std::vector<double> _t; // sampled times, in increasing order
+      std::vector<double> _x; // sampled values, sample after sample
+      Index _rows = 1, _cols = 1; // shape of the values
+      bool _hull_index_enabled = false;
+      mutable std::optional<TrajHullIndex<T>> _hull_index;
+      mutable std::atomic<bool> _hull_index_valid { false };
+      mutable std::mutex _hull_index_mutex;
   };
   
   template<typename T>
@@ -446,8 +975,9 @@ namespace codac2
     auto&& x0 = std::get<0>(std::forward_as_tuple(x...));
     assert_release((SampledTraj<Vector>::same_sampling(x0, x) && ...));
     SampledTraj<Vector> y;
-    for(auto it = x0.begin() ; it != x0.end() ; it++)
-      y.set(cart_prod(x.at(it->first)...), it->first);
+    y.reserve(x0.nb_samples());
+    for(const auto& ti : x0.times())
+      y.set(cart_prod(x(ti)...), ti);
     return y;
   }
 }
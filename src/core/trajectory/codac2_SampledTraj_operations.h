@@ -9,6 +9,7 @@
 
 #pragma once
 
+#include <functional>
 #include "codac2_SampledTraj.h"
 #include "codac2_math.h"
 
@@ -85,19 +86,34 @@ namespace codac2
   template<typename T,typename X1,typename X2>
   inline T operator_mul(const X1& x1, const X2& x2) { return x1 * x2; }
 
-  template<typename T,typename X2>
-  inline T operator_mul_scal(double x1, const X2& x2) { return x1 * x2; }
+  template<typename T,typename X1,typename X2>
+  inline T operator_div(const X1& x1, const X2& x2) { return x1 / x2; }
 
-  template<typename T,typename X1>
-  inline T operator_mul_scal(const X1& x1, double x2) { return x1 * x2; }
+  // Component-wise operations, computed directly on the contiguous buffers of values
 
-  inline Matrix operator_mul_vec(const Matrix& x1, const Vector& x2) { return x1 * x2; }
+  template<typename T,typename F>
+  inline SampledTraj<T>& componentwise_traj_traj(SampledTraj<T>& x1, const SampledTraj<T>& x2, const F& f)
+  {
+    assert_release(x1.nb_samples() == x2.nb_samples());
+    assert_release(x1.times() == x2.times()
+      && "inconsistent dates between the two trajectories");
+    assert_release(x1.values().size() == x2.values().size());
 
-  template<typename T,typename X1,typename X2>
-  inline T operator_div(const X1& x1, const X2& x2) { return x1 / x2; }
+    double *x1_ = x1.data();
+    const double *x2_ = x2.values().data();
+    for(size_t k = 0 ; k < x2.values().size() ; k++)
+      x1_[k] = f(x1_[k],x2_[k]);
+    return x1;
+  }
 
-  template<typename T,typename X1>
-  inline T operator_div_scal(const X1& x1, double x2) { return x1 / x2; }
+  template<typename T,typename F>
+  inline SampledTraj<T>& componentwise_traj_real(SampledTraj<T>& x1, double x2, const F& f)
+  {
+    double *x1_ = x1.data();
+    for(size_t k = 0 ; k < x1.values().size() ; k++)
+      x1_[k] = f(x1_[k],x2);
+    return x1;
+  }
 
   /** \brief \f$x1(\cdot)\f$
     * \param x1
@@ -115,7 +131,11 @@ namespace codac2
     */
   template<typename T>
   inline SampledTraj<T> operator+(const SampledTraj<T>& x1, const SampledTraj<T>& x2)
-    macro_binary_traj_traj(operator_add<T>);
+  {
+    auto y = x1;
+    componentwise_traj_traj(y, x2, std::plus<double>());
+    return y;
+  }
 
   /** \brief \f$x_1(\cdot)+x_2\f$
     * \param x1
@@ -153,7 +173,9 @@ namespace codac2
    */
   template<typename T>
   inline SampledTraj<T>& operator+=(SampledTraj<T>& x1, const SampledTraj<T>& x2)
-    macro_member_binary_traj_traj(operator_add<T>);
+  {
+    return componentwise_traj_traj(x1, x2, std::plus<double>());
+  }
 
   /** \brief \f$-x_1(\cdot)\f$
     * \param x1
@@ -171,7 +193,11 @@ namespace codac2
     */
   template<typename T>
   inline SampledTraj<T> operator-(const SampledTraj<T>& x1, const SampledTraj<T>& x2)
-    macro_binary_traj_traj(operator_sub<T>);
+  {
+    auto y = x1;
+    componentwise_traj_traj(y, x2, std::minus<double>());
+    return y;
+  }
 
   /** \brief \f$x_1(\cdot)-x_2\f$
     * \param x1
@@ -209,7 +235,9 @@ namespace codac2
    */
   template<typename T>
   inline SampledTraj<T>& operator-=(SampledTraj<T>& x1, const SampledTraj<T>& x2)
-    macro_member_binary_traj_traj(operator_sub<T>);
+  {
+    return componentwise_traj_traj(x1, x2, std::minus<double>());
+  }
 
   /** \brief \f$x_1\cdot x_2(\cdot)\f$
     * \param x1
@@ -219,7 +247,11 @@ namespace codac2
   template<typename T>
     requires (!std::is_same_v<T,double>)
   inline SampledTraj<T> operator*(double x1, const SampledTraj<T>& x2)
-    macro_binary_real_traj(operator_mul_scal<T>);
+  {
+    auto y = x2;
+    componentwise_traj_real(y, x1, std::multiplies<double>());
+    return y;
+  }
 
   /** \brief \f$x_1(\cdot)\cdot x_2\f$
     * \param x1
@@ -229,7 +261,11 @@ namespace codac2
   template<typename T>
     requires (!std::is_same_v<T,double>)
   inline SampledTraj<T> operator*(const SampledTraj<T>& x1, double x2)
-    macro_binary_traj_real(operator_mul_scal<T>);
+  {
+    auto y = x1;
+    componentwise_traj_real(y, x2, std::multiplies<double>());
+    return y;
+  }
 
   /** \brief \f$x_1(\cdot)\cdot x_2(\cdot)\f$
     * \param x1
@@ -264,7 +300,16 @@ namespace codac2
     * \return trajectory output
     */
   inline SampledTraj<Vector> operator*(const SampledTraj<Matrix>& x1, const SampledTraj<Vector>& x2)
-    macro_binary_traj_traj(operator_mul_vec);
+  {
+    assert_release(SampledTraj<Vector>::same_sampling(x1, x2)
+      && "inconsistent dates between the two trajectories");
+    SampledTraj<Vector> y;
+    y.reserve(x1.nb_samples());
+    auto it_x2 = x2.begin();
+    for(const auto& [ti,x1i] : x1)
+      y.set(x1i*(it_x2++)->second, ti);
+    return y;
+  }
 
   /**
    * \brief Operates *=
@@ -294,7 +339,11 @@ namespace codac2
   template<typename T>
     requires (!std::is_same_v<T,double>)
   inline SampledTraj<T> operator/(const SampledTraj<T>& x1, double x2)
-    macro_binary_traj_real(operator_div_scal<T>);
+  {
+    auto y = x1;
+    componentwise_traj_real(y, x2, std::divides<double>());
+    return y;
+  }
 
   /** \brief \f$x_1(\cdot)/x_2(\cdot)\f$
     * \param x1
@@ -0,0 +1,306 @@
+/**
+ *  \file codac2_TrajHullIndex.h
+ * ----------------------------------------------------------------------------
+ *  \date       2025
+ *  \author     Simon Rohou
+ *  \copyright  Copyright 2025 Codac Team
+ *  \license    GNU Lesser General Public License (LGPL)
+ */
+
+#pragma once
+
+#include <vector>
+#include <algorithm>
+#include "codac2_Wrapper.h"
+
+namespace codac2
+{
+  /**
+   * \class TrajHullIndex
+   * \brief Index of the values of a sampled trajectory, for the computation of the hull
+   * of the values sampled over a range of samples.
+   *
+   * The values are stored in time order in the leaves of a segment tree, each node
+   * enclosing the hull of its children. The hull of the values sampled between the
+   * \f$i\f$-th and the \f$j\f$-th samples is then obtained in \f$\mathcal{O}(\log n)\f$,
+   * for \f$n\f$ samples.
+   *
+   * The update of an existing value is done in \f$\mathcal{O}(\log n)\f$, and the addition
+   * of a value after the last sample in \f$\mathcal{O}(\log n)\f$ (amortized, the tree being
+   * extended when its capacity is reached). Any other modification requires a new build
+   * of the index.
+   *
+   * The values are read from a contiguous array in which each sample is made of
+   * \f$m\f$ components (\f$m=1\f$ for scalar trajectories). The nodes are stored
+   * in a single array of intervals, following the same layout.
+   */
+  template<typename T>
+  class TrajHullIndex
+  {
+    public:
+
+      using Domain = typename Wrapper<T>::Domain;
+
+      /**
+       * \brief Builds the index of the values of a trajectory
+       *
+       * \param x values, stored contiguously sample after sample
+       * \param n number of samples
+       * \param rows number of rows of each value
+       * \param cols number of columns of each value
+       */
+      TrajHullIndex(const double* x, size_t n, Index rows, Index cols)
+      {
+        build(x, n, rows, cols);
+      }
+
+      /**
+       * \brief Number of indexed samples
+       *
+       * \return number of samples
+       */
+      size_t nb_samples() const
+      {
+        return _n;
+      }
+
+      /**
+       * \brief Builds again the index from the values of a trajectory
+       *
+       * \param x values, stored contiguously sample after sample
+       * \param n number of samples
+       * \param rows number of rows of each value
+       * \param cols number of columns of each value
+       */
+      void build(const double* x, size_t n, Index rows, Index cols)
+      {
+        _rows = rows; _cols = cols;
+        _n = n;
+        _cap = 1;
+
+        while(_cap < n)
+          _cap *= 2;
+
+        _h.assign(2*_cap*dim(), Interval::empty());
+        for(size_t i = 0 ; i < n ; i++)
+          set_leaf(i, x+i*dim());
+
+        for(size_t i = _cap-1 ; i > 0 ; i--)
+          merge_children(i);
+      }
+
+      /**
+       * \brief Empties the index: it has then to be built again
+       */
+      void reset()
+      {
+        _n = 0;
+        _cap = 1;
+        _h.assign(2*dim(), Interval::empty());
+      }
+
+      /**
+       * \brief Updates the index after the modification of the value of the \f$i\f$-th sample
+       *
+       * \param i rank of the sample, \f$i<n\f$
+       * \param xi new value
+       */
+      void update(size_t i, const double* xi)
+      {
+        assert(i < _n);
+        set_leaf(i, xi);
+        for(size_t j = (_cap+i)/2 ; j > 0 ; j /= 2)
+          merge_children(j);
+      }
+
+      /**
+       * \brief Updates the index after the addition of a value after the last sample
+       *
+       * \param xi new value
+       */
+      void push_back(const double* xi)
+      {
+        if(_n == _cap) // the tree is extended, the leaves being copied in a larger level
+        {
+          std::vector<Interval> h(4*_cap*dim(), Interval::empty());
+          std::copy(_h.begin()+_cap*dim(), _h.end(), h.begin()+2*_cap*dim());
+          _cap *= 2;
+          _h.swap(h);
+
+          for(size_t i = _cap-1 ; i > 0 ; i--)
+            merge_children(i);
+        }
+
+        size_t i = _n++;
+        set_leaf(i, xi);
+
+        // The hulls of the ancestors can only grow
+        for(size_t j = (_cap+i)/2 ; j > 0 && add_to_node(j, _cap+i) ; j /= 2)
+        { }
+      }
+
+      /**
+       * \brief Hull of all the sampled values
+       *
+       * \pre The index is not empty.
+       *
+       * \return hull of the values
+       */
+      Domain hull() const
+      {
+        return as_domain(_h.data()+dim());
+      }
+
+      /**
+       * \brief Hull of the values of the samples of ranks \f$i\leqslant k<j\f$
+       *
+       * \param i rank of the first sample
+       * \param j rank following the last sample
+       * \return hull of the values, empty if \f$i\geqslant j\f$
+       */
+      Domain hull(size_t i, size_t j) const
+      {
+        assert(j <= _n);
+
+        std::vector<Interval> h(dim(), Interval::empty());
+        auto add = [&](size_t k)
+        {
+          for(size_t l = 0 ; l < dim() ; l++)
+            h[l] |= _h[k*dim()+l];
+        };
+
+        for(size_t l = _cap+i, r = _cap+j ; l < r ; l /= 2, r /= 2)
+        {
+          if(l & 1)
+            add(l++);
+          if(r & 1)
+            add(--r);
+        }
+
+        return as_domain(h.data());
+      }
+
+      /**
+       * \brief Rank of the first segment \f$k\f$, \f$i\leqslant k<j\f$, whose hull may
+       * intersect \f$[y]\f$, the \f$k\f$-th segment joining the values of the samples
+       * \f$k\f$ and \f$k+1\f$
+       *
+       * The subtrees whose hulls (extended to the value of the sample following them)
+       * do not intersect \f$[y]\f$ are not explored. The hull of the returned segment
+       * intersects \f$[y]\f$.
+       *
+       * \param i rank of the first segment
+       * \param j rank following the last segment
+       * \param y set of values
+       * \return rank of the segment, or \f$n\f$ if none
+       */
+      size_t first_segment(size_t i, size_t j, const Domain& y) const
+      {
+        return find_segment(1, 0, _cap, i, j, data(y), true);
+      }
+
+      /**
+       * \brief Rank of the last segment \f$k\f$, \f$i\leqslant k<j\f$, whose hull may
+       * intersect \f$[y]\f$, see ``first_segment()``
+       *
+       * \param i rank of the first segment
+       * \param j rank following the last segment
+       * \param y set of values
+       * \return rank of the segment, or \f$n\f$ if none
+       */
+      size_t last_segment(size_t i, size_t j, const Domain& y) const
+      {
+        return find_segment(1, 0, _cap, i, j, data(y), false);
+      }
+
+    protected:
+
+      static const Interval* data(const Domain& y)
+      {
+        if constexpr(std::is_same_v<T,double>)
+          return &y;
+        else
+          return y.data();
+      }
+
+      // First (or last) segment of ranks i<=k<j in the subtree of the node p,
+      // covering the samples of ranks a<=k<b, _n if none
+      size_t find_segment(size_t p, size_t a, size_t b, size_t i, size_t j, const Interval* y, bool first) const
+      {
+        if(b <= i || a >= j || a+1 >= _n)
+          return _n;
+
+        // The segments of the node join the samples a to b
+        for(size_t k = 0 ; k < dim() ; k++)
+        {
+          Interval h = _h[p*dim()+k];
+          if(b < _n)
+            h |= _h[(_cap+b)*dim()+k];
+          if(!h.intersects(y[k]))
+            return _n;
+        }
+
+        if(b == a+1)
+          return a;
+
+        const size_t m = (a+b)/2;
+        size_t k = first ? find_segment(2*p, a, m, i, j, y, first) : find_segment(2*p+1, m, b, i, j, y, first);
+        if(k == _n)
+          k = first ? find_segment(2*p+1, m, b, i, j, y, first) : find_segment(2*p, a, m, i, j, y, first);
+        return k;
+      }
+
+      size_t dim() const
+      {
+        return _rows*_cols;
+      }
+
+      void set_leaf(size_t i, const double* xi)
+      {
+        for(size_t k = 0 ; k < dim() ; k++)
+          _h[(_cap+i)*dim()+k] = Interval(xi[k]);
+      }
+
+      void merge_children(size_t i)
+      {
+        for(size_t k = 0 ; k < dim() ; k++)
+          _h[i*dim()+k] = _h[2*i*dim()+k] | _h[(2*i+1)*dim()+k];
+      }
+
+      // Encloses the node j in the node i, returns false if it was already enclosed
+      bool add_to_node(size_t i, size_t j)
+      {
+        bool modified = false;
+        for(size_t k = 0 ; k < dim() ; k++)
+          if(!_h[i*dim()+k].is_superset(_h[j*dim()+k]))
+          {
+            _h[i*dim()+k] |= _h[j*dim()+k];
+            modified = true;
+          }
+        return modified;
+      }
+
+      Domain as_domain(const Interval* h) const
+      {
+        if constexpr(std::is_same_v<T,double>)
+          return h[0];
+
+        else
+        {
+          Domain d = [this]() {
+            if constexpr(std::is_same_v<T,Vector>)
+              return Domain(_rows);
+            else
+              return Domain(_rows,_cols);
+          }();
+          std::copy(h, h+dim(), d.data());
+          return d;
+        }
+      }
+
+      size_t _n = 0; // number of indexed samples
+      std::vector<Interval> _h; // nodes of the segment tree, the leaves being stored from the node _cap
+      size_t _cap = 1;
+      size_t _rows = 1, _cols = 1;
+  };
+}
@@ -79,7 +79,11 @@ namespace codac2
       [[maybe_unused]] const typename TR::Type::Domain& y,
       [[maybe_unused]] Interval& x2)
     {
-      // todo
+      // The time is contracted by the inversion of sampled trajectories,
+      // the values being unknown outside their tdomain
+      if constexpr(std::is_same_v<TR,SampledTraj<T>>)
+        if(x2.is_subset(x1.tdomain()))
+          x2 &= x1.invert(y, x2);
     }
   };
 
@@ -91,6 +95,16 @@ namespace codac2
     public:
 
       AnalyticOperationExpr(const TR& x1, const ScalarExpr& x2)
+        : AnalyticOperationExpr([&x1]() {
+            // The copy of a sampled trajectory is indexed for the inversions of TrajectoryOp::bwd
+            auto x1_ = std::make_shared<TR>(x1);
+            if constexpr(std::is_same_v<TR,SampledTraj<typename T::Scalar>>)
+              x1_->enable_hull_index();
+            return std::shared_ptr<const TR>(x1_);
+          }(), x2)
+      { }
+
+      AnalyticOperationExpr(const std::shared_ptr<const TR>& x1, const ScalarExpr& x2)
         : OperationExprBase<AnalyticExpr<ScalarType>>(x2), _x1(x1),
           _x1_deriv([&]() {
             // The following is disabled, see the previous comment in TrajectoryOp::fwd_centered
@@ -115,20 +129,64 @@ namespace codac2
       {
         if(natural_eval)
           return AnalyticExpr<T>::init_value(
-            v, TrajectoryOp<TR>::fwd_natural(_x1, std::get<0>(this->_x)->fwd_eval(v, total_input_size, natural_eval)));
+            v, TrajectoryOp<TR>::fwd_natural(*_x1, std::get<0>(this->_x)->fwd_eval(v, total_input_size, natural_eval)));
         else
           return AnalyticExpr<T>::init_value(
-            v, TrajectoryOp<TR>::fwd_centered(_x1, _x1_deriv, std::get<0>(this->_x)->fwd_eval(v, total_input_size, natural_eval)));
+            v, TrajectoryOp<TR>::fwd_centered(*_x1, _x1_deriv, std::get<0>(this->_x)->fwd_eval(v, total_input_size, natural_eval)));
       }
       
       void bwd_eval(ValuesMap& v) const
       {
-        TrajectoryOp<TR>::bwd(_x1, AnalyticExpr<T>::value(v).a, std::get<0>(this->_x)->value(v).a);
+        TrajectoryOp<TR>::bwd(*_x1, AnalyticExpr<T>::value(v).a, std::get<0>(this->_x)->value(v).a);
         std::get<0>(this->_x)->bwd_eval(v);
       }
 
+      void compile(AnalyticTape& t) const
+      {
+        std::get<0>(this->_x)->compile(t);
+        t.add_step(*this, 1);
+      }
+
+      void fwd_eval_step(ValuesSlots& v, const Index* s, [[maybe_unused]] Index total_input_size, bool natural_eval) const
+      {
+        if(natural_eval)
+          AnalyticExpr<T>::init_value(
+            v, s[0], TrajectoryOp<TR>::fwd_natural(*_x1, AnalyticExpr<ScalarType>::value(v, s[1])));
+        else
+          AnalyticExpr<T>::init_value(
+            v, s[0], TrajectoryOp<TR>::fwd_centered(*_x1, _x1_deriv, AnalyticExpr<ScalarType>::value(v, s[1])));
+      }
+
+      void bwd_eval_step(ValuesSlots& v, const Index* s) const
+      {
+        TrajectoryOp<TR>::bwd(*_x1, AnalyticExpr<T>::value(v, s[0]).a, AnalyticExpr<ScalarType>::value(v, s[1]).a);
+      }
+
+      void fwd_eval_batch_step(ValuesSlots& v, const Index* s, Index n, [[maybe_unused]] Index total_input_size, bool natural_eval) const
+      {
+        auto& x1 = AnalyticExpr<ScalarType>::batch_value(v, s[1]);
+        if(natural_eval)
+          AnalyticExpr<T>::init_batch_value(
+            v, s[0], n, [&](Index k) { return TrajectoryOp<TR>::fwd_natural(*_x1, x1.get(k)); });
+        else
+          AnalyticExpr<T>::init_batch_value(
+            v, s[0], n, [&](Index k) { return TrajectoryOp<TR>::fwd_centered(*_x1, _x1_deriv, x1.get(k)); });
+      }
+
+      void bwd_eval_batch_step(ValuesSlots& v, const Index* s) const
+      {
+        bwd_batch([&](auto& y, auto& x1) { TrajectoryOp<TR>::bwd(*_x1, y, x1); },
+          AnalyticExpr<T>::batch_value(v, s[0]), AnalyticExpr<ScalarType>::batch_value(v, s[1]));
+      }
+
+      bool is_same_operation(const AnalyticExprBase& e) const
+      {
+        // Copies of the expression share the same trajectory
+        return dynamic_cast<const AnalyticOperationExpr<TrajectoryOp<TR>,T,S>&>(e)._x1 == _x1;
+      }
+
       std::pair<Index,Index> output_shape() const {
-        return _x1.shape();
+        return _x1->shape();
       }
 
       virtual bool belongs_to_args_list(const FunctionArgsList& args) const
@@ -149,7 +207,9 @@ namespace codac2
 
     protected:
 
-      const TR _x1;
+      // The trajectory is shared (and not modified) by the copies of the expression,
+      // which are then built without copying its data
+      const std::shared_ptr<const TR> _x1;
       const SampledTraj<typename T::Scalar> _x1_deriv; // only available for operators on SampledTraj<T>
   };
 }
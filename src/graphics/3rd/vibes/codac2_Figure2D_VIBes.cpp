@@ -43,6 +43,13 @@ void Figure2D_VIBes::update_axes()
 }
 
 void Figure2D_VIBes::update_drawing_properties(const StyleProperties& style)
+{
+  // Batched boxes are drawn before any other shape
+  send_batched_boxes();
+  set_drawing_properties(style);
+}
+
+void Figure2D_VIBes::set_drawing_properties(const StyleProperties& style)
 {
   if ((std::find(_layers.begin(), _layers.end(), style.layer) == _layers.end()))
   {
@@ -88,11 +95,49 @@ void Figure2D_VIBes::center_viewbox(const Vector& c, const Vector& r)
 
 void Figure2D_VIBes::clear()
 {
+  _batched_boxes.clear();
+  _batched_styles.clear();
   vibes::clearFigure(_fig.name());
   _params = vibesParams("figure", _fig.name(), "LineStyle", "-");
   _layers.clear();
 }
 
+void Figure2D_VIBes::begin_batch()
+{
+  if(_batch_depth++ == 0)
+  {
+    _was_buffering = vibes::isBuffering();
+    vibes::setBuffering(true);
+  }
+}
+
+void Figure2D_VIBes::end_batch()
+{
+  assert(_batch_depth > 0);
+  if(--_batch_depth == 0)
+  {
+    send_batched_boxes();
+    if(_was_buffering)
+      vibes::flush();
+    else
+      vibes::setBuffering(false);
+  }
+}
+
+void Figure2D_VIBes::send_batched_boxes()
+{
+  for(const auto& [params,boxes] : _batched_boxes)
+  {
+    if(boxes.size() == 1)
+      vibes::drawBox(boxes[0], params);
+    else
+      vibes::drawBoxes(boxes, params);
+  }
+
+  _batched_boxes.clear();
+  _batched_styles.clear();
+}
+
 void Figure2D_VIBes::draw_point(const Vector& c, const StyleProperties& style)
 {
   assert(_fig.size() <= c.size());
@@ -105,9 +150,28 @@ void Figure2D_VIBes::draw_box(const IntervalVector& x, const StyleProperties& st
 {
   assert(_fig.size() <= x.size());
 
-  update_drawing_properties(style);
+  if(_batch_depth == 0)
+  {
+    update_drawing_properties(style);
+    vibes::drawBox(x[i()].lb(),x[i()].ub(),x[j()].lb(),x[j()].ub(), to_vibes_style(style), _params);
+    return;
+  }
+
+  // The boxes are gathered by style, each style being sent in a single "boxes" message
+  string s = to_vibes_style(style) + "|" + style.line_style + "|" + std::to_string(style.line_width)
+    + "|" + style.layer + "|" + std::to_string(style.z_value);
+
+  auto it = _batched_styles.find(s);
+  if(it == _batched_styles.end())
+  {
+    set_drawing_properties(style);
+    vibes::Params params = _params;
+    params["format"] = to_vibes_style(style);
+    _batched_boxes.push_back({ params, {} });
+    it = _batched_styles.emplace(s, _batched_boxes.size()-1).first;
+  }
 
-  vibes::drawBox(x[i()].lb(),x[i()].ub(),x[j()].lb(),x[j()].ub(), to_vibes_style(style), _params);
+  _batched_boxes[it->second].second.push_back({ x[i()].lb(),x[i()].ub(),x[j()].lb(),x[j()].ub() });
 }
 
 void Figure2D_VIBes::draw_circle(const Vector& c, double r, const StyleProperties& style)
@@ -9,6 +9,7 @@
 
 #pragma once
 
+#include <map>
 #include "codac2_Figure2D.h"
 #include "codac2_OutputFigure2D.h"
 #include "codac2_IntervalVector.h"
@@ -65,6 +66,21 @@ namespace codac2
        * \brief Clears the figure
        */
       void clear();
+
+      /**
+       * \brief Starts a sequence of drawings
+       * 
+       * Until the end of the sequence, the VIBes messages are buffered, and the boxes
+       * are gathered by style: the boxes of a same style are sent in a single message,
+       * before the next shape that is not a box. The drawing order of boxes of different
+       * styles may then change, which is suited for the boxes of pavings.
+       */
+      void begin_batch();
+
+      /**
+       * \brief Ends a sequence of drawings, and sends the buffered messages to VIBes
+       */
+      void end_batch();
       
       // Geometric shapes
 
@@ -202,7 +218,22 @@ namespace codac2
 
     protected:
 
+      /**
+       * \brief Updates the drawing properties without sending the batched boxes
+       */
+      void set_drawing_properties(const StyleProperties& s);
+
+      /**
+       * \brief Sends the batched boxes, one message per style
+       */
+      void send_batched_boxes();
+
       static int _has_been_initialized;
       vibes::Params _params;
+
+      int _batch_depth = 0;
+      bool _was_buffering = false;
+      std::map<std::string,size_t> _batched_styles; // rank of each style in _batched_boxes
+      std::vector<std::pair<vibes::Params,std::vector<std::vector<double>>>> _batched_boxes;
   };
 }
\ No newline at end of file
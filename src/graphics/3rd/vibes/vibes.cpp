@@ -29,6 +29,7 @@
 #include <limits>
 #include <iomanip>
 #include <memory>
+#include <chrono>
 
 //
 // Vibes properties key,value system implementation
@@ -102,6 +103,29 @@ namespace vibes
       /// Current figure name (client-maintained state)
       string current_fig="default";
 
+      /// Buffered mode: messages are accumulated before being written to the channel
+      bool buffering=false;
+      string buffer;
+      std::size_t buffer_max_size=1<<16;
+      double buffer_max_delay=0.1;
+      chrono::steady_clock::time_point last_flush;
+
+      /// Writes a message to the channel, or appends it to the buffer in buffered mode
+      void send(const string &msg)
+      {
+        if (!buffering)
+        {
+          fputs(msg.c_str(),channel.get());
+          fflush(channel.get());
+          return;
+        }
+
+        buffer.append(msg);
+        if (buffer.size() >= buffer_max_size
+          || chrono::duration<double>(chrono::steady_clock::now()-last_flush).count() >= buffer_max_delay)
+          flush();
+      }
+
   }
 
   //
@@ -150,7 +174,38 @@ namespace vibes
 
   void endDrawing()
   {
+    flush();
+  }
+
+  void setBuffering(bool enable)
+  {
+    if (!enable)
+      flush();
+    else if (!buffering)
+      last_flush = chrono::steady_clock::now();
+    buffering = enable;
+  }
+
+  bool isBuffering()
+  {
+    return buffering;
+  }
+
+  void setBufferingLimits(std::size_t maxSize, double maxDelay)
+  {
+    buffer_max_size = maxSize;
+    buffer_max_delay = maxDelay;
+  }
 
+  void flush()
+  {
+    if (channel && !buffer.empty())
+    {
+      fwrite(buffer.data(),1,buffer.size(),channel.get());
+      fflush(channel.get());
+    }
+    buffer.clear();
+    last_flush = chrono::steady_clock::now();
   }
 
 
@@ -166,8 +221,7 @@ namespace vibes
     if (!figureName.empty()) current_fig = figureName;
     msg ="{\"action\":\"new\","
           "\"figure\":\""+(figureName.empty()?current_fig:figureName)+"\"}\n\n";
-    fputs(msg.c_str(),channel.get());
-    fflush(channel.get());
+    send(msg);
   }
 
   void clearFigure(const std::string &figureName)
@@ -176,8 +230,7 @@ namespace vibes
     std::string msg;
     msg="{\"action\":\"clear\","
          "\"figure\":\""+(figureName.empty()?current_fig:figureName)+"\"}\n\n";
-    fputs(msg.c_str(),channel.get());
-    fflush(channel.get());
+    send(msg);
   }
 
   void closeFigure(const std::string &figureName)
@@ -186,8 +239,7 @@ namespace vibes
     std::string msg;
     msg="{\"action\":\"close\","
          "\"figure\":\""+(figureName.empty()?current_fig:figureName)+"\"}\n\n";
-    fputs(msg.c_str(),channel.get());
-    fflush(channel.get());
+    send(msg);
   }
 
   void saveImage(const std::string &fileName, const std::string &figureName)
@@ -197,8 +249,7 @@ namespace vibes
     msg="{\"action\":\"export\","
           "\"figure\":\""+(figureName.empty()?current_fig:figureName)+"\","
           "\"file\":\""+fileName+"\"}\n\n";
-    fputs(msg.c_str(),channel.get());
-    fflush(channel.get());
+    send(msg);
   }
 
   void selectFigure(const std::string &figureName)
@@ -262,8 +313,7 @@ namespace vibes
     msg["figure"] = params.pop("figure",current_fig);
     msg["shape"] = (params, "type", "box", "bounds", v4d);
 
-    fputs(Value(msg).toJSONString().append("\n\n").c_str(), channel.get());
-    fflush(channel.get());
+    send(Value(msg).toJSONString().append("\n\n"));
   }
 
   void drawBox(const vector<double> &bounds, Params params)
@@ -277,8 +327,7 @@ namespace vibes
     msg["figure"] = params.pop("figure",current_fig);
     msg["shape"] = (params, "type", "box", "bounds", vector<Value>(bounds.begin(),bounds.end()));
 
-    fputs(Value(msg).toJSONString().append("\n\n").c_str(), channel.get());
-    fflush(channel.get());
+    send(Value(msg).toJSONString().append("\n\n"));
   }
 
 
@@ -295,8 +344,7 @@ namespace vibes
                               "axis", va,
                               "orientation", rot);
 
-      fputs(Value(msg).toJSONString().append("\n\n").c_str(), channel.get());
-      fflush(channel.get());
+      send(Value(msg).toJSONString().append("\n\n"));
   }
 
   void drawConfidenceEllipse(const double &cx, const double &cy,
@@ -314,8 +362,7 @@ namespace vibes
                               "covariance", vcov,
                               "sigma", K);
 
-      fputs(Value(msg).toJSONString().append("\n\n").c_str(), channel.get());
-      fflush(channel.get());
+      send(Value(msg).toJSONString().append("\n\n"));
   }
 
   void drawConfidenceEllipse(const vector<double> &center, const vector<double> &cov,
@@ -330,8 +377,7 @@ namespace vibes
                               "covariance", vector<Value>(cov.begin(),cov.end()),
                               "sigma", K);
 
-      fputs(Value(msg).toJSONString().append("\n\n").c_str(), channel.get());
-      fflush(channel.get());
+      send(Value(msg).toJSONString().append("\n\n"));
   }
 
   void drawSector(const double &cx, const double &cy, const double &a, const double &b,
@@ -351,8 +397,7 @@ namespace vibes
                               "orientation", 0,
                               "angles", startEnd);
 
-      fputs(Value(msg).toJSONString().append("\n\n").c_str(), channel.get());
-      fflush(channel.get());
+      send(Value(msg).toJSONString().append("\n\n"));
   }
 
   void drawPie(const double &cx, const double &cy, const double &r_min, const double &r_max,
@@ -371,8 +416,7 @@ namespace vibes
                               "rho", rMinMax,
                               "theta", thetaMinMax);
 
-      fputs(Value(msg).toJSONString().append("\n\n").c_str(), channel.get());
-      fflush(channel.get());
+      send(Value(msg).toJSONString().append("\n\n"));
   }
 
   void drawPoint(const double &cx, const double &cy, Params params)
@@ -384,8 +428,7 @@ namespace vibes
       msg["figure"]=params.pop("figure",current_fig);
       msg["shape"]=(params, "type","point",
                             "point",cxy);
-      fputs(Value(msg).toJSONString().append("\n\n").c_str(), channel.get());
-      fflush(channel.get());
+      send(Value(msg).toJSONString().append("\n\n"));
   }
 
   void drawPoint(const double &cx, const double &cy, const double &radius, Params params)
@@ -397,8 +440,7 @@ namespace vibes
       msg["figure"]=params.pop("figure",current_fig);
       msg["shape"]=(params, "type","point",
                             "point",cxy,"Radius",radius);
-      fputs(Value(msg).toJSONString().append("\n\n").c_str(), channel.get());
-      fflush(channel.get());
+      send(Value(msg).toJSONString().append("\n\n"));
   }
 
   void drawRing(const double &cx, const double &cy, const double &r_min, const double &r_max, Params params)
@@ -412,8 +454,7 @@ namespace vibes
       msg["shape"] = (params, "type", "ring",
                               "center", cxy,
                               "rho", rMinMax);
-      fputs(Value(msg).toJSONString().append("\n\n").c_str(), channel.get());
-      fflush(channel.get());
+      send(Value(msg).toJSONString().append("\n\n"));
   }
 
   void drawBoxes(const std::vector<std::vector<double> > &bounds, Params params)
@@ -425,8 +466,7 @@ namespace vibes
      msg["shape"] = (params, "type", "boxes",
                              "bounds", bounds);
 
-     fputs(Value(msg).toJSONString().append("\n\n").c_str(), channel.get());
-     fflush(channel.get());
+     send(Value(msg).toJSONString().append("\n\n"));
   }
 
   void drawBoxesUnion(const std::vector<std::vector<double> > &bounds, Params params)
@@ -438,8 +478,7 @@ namespace vibes
      msg["shape"] = (params, "type", "boxes union",
                              "bounds", bounds);
 
-     fputs(Value(msg).toJSONString().append("\n\n").c_str(), channel.get());
-     fflush(channel.get());
+     send(Value(msg).toJSONString().append("\n\n"));
   }
 
   void drawLine(const std::vector<std::vector<double> > &points, Params params)
@@ -451,8 +490,7 @@ namespace vibes
      msg["shape"] = (params, "type", "line",
                              "points", points);
 
-     fputs(Value(msg).toJSONString().append("\n\n").c_str(), channel.get());
-     fflush(channel.get());
+     send(Value(msg).toJSONString().append("\n\n"));
   }
 
   void drawLine(const std::vector<double> &x, const std::vector<double> &y, Params params)
@@ -475,8 +513,7 @@ namespace vibes
      msg["shape"] = (params, "type", "line",
                              "points", points);
 
-     fputs(Value(msg).toJSONString().append("\n\n").c_str(), channel.get());
-     fflush(channel.get());
+     send(Value(msg).toJSONString().append("\n\n"));
   }
 
   //void drawPoints(const std::vector<std::vector<double> > &points, Params params)
@@ -523,8 +560,7 @@ namespace vibes
      msg["shape"] = (params, "type", "points",
                              "centers", points);
 
-     fputs(Value(msg).toJSONString().append("\n\n").c_str(), channel.get());
-     fflush(channel.get());
+     send(Value(msg).toJSONString().append("\n\n"));
   }
 
   //void drawPoints(const std::vector<double> &x, const std::vector<double> y, const std::vector<double> &colorLevels, Params params)
@@ -594,8 +630,7 @@ namespace vibes
                            "points", points,
                            "tip_length", tip_length);
 
-    fputs(Value(msg).toJSONString().append("\n\n").c_str(), channel.get());
-    fflush(channel.get());
+    send(Value(msg).toJSONString().append("\n\n"));
   }
 
   void drawArrow(const std::vector<std::vector<double> > &points, const double &tip_length, Params params)
@@ -608,8 +643,7 @@ namespace vibes
                            "points", points,
                            "tip_length", tip_length);
 
-    fputs(Value(msg).toJSONString().append("\n\n").c_str(), channel.get());
-    fflush(channel.get());
+    send(Value(msg).toJSONString().append("\n\n"));
   }
 
   void drawArrow(const std::vector<double> &x, const std::vector<double> &y, const double &tip_length, Params params)
@@ -633,8 +667,7 @@ namespace vibes
                             "points", points,
                             "tip_length", tip_length);
 
-    fputs(Value(msg).toJSONString().append("\n\n").c_str(), channel.get());
-    fflush(channel.get());
+    send(Value(msg).toJSONString().append("\n\n"));
   }
 
   void drawPolygon(const std::vector<double> &x, const std::vector<double> &y, Params params)
@@ -657,8 +690,7 @@ namespace vibes
     msg["shape"] = (params, "type", "polygon",
                            "bounds", points);
 
-    fputs(Value(msg).toJSONString().append("\n\n").c_str(), channel.get());
-    fflush(channel.get());
+    send(Value(msg).toJSONString().append("\n\n"));
   }
 
   void drawText(const double &top_left_x, const double &top_left_y, const string& text,
@@ -673,8 +705,7 @@ namespace vibes
                             "text",text,
                             "position",top_left_xy,
                             "scale", scale);
-      fputs(Value(msg).toJSONString().append("\n\n").c_str(), channel.get());
-      fflush(channel.get());
+      send(Value(msg).toJSONString().append("\n\n"));
   }
 
   void drawText(const double &top_left_x, const double &top_left_y, const string& text, Params params)
@@ -694,8 +725,7 @@ namespace vibes
                               "length", length,
                               "orientation", rot);
 
-      fputs(Value(msg).toJSONString().append("\n\n").c_str(), channel.get());
-      fflush(channel.get());
+      send(Value(msg).toJSONString().append("\n\n"));
   }
 
   void drawAUV(const double &cx, const double &cy, const double &rot, const double &length, Params params)
@@ -710,8 +740,7 @@ namespace vibes
                               "length", length,
                               "orientation", rot);
 
-      fputs(Value(msg).toJSONString().append("\n\n").c_str(), channel.get());
-      fflush(channel.get());
+      send(Value(msg).toJSONString().append("\n\n"));
   }
 
   void drawMotorBoat(const double &cx, const double &cy, const double &rot, const double &length, Params params)
@@ -726,8 +755,7 @@ namespace vibes
                               "length", length,
                               "orientation", rot);
 
-      fputs(Value(msg).toJSONString().append("\n\n").c_str(), channel.get());
-      fflush(channel.get());
+      send(Value(msg).toJSONString().append("\n\n"));
   }
 
   void drawTank(const double &cx, const double &cy, const double &rot, const double &length, Params params)
@@ -742,8 +770,7 @@ namespace vibes
                               "length", length,
                               "orientation", rot);
 
-      fputs(Value(msg).toJSONString().append("\n\n").c_str(), channel.get());
-      fflush(channel.get());
+      send(Value(msg).toJSONString().append("\n\n"));
   }
 
   void drawRaster(const std::string& rasterFilename, const double &xlb, const double &yub, const double &width, const double &height, Params params)
@@ -767,8 +794,7 @@ namespace vibes
                             "rot", rot
                    );
 
-    fputs(Value(msg).toJSONString().append("\n\n").c_str(), channel.get());
-    fflush(channel.get());
+    send(Value(msg).toJSONString().append("\n\n"));
   }
 
   void drawCake(const double &cx, const double &cy, const double &rot, const double &length, Params params)
@@ -783,8 +809,7 @@ namespace vibes
                               "length", length,
                               "orientation", rot);
 
-      fputs(Value(msg).toJSONString().append("\n\n").c_str(), channel.get());
-      fflush(channel.get());
+      send(Value(msg).toJSONString().append("\n\n"));
   }
 
 
@@ -798,8 +823,7 @@ namespace vibes
      msg["shape"] = (params, "type", "group",
                              "name", name);
 
-     fputs(Value(msg).toJSONString().append("\n\n").c_str(), channel.get());
-     fflush(channel.get());
+     send(Value(msg).toJSONString().append("\n\n"));
   }
 
   void clearGroup(const std::string &figureName, const std::string &groupName)
@@ -810,8 +834,7 @@ namespace vibes
      msg["figure"] = figureName;
      msg["group"] = groupName;
 
-     fputs(Value(msg).toJSONString().append("\n\n").c_str(), channel.get());
-     fflush(channel.get());
+     send(Value(msg).toJSONString().append("\n\n"));
   }
 
   void clearGroup(const std::string &groupName)
@@ -828,8 +851,7 @@ namespace vibes
      msg["figure"] = figureName;
      msg["object"] = objectName;
 
-     fputs(Value(msg).toJSONString().append("\n\n").c_str(), channel.get());
-     fflush(channel.get());
+     send(Value(msg).toJSONString().append("\n\n"));
   }
 
   void removeObject(const std::string &objectName)
@@ -847,8 +869,7 @@ namespace vibes
      msg["figure"] = figureName;
      msg["properties"] = properties;
 
-     fputs(Value(msg).toJSONString().append("\n\n").c_str(), channel.get());
-     fflush(channel.get());
+     send(Value(msg).toJSONString().append("\n\n"));
   }
 
   void setFigureProperties(const Params &properties)
@@ -867,8 +888,7 @@ namespace vibes
      msg["object"] = objectName;
      msg["properties"] = properties;
 
-     fputs(Value(msg).toJSONString().append("\n\n").c_str(), channel.get());
-     fflush(channel.get());
+     send(Value(msg).toJSONString().append("\n\n"));
   }
 
   void setObjectProperties(const std::string &objectName, const Params &properties)
@@ -227,6 +227,20 @@ namespace vibes {
   /// Close connection to the viewer or the drawing file.
   void endDrawing();
 
+  /// Enable or disable the buffered mode. In this mode, the messages are accumulated
+  /// and written to the channel when the buffer is full, when the maximal delay since
+  /// the last write is reached, or when \c flush() is called. Disabling it flushes the buffer.
+  void setBuffering(bool enable);
+
+  /// Returns \c true if the buffered mode is enabled.
+  bool isBuffering();
+
+  /// Set the size (in bytes) and the delay (in seconds) from which the buffer is written.
+  void setBufferingLimits(std::size_t maxSize, double maxDelay);
+
+  /// Write the buffered messages to the channel.
+  void flush();
+
 
   /** @} */ // end of group connection
 
@@ -7,6 +7,7 @@
  *  \license    GNU Lesser General Public License (LGPL)
  */
 
+#include <optional>
 #include "codac2_Index.h"
 #include "codac2_Figure2D.h"
 #include "codac2_Figure2D_VIBes.h"
@@ -138,6 +139,49 @@ void Figure2D::set_tdomain(const Interval& tdomain)
   _tdomain = tdomain;
 }
 
+void Figure2D::set_lod_tolerance(double tolerance)
+{
+  assert_release(tolerance >= 0.);
+  _lod_tolerance = tolerance;
+}
+
+double Figure2D::lod_tolerance() const
+{
+  return _lod_tolerance;
+}
+
+size_t Figure2D::nb_lod_suppressed_shapes() const
+{
+  return _nb_lod_suppressed;
+}
+
+namespace
+{
+  // Size of the tolerance of the level of detail along the horizontal and vertical
+  // axes of the figure, or empty vector if the level of detail is not used
+  Vector lod_resolution(const Figure2D& fig)
+  {
+    if(fig.lod_tolerance() == 0.)
+      return Vector(0);
+
+    Vector r(2);
+    for(Index k = 0 ; k < 2 ; k++)
+    {
+      r[k] = fig.lod_tolerance()*fig.axes()[k].limits.diam()/fig.window_size()[k];
+      if(!(r[k] > 0.) || r[k] == oo) // unbounded or undefined limits
+        return Vector(0);
+    }
+
+    return r;
+  }
+
+  // True if the drawing of x stands within the tolerance of the level of detail
+  bool is_lod_negligible(const Figure2D& fig, const IntervalVector& x, const Vector& lod)
+  {
+    return lod.size() == 2 && x[fig.i()].diam() <= lod[0] && x[fig.j()].diam() <= lod[1];
+  }
+}
+
 void Figure2D::draw_point(const Vector& c, const StyleProperties& style)
 {
   assert_release(this->size() <= c.size());
@@ -445,13 +489,119 @@ void Figure2D::plot_trajectories(const SampledTraj<Vector>& x, const StyleProper
     plot_trajectory(xi,style);
 }
 
+namespace
+{
+  // The shapes drawn during the lifetime of this object are sent
+  // to the outputs as a single batch (see OutputFigure2D::begin_batch())
+  struct OutputBatch
+  {
+    OutputBatch(Figure2D& fig)
+      : _output_figures(fig.output_figures())
+    {
+      for(const auto& output_fig : _output_figures)
+        output_fig->begin_batch();
+    }
+
+    ~OutputBatch()
+    {
+      for(const auto& output_fig : _output_figures)
+        output_fig->end_batch();
+    }
+
+    vector<shared_ptr<OutputFigure2D>> _output_figures;
+  };
+}
+
+namespace
+{
+  bool same_color(const Color& c1, const Color& c2)
+  {
+    return c1.model() == c2.model() && (const std::array<float,4>&)c1 == (const std::array<float,4>&)c2;
+  }
+
+  bool same_style(const StyleProperties& s1, const StyleProperties& s2)
+  {
+    return same_color(s1.stroke_color,s2.stroke_color) && same_color(s1.fill_color,s2.fill_color)
+      && s1.line_style == s2.line_style && s1.line_width == s2.line_width
+      && s1.layer == s2.layer && s1.z_value == s2.z_value;
+  }
+}
+
 template<typename Func>
-void draw_tube_common(Figure2D& fig, const SlicedTube<IntervalVector>& x, int max_nb_slices_to_display, const Func& slice_color)
+size_t draw_tube_common(Figure2D& fig, const SlicedTube<IntervalVector>& x, int max_nb_slices_to_display, const Func& slice_color)
 {
+  OutputBatch batch(fig);
   const int n = x.nb_slices();
   auto tube_t0tf = x.tdomain()->t0_tf();
+  Vector lod = lod_resolution(fig);
+
+  if(lod.size() == 2)
+  {
+    // Consecutive slices of a same style are drawn as a single box (their hull), as long as
+    // the bounds of the hull are within the tolerance of the bounds of each slice of the group
+    struct Group
+    {
+      IntervalVector hull;
+      StyleProperties style;
+      std::array<double,2> lb_min, lb_max, ub_min, ub_max; // bounds of the slices, along the two axes
+    };
+
+    auto is_close = [&](const Group& g, const IntervalVector& y)
+    {
+      for(Index a = 0 ; a < 2 ; a++)
+      {
+        const Interval& ya = y[a == 0 ? fig.i() : fig.j()];
+        if(!(std::max(g.lb_max[a],ya.lb())-std::min(g.lb_min[a],ya.lb()) <= lod[a]
+          && std::max(g.ub_max[a],ya.ub())-std::min(g.ub_min[a],ya.ub()) <= lod[a]))
+          return false;
+      }
+      return true;
+    };
+
+    size_t nb_slices = 0, nb_drawn = 0;
+    std::optional<Group> h;
 
-  if(n < max_nb_slices_to_display)
+    for(auto it = x.tdomain()->rbegin(); it != x.tdomain()->rend(); ++it)
+    {
+      const IntervalVector& y = x.slice(it)->codomain();
+      if(y.is_empty())
+        continue;
+
+      nb_slices++;
+      auto c = slice_color(tube_t0tf,it);
+
+      if(!(h && same_style(h->style,c) && is_close(*h,y)))
+      {
+        if(h)
+        {
+          fig.draw_box(h->hull, h->style);
+          nb_drawn++;
+        }
+
+        h = Group { IntervalVector::empty(y.size()), c, { oo,oo }, { -oo,-oo }, { oo,oo }, { -oo,-oo } };
+      }
+
+      h->hull |= y;
+      for(Index a = 0 ; a < 2 ; a++)
+      {
+        const Interval& ya = y[a == 0 ? fig.i() : fig.j()];
+        h->lb_min[a] = std::min(h->lb_min[a],ya.lb());
+        h->lb_max[a] = std::max(h->lb_max[a],ya.lb());
+        h->ub_min[a] = std::min(h->ub_min[a],ya.ub());
+        h->ub_max[a] = std::max(h->ub_max[a],ya.ub());
+      }
+    }
+
+    if(h)
+    {
+      fig.draw_box(h->hull, h->style);
+      nb_drawn++;
+    }
+
+    return nb_slices-nb_drawn;
+  }
+
+  else if(n < max_nb_slices_to_display)
     for(auto it = x.tdomain()->rbegin(); it != x.tdomain()->rend(); ++it)
     {
       auto c = slice_color(tube_t0tf,it);
@@ -477,11 +627,13 @@ void draw_tube_common(Figure2D& fig, const SlicedTube<IntervalVector>& x, int ma
       }
     }
   }
+
+  return 0;
 }
 
 void Figure2D::draw_tube(const SlicedTube<IntervalVector>& x, const StyleProperties& style, int max_nb_slices_to_display)
 {
-  draw_tube_common(*this, x, max_nb_slices_to_display,
+  _nb_lod_suppressed = draw_tube_common(*this, x, max_nb_slices_to_display,
     [&style]([[maybe_unused]] const Interval& tube_t0tf, [[maybe_unused]] std::list<TSlice>::reverse_iterator it) {
       return style;
     });
@@ -489,7 +641,7 @@ void Figure2D::draw_tube(const SlicedTube<IntervalVector>& x, const StylePropert
 
 void Figure2D::draw_tube(const SlicedTube<IntervalVector>& x, const StyleGradientProperties& style, int max_nb_slices_to_display)
 {
-  draw_tube_common(*this, x, max_nb_slices_to_display,
+  _nb_lod_suppressed = draw_tube_common(*this, x, max_nb_slices_to_display,
     [&style](const Interval& tube_t0tf, std::list<TSlice>::reverse_iterator it) {
       auto c = style.cmap.color((it->mid()-tube_t0tf.lb())/tube_t0tf.diam());
       return StyleProperties({c,c}, style.layer, style.line_style, "w:"+to_string(style.line_width), "z:"+to_string(style.z_value));
@@ -503,6 +655,7 @@ void plot_tube_common(Figure2D& fig, const SlicedTube<Interval>& x, const StyleP
   for(const auto& output_fig : fig.output_figures())
     output_fig->update_axes();
 
+  OutputBatch batch(fig);
   for(auto it = x.tdomain()->begin() ; it != x.tdomain()->end() ; it++)
   {
     if(!it->is_gate())
@@ -592,65 +745,203 @@ void Figure2D::draw_raster(const std::string& filename, const IntervalVector& bb
     output_fig->draw_raster(filename,bbox,style);
 }
 
-void Figure2D::draw_paving(const PavingOut& p, const PavingStyle& style)
+namespace
 {
-  draw_paving(p, cartesian_drawing(), style);
-}
+  // The drawing of pavings is generic with respect to the node representation
+  // (PavingNode shared pointers or CompactPavingNode handles)
 
-void Figure2D::draw_paving(const PavingOut& p,
-  const function<void(Figure2D&,const IntervalVector&,const StyleProperties&)>& draw_box_,
-  const PavingStyle& style)
-{
-  p.tree()->left()->visit([&]
-    (shared_ptr<const PavingOut_Node> n)
+  // Level of detail: a subtree whose drawing stands within the tolerance is drawn as a single box
+  // (its region, with the style of the boundary if the subtree contains boundary boxes)
+
+  template<typename P>
+  size_t draw_paving_out(Figure2D& fig, const P& p,
+    const function<void(Figure2D&,const IntervalVector&,const StyleProperties&)>& draw_box_,
+    const PavingStyle& style, const Vector& lod = Vector(0))
+  {
+    OutputBatch batch(fig);
+    size_t nb_suppressed = 0;
+
+    // Region of the figure covered by the drawing of the subtree of n
+    auto region = [&p](const auto& n) -> IntervalVector
     {
-      const IntervalVector& outer = get<0>(n->boxes());
+      auto b = get<0>(n->top()->boxes()).bisect_largest();
+      return n->top()->left() == n ? b.first : b.second;
+    };
+
+    p.tree()->left()->visit([&]
+      (const auto& n)
+      {
+        auto&& n_boxes = n->boxes();
+        const IntervalVector& outer = get<0>(n_boxes);
+
+        if(n->top() == p.tree())
+          draw_box_(fig, get<0>(n->top()->boxes()), style.outside);
+
+        else
+        {
+          IntervalVector hull = region(n);
+
+          if(is_lod_negligible(fig, hull, lod))
+          {
+            size_t nb_boxes = 0;
+            bool boundary = false;
+
+            n->visit([&](const auto& m)
+            {
+              const IntervalVector& m_outer = get<0>(m->boxes());
+              for(const auto& bi : region(m).diff(m_outer))
+                nb_boxes += !bi.is_empty();
+              if(m->is_leaf() && !m_outer.is_empty())
+              {
+                nb_boxes++;
+                boundary = true;
+              }
+              return true;
+            });
+
+            if(nb_boxes > 1)
+            {
+              draw_box_(fig, hull, boundary ? style.boundary : style.outside);
+              nb_suppressed += nb_boxes-1;
+              return false;
+            }
+          }
+
+          for(const auto& bi : hull.diff(outer))
+            draw_box_(fig, bi, style.outside);
+        }
+
+        if(n->is_leaf())
+          draw_box_(fig, outer, style.boundary);
+
+        return true;
+      });
+
+    return nb_suppressed;
+  }
 
-      if(n->top() == p.tree())
-        draw_box_(*this, get<0>(n->top()->boxes()), style.outside);
+  template<typename P>
+  size_t draw_paving_inout(Figure2D& fig, const P& p,
+    const function<void(Figure2D&,const IntervalVector&,const StyleProperties&)>& draw_box_,
+    const PavingStyle& style, const Vector& lod = Vector(0))
+  {
+    OutputBatch batch(fig);
+    size_t nb_suppressed = 0;
 
-      else
+    p.tree()->visit([&]
+      (const auto& n)
       {
-        auto b = get<0>(n->top()->boxes()).bisect_largest();
-        IntervalVector hull = n->top()->left() == n ? b.first : b.second;
+        auto&& n_boxes = n->boxes();
+        const IntervalVector& outer = get<0>(n_boxes);
+        const IntervalVector& inner = get<1>(n_boxes);
+
+        IntervalVector hull = inner | outer;
+
+        if(is_lod_negligible(fig, hull, lod))
+        {
+          size_t nb_boxes = 0;
+          bool has_inside = false, has_outside = false, has_boundary = false;
+
+          n->visit([&](const auto& m)
+          {
+            auto&& m_boxes = m->boxes();
+            const IntervalVector& m_outer = get<0>(m_boxes);
+            const IntervalVector& m_inner = get<1>(m_boxes);
+            IntervalVector m_hull = m_inner | m_outer;
+
+            for(const auto& bi : m_hull.diff(m_inner))
+              if(!bi.is_empty())
+              {
+                nb_boxes++;
+                has_inside = true;
+              }
+
+            for(const auto& bi : m_hull.diff(m_outer))
+              if(!bi.is_empty())
+              {
+                nb_boxes++;
+                has_outside = true;
+              }
+
+            if(m->is_leaf() && !(m_inner & m_outer).is_empty())
+            {
+              nb_boxes++;
+              has_boundary = true;
+            }
+
+            return true;
+          });
+
+          if(nb_boxes > 1)
+          {
+            draw_box_(fig, hull,
+              has_boundary || (has_inside && has_outside) ? style.boundary
+                : (has_inside ? style.inside : style.outside));
+            nb_suppressed += nb_boxes-1;
+            return false;
+          }
+        }
+
+        for(const auto& bi : hull.diff(inner))
+          draw_box_(fig, bi, style.inside);
 
         for(const auto& bi : hull.diff(outer))
-          draw_box_(*this, bi, style.outside);
-      }
+          draw_box_(fig, bi, style.outside);
 
-      if(n->is_leaf())
-        draw_box_(*this, outer, style.boundary);
+        if(n->is_leaf())
+            draw_box_(fig, inner & outer, style.boundary);
 
-      return true;
-    });
+        return true;
+      });
+
+    return nb_suppressed;
+  }
+}
+
+void Figure2D::draw_paving(const PavingOut& p, const PavingStyle& style)
+{
+  _nb_lod_suppressed = draw_paving_out(*this, p, cartesian_drawing(), style, lod_resolution(*this));
+}
+
+void Figure2D::draw_paving(const PavingOut& p,
+  const function<void(Figure2D&,const IntervalVector&,const StyleProperties&)>& draw_box_,
+  const PavingStyle& style)
+{
+  _nb_lod_suppressed = draw_paving_out(*this, p, draw_box_, style);
 }
 
 void Figure2D::draw_paving(const PavingInOut& p, const PavingStyle& style)
 {
-  draw_paving(p, cartesian_drawing(), style);
+  _nb_lod_suppressed = draw_paving_inout(*this, p, cartesian_drawing(), style, lod_resolution(*this));
 }
 
 void Figure2D::draw_paving(const PavingInOut& p,
   const function<void(Figure2D&,const IntervalVector&,const StyleProperties&)>& draw_box_,
   const PavingStyle& style)
 {
-  p.tree()->visit([&]
-    (shared_ptr<const PavingInOut_Node> n)
-    {
-      const IntervalVector& outer = get<0>(n->boxes());
-      const IntervalVector& inner = get<1>(n->boxes());
-
-      IntervalVector hull = inner | outer;
+  _nb_lod_suppressed = draw_paving_inout(*this, p, draw_box_, style);
+}
 
-      for(const auto& bi : hull.diff(inner))
-        draw_box_(*this, bi, style.inside);
+void Figure2D::draw_paving(const CompactPavingOut& p, const PavingStyle& style)
+{
+  _nb_lod_suppressed = draw_paving_out(*this, p, cartesian_drawing(), style, lod_resolution(*this));
+}
 
-      for(const auto& bi : hull.diff(outer))
-        draw_box_(*this, bi, style.outside);
+void Figure2D::draw_paving(const CompactPavingOut& p,
+  const function<void(Figure2D&,const IntervalVector&,const StyleProperties&)>& draw_box_,
+  const PavingStyle& style)
+{
+  _nb_lod_suppressed = draw_paving_out(*this, p, draw_box_, style);
+}
 
-      if(n->is_leaf())
-          draw_box_(*this, inner & outer, style.boundary);
+void Figure2D::draw_paving(const CompactPavingInOut& p, const PavingStyle& style)
+{
+  _nb_lod_suppressed = draw_paving_inout(*this, p, cartesian_drawing(), style, lod_resolution(*this));
+}
 
-      return true;
-    });
+void Figure2D::draw_paving(const CompactPavingInOut& p,
+  const function<void(Figure2D&,const IntervalVector&,const StyleProperties&)>& draw_box_,
+  const PavingStyle& style)
+{
+  _nb_lod_suppressed = draw_paving_inout(*this, p, draw_box_, style);
 }
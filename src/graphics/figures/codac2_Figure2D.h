@@ -16,6 +16,7 @@
 #include "codac2_Figure2DInterface.h"
 #include "codac2_OutputFigure2D.h"
 #include "codac2_Paving.h"
+#include "codac2_CompactPaving.h"
 #include "codac2_Parallelepiped.h"
 #include "codac2_Zonotope.h"
 #include "codac2_PavingStyle.h"
@@ -207,6 +208,34 @@ namespace codac2
        */
       void set_tdomain(const Interval& tdomain);
 
+      /**
+       * \brief Setter for the tolerance (in pixels) of the level of detail used for drawing pavings and tubes
+       * 
+       * When the tolerance is positive, the subtrees of a paving whose drawings stand in a region
+       * smaller than the tolerance are drawn as a single box, and so are the consecutive slices of a
+       * tube sharing a same style, when the bounds of their hull are within the tolerance of the bounds
+       * of each slice. The size of a pixel is computed from the limits of the axes and from the size of
+       * the window. Pavings drawn with a custom drawing function are not concerned.
+       * 
+       * \param tolerance The tolerance in pixels, ``0`` (default) for drawing all the boxes
+       */
+      void set_lod_tolerance(double tolerance);
+
+      /**
+       * \brief Getter for the tolerance (in pixels) of the level of detail
+       * 
+       * \return The tolerance, ``0`` if the level of detail is disabled
+       */
+      double lod_tolerance() const;
+
+      /**
+       * \brief Number of shapes not drawn because of the level of detail, during the
+       * last drawing of a paving or of a tube
+       * 
+       * \return The number of suppressed shapes
+       */
+      size_t nb_lod_suppressed_shapes() const;
+
       // Geometric shapes
 
       /**
@@ -402,6 +431,8 @@ namespace codac2
        * rectangular slices are merged by groups into convex polygons.  
        * This reduces visual clutter and improves rendering efficiency while 
        * preserving the overall shape of the tube.
+       * If a level of detail is set (see ``set_lod_tolerance()``), it is used instead
+       * of this grouping.
        *
        * \param x SlicedTube to draw.
        * \param style Style properties used for drawing the tube.
@@ -417,6 +448,8 @@ namespace codac2
        * rectangular slices are merged by groups into convex polygons.  
        * This reduces visual clutter and improves rendering efficiency while 
        * preserving the overall shape of the tube.
+       * If a level of detail is set (see ``set_lod_tolerance()``), it is used instead
+       * of this grouping.
        *
        * \param x SlicedTube to draw.
        * \param style StyleGradientProperties to use
@@ -534,6 +567,46 @@ namespace codac2
         const std::function<void(Figure2D&,const IntervalVector&,const StyleProperties&)>& draw_box,
         const PavingStyle& style = PavingStyle::default_style());
 
+      /**
+       * \brief Draws a previously computed compact paving (outer approximation) on the figure
+       * 
+       * \param p CompactPavingOut to draw (result of a paving with contractors)
+       * \param style ``PavingStyle`` for the drawing
+       */
+      void draw_paving(const CompactPavingOut& p,
+        const PavingStyle& style = PavingStyle::default_style());
+
+      /**
+       * \brief Draws a previously computed compact paving (outer approximation) on the figure
+       * 
+       * \param p CompactPavingOut to draw (result of a paving with contractors)
+       * \param draw_box Custom drawing function (for instance, if one wants to draw in polar coordinates)
+       * \param style ``PavingStyle`` for the drawing
+       */
+      void draw_paving(const CompactPavingOut& p,
+        const std::function<void(Figure2D&,const IntervalVector&,const StyleProperties&)>& draw_box,
+        const PavingStyle& style = PavingStyle::default_style());
+
+      /**
+       * \brief Draws a previously computed compact paving (inner/outer approximation) on the figure
+       * 
+       * \param p CompactPavingInOut to draw (result of a paving with separators)
+       * \param style ``PavingStyle`` for the drawing
+       */
+      void draw_paving(const CompactPavingInOut& p,
+        const PavingStyle& style = PavingStyle::default_style());
+
+      /**
+       * \brief Draws a previously computed compact paving (inner/outer approximation) on the figure
+       * 
+       * \param p CompactPavingInOut to draw (result of a paving with separators)
+       * \param draw_box Custom drawing function (for instance, if one wants to draw in polar coordinates)
+       * \param style ``PavingStyle`` for the drawing
+       */
+      void draw_paving(const CompactPavingInOut& p,
+        const std::function<void(Figure2D&,const IntervalVector&,const StyleProperties&)>& draw_box,
+        const PavingStyle& style = PavingStyle::default_style());
+
       /**
        * \brief Draws a paving from a contractor while it is being computed
        * 
@@ -610,6 +683,8 @@ namespace codac2
       std::vector<FigureAxis> _axes { axis(0,{0,1}), axis(1,{0,1}) };
       std::vector<std::shared_ptr<OutputFigure2D>> _output_figures;
       Interval _tdomain;
+      double _lod_tolerance = 0.;
+      size_t _nb_lod_suppressed = 0;
 
       friend DefaultFigure;
   };
@@ -1147,6 +1222,66 @@ namespace codac2
         selected_fig()->draw_paving(p, draw_box, style);
       }
 
+      /**
+       * \brief Draws a previously computed compact paving (outer approximation) on the figure
+       * 
+       * \param p CompactPavingOut to draw (result of a paving with contractors)
+       * \param style ``PavingStyle`` for the drawing
+       */
+      static void draw_paving(const CompactPavingOut& p,
+        const PavingStyle& style = PavingStyle::default_style())
+      {
+        if(auto_init())
+          init_axes_paving(p.tree()->hull());
+        selected_fig()->draw_paving(p, style);
+      }
+
+      /**
+       * \brief Draws a previously computed compact paving (outer approximation) on the figure
+       * 
+       * \param p CompactPavingOut to draw (result of a paving with contractors)
+       * \param draw_box Custom drawing function (for instance, if one wants to draw in polar coordinates)
+       * \param style ``PavingStyle`` for the drawing
+       */
+      static void draw_paving(const CompactPavingOut& p,
+        const std::function<void(Figure2D&,const IntervalVector&,const StyleProperties&)>& draw_box,
+        const PavingStyle& style = PavingStyle::default_style())
+      {
+        if(auto_init())
+          init_axes_paving(p.tree()->hull());
+        selected_fig()->draw_paving(p, draw_box, style);
+      }
+
+      /**
+       * \brief Draws a previously computed compact paving (inner/outer approximation) on the figure
+       * 
+       * \param p CompactPavingInOut to draw (result of a paving with separators)
+       * \param style ``PavingStyle`` for the drawing
+       */
+      static void draw_paving(const CompactPavingInOut& p,
+        const PavingStyle& style = PavingStyle::default_style())
+      {
+        if(auto_init())
+          init_axes_paving(p.tree()->hull());
+        selected_fig()->draw_paving(p, style);
+      }
+
+      /**
+       * \brief Draws a previously computed compact paving (inner/outer approximation) on the figure
+       * 
+       * \param p CompactPavingInOut to draw (result of a paving with separators)
+       * \param draw_box Custom drawing function (for instance, if one wants to draw in polar coordinates)
+       * \param style ``PavingStyle`` for the drawing
+       */
+      static void draw_paving(const CompactPavingInOut& p,
+        const std::function<void(Figure2D&,const IntervalVector&,const StyleProperties&)>& draw_box,
+        const PavingStyle& style = PavingStyle::default_style())
+      {
+        if(auto_init())
+          init_axes_paving(p.tree()->hull());
+        selected_fig()->draw_paving(p, draw_box, style);
+      }
+
       /**
        * \brief Draws a paving from a contractor while it is being computed
        * 
@@ -74,6 +74,21 @@ namespace codac2
        */
       virtual void clear() = 0;
 
+      /**
+       * \brief Starts a sequence of drawings that may be sent to the output at once
+       * 
+       * Sequences can be nested: the drawings are sent when the outermost sequence ends.
+       * This has no effect by default.
+       */
+      virtual void begin_batch()
+      { }
+
+      /**
+       * \brief Ends a sequence of drawings started with ``begin_batch()``
+       */
+      virtual void end_batch()
+      { }
+
     protected:
 
       const Figure2D& _fig;
@@ -39,4 +39,12 @@ TEST_CASE("OctaSym as operator")
   CHECK(f.eval(IntervalVector({{1},{2},{3}})) == IntervalVector({{6},{2},{-4}}));
   CHECK(f.eval(IntervalVector({{-oo,oo},{-oo,oo},{-oo,oo}})) == IntervalVector(3));
   CHECK(f.eval(IntervalVector::empty(3)) == IntervalVector::empty(3));
+
+  // Same symmetries on the same operand are shared in the compiled expression
+  OctaSym b({1,3,-2});
+  AnalyticFunction g1({x}, a(x)+a(x)), g2({x}, a(x)+b(x));
+  CHECK(g1.tape().nb_steps() == 2); // a(x), +
+  CHECK(g2.tape().nb_steps() == 3); // a(x), b(x), +
+  CHECK(g1.eval(IntervalVector({{1},{2},{3}})) == IntervalVector({{6},{2},{-4}}));
+  CHECK(g2.eval(IntervalVector({{1},{2},{3}})) == IntervalVector({{4},{4},{-4}}));
 }
\ No newline at end of file
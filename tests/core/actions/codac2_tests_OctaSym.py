@@ -37,5 +37,10 @@ class TestOctaSym(unittest.TestCase):
     self.assertTrue(f.eval(IntervalVector([[-oo,oo],[-oo,oo],[-oo,oo]])) == IntervalVector(3))
     self.assertTrue(f.eval(IntervalVector.empty(3)) == IntervalVector.empty(3))
 
+    # Different symmetries on the same operand are not shared in the compiled expression
+    b = OctaSym([1,3,-2])
+    g = AnalyticFunction([x], a(x)+b(x))
+    self.assertTrue(g.eval(IntervalVector([[1],[2],[3]])) == IntervalVector([[4],[4],[-4]]))
+
 if __name__ ==  '__main__':
   unittest.main()
\ No newline at end of file
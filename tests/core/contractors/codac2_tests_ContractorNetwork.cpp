@@ -0,0 +1,130 @@
+/** 
+ *  Codac tests
+ * ----------------------------------------------------------------------------
+ *  \date       2025
+ *  \author     Simon Rohou
+ *  \copyright  Copyright 2025 Codac Team
+ *  \license    GNU Lesser General Public License (LGPL)
+ */
+
+#include <catch2/catch_test_macros.hpp>
+#include <codac2_ContractorNetwork.h>
+#include <codac2_CtcInverse.h>
+#include <codac2_Approx.h>
+
+using namespace std;
+using namespace codac2;
+
+TEST_CASE("ContractorNetwork")
+{
+  VectorVar a(2);
+  AnalyticFunction f { {a}, a[0]-a[1] };
+  CtcInverse c_eq(f, Interval(0.));
+
+  ScalarVar s;
+  AnalyticFunction g { {s}, s };
+  CtcInverse<Interval,Interval> c_y(g, Interval(2,3));
+
+  IntervalVector x({{0,1},{0.5,2},{-1,0.8}});
+  Interval y(0,10);
+
+  ContractorNetwork cn;
+  size_t c01 = cn.add(c_eq, cn.subvector(x,0,1));
+  size_t c12 = cn.add(c_eq, cn.subvector(x,1,2));
+  size_t cy = cn.add(c_y, y);
+  CHECK(cn.nb_ctc() == 3);
+  CHECK(cn.nb_dom() == 3);
+
+  cn.contract();
+  CHECK(Approx(x) == IntervalVector({{0.5,0.8},{0.5,0.8},{0.5,0.8}}));
+  CHECK(Approx(y) == Interval(2,3));
+  CHECK(cn.stats(c01).nb_calls == 2);
+  CHECK(cn.stats(c12).nb_calls == 2);
+  CHECK(cn.stats(cy).nb_calls == 1);
+  CHECK(cn.stats(cy).time >= 0.);
+
+  // Incremental addition: only the dependent contractors are called again
+  VectorVar b(1);
+  AnalyticFunction h { {b}, b[0] };
+  size_t c2 = cn.add(CtcInverse(h, Interval(0.7,oo)), cn.subvector(x,2,2));
+  CHECK(cn.nb_dom() == 4);
+
+  cn.contract();
+  CHECK(Approx(x) == IntervalVector({{0.7,0.8},{0.7,0.8},{0.7,0.8}}));
+  CHECK(cn.stats(c2).nb_calls >= 1);
+  CHECK(cn.stats(cy).nb_calls == 1);
+
+  // Nothing to propagate
+  size_t n = cn.stats(c01).nb_calls + cn.stats(c12).nb_calls + cn.stats(c2).nb_calls;
+  cn.contract();
+  CHECK(cn.stats(c01).nb_calls + cn.stats(c12).nb_calls + cn.stats(c2).nb_calls == n);
+
+  cn.trigger_all_contractors();
+  cn.contract();
+  CHECK(cn.stats(cy).nb_calls == 2);
+  CHECK(Approx(x) == IntervalVector({{0.7,0.8},{0.7,0.8},{0.7,0.8}}));
+
+  // Emptiness
+  cn.add(CtcInverse(h, Interval(5,6)), cn.subvector(x,0,0));
+  cn.contract();
+  CHECK(x[0].is_empty());
+}
+
+TEST_CASE("ContractorNetwork - dependencies")
+{
+  ScalarVar u, v;
+  AnalyticFunction f { {u,v}, u-v };
+  CtcInverse<Interval,Interval,Interval> c_eq(f, Interval(0.));
+
+  // Whole vector and subvectors sharing components are dependent
+  IntervalVector x({{0,10},{-5,5},{-oo,oo}});
+
+  VectorVar a(3);
+  AnalyticFunction g { {a}, a[0]+a[1] };
+  CtcInverse c_sum(g, Interval(0,1));
+
+  ContractorNetwork cn;
+  size_t c_x = cn.add(c_sum, x);
+  size_t c_01 = cn.add(c_eq, x[0], x[1]);
+  size_t c_12 = cn.add(c_eq, x[1], x[2]);
+  cn.contract();
+
+  CHECK(Approx(x) == IntervalVector({{0,1},{0,1},{0,1}}));
+  CHECK(cn.stats(c_x).nb_calls >= 1);
+  CHECK(cn.stats(c_01).nb_calls >= 1);
+  CHECK(cn.stats(c_12).nb_calls >= 1);
+
+  // Procedure with explicit read and written domains
+  Interval z;
+  size_t c_z = cn.add([&]() { z &= x[2]+1.; }, { x[2] }, { z });
+  cn.contract();
+  CHECK(Approx(z) == Interval(1,2));
+  CHECK(cn.stats(c_z).nb_calls == 1);
+
+  cn.add(CtcInverse<Interval,Interval>(AnalyticFunction({u}, u), Interval(0.25,oo)), x[2]);
+  cn.contract();
+  CHECK(Approx(x) == IntervalVector({{0.25,0.75},{0.25,0.75},{0.25,0.75}}));
+  CHECK(Approx(z) == Interval(1.25,1.75));
+  CHECK(cn.stats(c_z).nb_calls == 3);
+}
+
+TEST_CASE("ContractorNetwork - tubes")
+{
+  auto tdomain = create_tdomain(Interval(0,10), 1.);
+  SlicedTube x(tdomain, Interval(-10,10));
+  SlicedTube y(tdomain, Interval(0,1));
+
+  ScalarVar u, v;
+  AnalyticFunction f { {u,v}, u-v };
+  CtcInverse<Interval,Interval,Interval> c_eq(f, Interval(0.));
+
+  ContractorNetwork cn;
+  cn.add(c_eq, x, y);
+
+  Interval z;
+  cn.add([&]() { z &= x.codomain(); }, { x }, { z });
+  cn.contract();
+
+  CHECK(Approx(x.codomain()) == Interval(0,1));
+  CHECK(Approx(z) == Interval(0,1));
+}
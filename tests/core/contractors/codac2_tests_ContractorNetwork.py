@@ -0,0 +1,78 @@
+#!/usr/bin/env python
+
+#  Codac tests
+# ----------------------------------------------------------------------------
+#  \date       2025
+#  \author     Simon Rohou
+#  \copyright  Copyright 2025 Codac Team
+#  \license    GNU Lesser General Public License (LGPL)
+
+import unittest
+from codac import *
+
+class TestContractorNetwork(unittest.TestCase):
+
+  def test_ContractorNetwork(self):
+
+    a = VectorVar(2)
+    f = AnalyticFunction([a], a[0]-a[1])
+    c_eq = CtcInverse(f, 0)
+
+    b = VectorVar(1)
+    g = AnalyticFunction([b], b[0])
+
+    x = IntervalVector([[0,1],[0.5,2],[-1,0.8]])
+    y = IntervalVector([[0,10]])
+
+    cn = ContractorNetwork()
+    c01 = cn.add(c_eq, cn.subvector(x,0,1))
+    c12 = cn.add(c_eq, cn.subvector(x,1,2))
+    cy = cn.add(CtcInverse(g, Interval(2,3)), y)
+    self.assertTrue(cn.nb_ctc() == 3)
+    self.assertTrue(cn.nb_dom() == 3)
+
+    cn.contract()
+    self.assertTrue(Approx(x) == IntervalVector([[0.5,0.8],[0.5,0.8],[0.5,0.8]]))
+    self.assertTrue(Approx(y) == IntervalVector([[2,3]]))
+    self.assertTrue(cn.stats(c01).nb_calls == 2)
+    self.assertTrue(cn.stats(c12).nb_calls == 2)
+    self.assertTrue(cn.stats(cy).nb_calls == 1)
+
+    # Incremental addition: only the dependent contractors are called again
+    cn.add(CtcInverse(g, Interval(0.7,oo)), cn.subvector(x,2,2))
+    cn.contract()
+    self.assertTrue(Approx(x) == IntervalVector([[0.7,0.8],[0.7,0.8],[0.7,0.8]]))
+    self.assertTrue(cn.stats(cy).nb_calls == 1)
+
+    # Emptiness
+    cn.add(CtcInverse(g, Interval(5,6)), cn.subvector(x,0,0))
+    cn.contract()
+    self.assertTrue(x[0].is_empty())
+
+  def test_ContractorNetwork_several_domains(self):
+
+    a = VectorVar(2)
+    f = AnalyticFunction([a], a[0]-a[1])
+    c_eq = CtcInverse(f, 0)
+
+    x = IntervalVector([[0,1]])
+    y = IntervalVector([[0.5,2],[-1,0.8]])
+    z = IntervalVector([[-oo,oo]])
+
+    def c_z():
+      z[0] = z[0] & (y[1]+1)
+
+    cn = ContractorNetwork()
+    c_xy = cn.add(c_eq, x, cn.subvector(y,0,0)) # applied on the Cartesian product of the domains
+    c_y = cn.add(c_eq, y)
+    cz = cn.add(c_z, [cn.subvector(y,1,1)], [z])
+    self.assertTrue(cn.nb_ctc() == 3)
+
+    cn.contract()
+    self.assertTrue(Approx(x) == IntervalVector([[0.5,0.8]]))
+    self.assertTrue(Approx(y) == IntervalVector([[0.5,0.8],[0.5,0.8]]))
+    self.assertTrue(Approx(z) == IntervalVector([[1.5,1.8]]))
+    self.assertTrue(cn.stats(cz).nb_calls >= 1)
+
+if __name__ ==  '__main__':
+  unittest.main()
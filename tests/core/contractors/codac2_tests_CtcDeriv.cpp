@@ -9,6 +9,7 @@
 
 #include <catch2/catch_test_macros.hpp>
 #include <codac2_CtcDeriv.h>
+#include <codac2_CtcWrapper.h>
 #include <codac2_SlicedTube.h>
 #include <codac2_Approx.h>
 #include <iomanip>
@@ -464,4 +465,67 @@ TEST_CASE("CtcDeriv")
     CHECK(sx->operator()(Interval(1), *sv) == Interval(-1));
     CHECK(sx->operator()(Interval(-1,3), *sv) == Interval(-3,1));
   }
-}
\ No newline at end of file
+
+  SECTION("Incremental contraction")
+  {
+    auto tdomain = create_tdomain({0,10}, 0.5, true);
+    SlicedTube x(tdomain, Interval(-10,10)), v(tdomain, Interval(-1,1));
+    x.set(Interval(0), 0.);
+    SlicedTube x_full(x);
+
+    CtcDeriv ctc_deriv;
+    ctc_deriv.contract(x_full,v);
+    CHECK(ctc_deriv.contract_incremental(x,v) == 20); // all the slices are new
+    CHECK(x == x_full);
+    CHECK(Approx(x(4.),1e-10) == Interval(-4,4));
+    CHECK(x(10.) == Interval(-10,10));
+    CHECK(ctc_deriv.contract_incremental(x,v) == 0); // nothing modified since
+
+    x.set(Interval(1), 5.);
+    x_full.set(Interval(1), 5.);
+    ctc_deriv.contract(x_full,v);
+    // The contraction dies out backward at t=2, and goes forward up to t=10
+    CHECK(ctc_deriv.contract_incremental(x,v) == 16);
+    CHECK(x == x_full);
+    CHECK(Approx(x(1.),1e-10) == Interval(-1,1));
+    CHECK(Approx(x(3.),1e-10) == Interval(-1,3));
+    CHECK(Approx(x(10.),1e-10) == Interval(-4,6));
+    CHECK(ctc_deriv.contract_incremental(x,v) == 0);
+
+    // Slices contracted by other contractors are also propagated
+    CtcWrapper c(Interval(-3,5));
+    c.contract_tube(x);
+    c.contract_tube(x_full);
+    ctc_deriv.contract(x_full,v);
+    CHECK(ctc_deriv.contract_incremental(x,v) > 0);
+    CHECK(x == x_full);
+    CHECK(Approx(x(10.),1e-10) == Interval(-3,5));
+    CHECK(ctc_deriv.contract_incremental(x,v) == 0);
+    c.contract_tube(x); // no contraction
+    CHECK(ctc_deriv.contract_incremental(x,v) == 0);
+  }
+
+  SECTION("Parallel contraction")
+  {
+    auto tdomain = create_tdomain({0,10}, 0.01, true);
+    SlicedTube x(tdomain, Interval(-10,10)), v(tdomain, Interval(-1,1));
+    x.set(Interval(0), 0.);
+    x.set(Interval(1), 5.);
+    x.set(Interval(-1,0), 8.);
+
+    CtcDeriv ctc_deriv;
+    SlicedTube x_ser(x);
+    ctc_deriv.contract(x_ser,v);
+
+    for(size_t n : { 1,2,4 })
+    {
+      SlicedTube x_par(x);
+      ctc_deriv.parallel_contract(x_par,v,n);
+      CHECK(Approx(x_par(4.),1e-10) == Interval(0,2));
+      CHECK(Approx(x_par(10.),1e-10) == Interval(-3,2));
+      CHECK(Approx(x_par.codomain(),1e-10) == x_ser.codomain());
+      for(const auto& t : { 0.5,2.,6.3,8.5,9.99 })
+        CHECK(Approx(x_par(t),1e-10) == x_ser(t));
+    }
+  }
+}
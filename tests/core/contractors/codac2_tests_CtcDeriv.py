@@ -430,5 +430,54 @@ class TestCtcDeriv(unittest.TestCase):
     self.assertTrue(sx(Interval(-1,3), sv) == Interval(-3,1))
 
 
+  def test_CtcDeriv_incremental(self):
+
+    tdomain = create_tdomain([0,10], 0.5, True)
+    x = SlicedTube(tdomain, Interval(-10,10))
+    v = SlicedTube(tdomain, Interval(-1,1))
+    x.set(Interval(0), 0.)
+    x_full = SlicedTube(x)
+
+    ctc_deriv = CtcDeriv()
+    ctc_deriv.contract(x_full,v)
+    self.assertTrue(ctc_deriv.contract_incremental(x,v) == 20) # all the slices are new
+    self.assertTrue(x == x_full)
+    self.assertTrue(Approx(x(4.),1e-10) == Interval(-4,4))
+    self.assertTrue(x(10.) == Interval(-10,10))
+    self.assertTrue(ctc_deriv.contract_incremental(x,v) == 0) # nothing modified since
+
+    x.set(Interval(1), 5.)
+    x_full.set(Interval(1), 5.)
+    ctc_deriv.contract(x_full,v)
+    # The contraction dies out backward at t=2, and goes forward up to t=10
+    self.assertTrue(ctc_deriv.contract_incremental(x,v) == 16)
+    self.assertTrue(x == x_full)
+    self.assertTrue(Approx(x(1.),1e-10) == Interval(-1,1))
+    self.assertTrue(Approx(x(3.),1e-10) == Interval(-1,3))
+    self.assertTrue(Approx(x(10.),1e-10) == Interval(-4,6))
+    self.assertTrue(ctc_deriv.contract_incremental(x,v) == 0)
+
+  def test_CtcDeriv_parallel(self):
+
+    tdomain = create_tdomain([0,10], 0.01, True)
+    x = SlicedTube(tdomain, Interval(-10,10))
+    v = SlicedTube(tdomain, Interval(-1,1))
+    x.set(Interval(0), 0.)
+    x.set(Interval(1), 5.)
+    x.set(Interval(-1,0), 8.)
+
+    ctc_deriv = CtcDeriv()
+    x_ser = SlicedTube(x)
+    ctc_deriv.contract(x_ser,v)
+
+    for n in [1,2,4]:
+      x_par = SlicedTube(x)
+      ctc_deriv.parallel_contract(x_par,v,n)
+      self.assertTrue(Approx(x_par(4.),1e-10) == Interval(0,2))
+      self.assertTrue(Approx(x_par(10.),1e-10) == Interval(-3,2))
+      self.assertTrue(Approx(x_par.codomain(),1e-10) == x_ser.codomain())
+      for t in [0.5,2.,6.3,8.5,9.99]:
+        self.assertTrue(Approx(x_par(t),1e-10) == x_ser(t))
+
 if __name__ ==  '__main__':
   unittest.main()
\ No newline at end of file
@@ -213,4 +213,23 @@ TEST_CASE("CtcEval")
     CHECK(Approx(yi) == Interval(-1.1,-1));
     CHECK(Approx(x(17.27),1e-5) == Interval(-1.10001,-0.897816));
   }
-}
\ No newline at end of file
+
+  SECTION("Test CtcEval, 6, many slices")
+  {
+    auto tdomain = create_tdomain({0,20}, 1./64., true);
+    SlicedTube x(tdomain, Interval(-10,10)), v(tdomain, Interval(-1,1));
+    CHECK(x.nb_slices() == 2561);
+
+    Interval t(2,18), z(-1,1);
+    CtcEval ctc_eval;
+    ctc_eval.contract(t, z, x, v);
+
+    CHECK(t == Interval(2,18));
+    CHECK(z == Interval(-1,1));
+    CHECK(x.nb_slices() == 2561);
+    CHECK(x(0.) == Interval(-10,10));
+    CHECK(x(2.) == Interval(-10,10));
+    CHECK(Approx(x(10.),1e-10) == Interval(-9,9)); // the farthest observation is 8 time units away
+    CHECK(x(18.) == Interval(-10,10));
+  }
+}
@@ -210,5 +210,25 @@ class TestCtcEval(unittest.TestCase):
     self.assertTrue(Approx(yi) == Interval(-1.1,-1))
     self.assertTrue(Approx(x(17.27),1e-4) == Interval(-1.10001,-0.897816))
 
+  def test_CtcEval_6_many_slices(self):
+
+    tdomain = create_tdomain([0,20],1./64.,True)
+    x = SlicedTube(tdomain, Interval(-10,10))
+    v = SlicedTube(tdomain, Interval(-1,1))
+    self.assertTrue(x.nb_slices() == 2561)
+
+    t = Interval(2,18)
+    z = Interval(-1,1)
+    ctc_eval = CtcEval()
+    ctc_eval.contract(t,z,x,v)
+
+    self.assertTrue(t == Interval(2,18))
+    self.assertTrue(z == Interval(-1,1))
+    self.assertTrue(x.nb_slices() == 2561)
+    self.assertTrue(x(0.) == Interval(-10,10))
+    self.assertTrue(x(2.) == Interval(-10,10))
+    self.assertTrue(Approx(x(10.),1e-10) == Interval(-9,9)) # the farthest observation is 8 time units away
+    self.assertTrue(x(18.) == Interval(-10,10))
+
 if __name__ ==  '__main__':
   unittest.main()
\ No newline at end of file
@@ -225,6 +225,46 @@ TEST_CASE("CtcInverse")
   }
 }
 
+TEST_CASE("CtcInverse - batch contraction")
+{
+  VectorVar x(2);
+  AnalyticFunction f { {x}, vec(x[0]-x[1], sqr(x[0])+x[1]) };
+
+  std::vector<IntervalVector> b;
+  for(int i = 0 ; i < 10 ; i++)
+    for(int j = 0 ; j < 10 ; j++)
+      b.push_back({ {-2.+0.4*i,-1.6+0.4*i}, {-2.+0.4*j,-1.6+0.4*j} });
+
+  for(bool with_centered_form : { true, false })
+  {
+    CtcInverse c(f, IntervalVector({{-0.5,0.5},{-1,1}}), with_centered_form);
+
+    std::vector<IntervalVector> b_batch(b);
+    c.contract_batch(b_batch);
+
+    for(size_t k = 0 ; k < b.size() ; k++)
+    {
+      IntervalVector bk(b[k]);
+      c.contract(bk);
+      CHECK(b_batch[k] == bk);
+    }
+  }
+
+  // Same operand on both sides of an operation
+  AnalyticFunction g { {x}, vec(x[0]*x[0]+x[0], x[1]-x[1]*x[0]) };
+  CtcInverse c(g, IntervalVector({{0,1},{-0.5,0.5}}), false);
+
+  std::vector<IntervalVector> b_batch(b);
+  c.contract_batch(b_batch);
+
+  for(size_t k = 0 ; k < b.size() ; k++)
+  {
+    IntervalVector bk(b[k]);
+    c.contract(bk);
+    CHECK(b_batch[k] == bk);
+  }
+}
+
 TEST_CASE("ParabolasExample")
 {
   ScalarVar u;
@@ -132,6 +132,22 @@ class TestCtcInverse(unittest.TestCase):
     c.contract(b)
     self.assertTrue(b == IntervalVector.empty(2))
   
+  def test_CtcInverse_batch_contraction(self):
+
+    x = VectorVar(2)
+    f = AnalyticFunction([x], vec(x[0]-x[1], sqr(x[0])+x[1]))
+
+    b = [ IntervalVector([[-2.+0.4*i,-1.6+0.4*i],[-2.+0.4*j,-1.6+0.4*j]]) for i in range(10) for j in range(10) ]
+
+    for with_centered_form in [ True, False ]:
+      c = CtcInverse(f, IntervalVector([[-0.5,0.5],[-1,1]]), with_centered_form)
+      b_batch = c.contract_batch(b)
+      self.assertTrue(len(b_batch) == len(b))
+      for k in range(len(b)):
+        bk = IntervalVector(b[k])
+        c.contract(bk)
+        self.assertTrue(b_batch[k] == bk)
+
   def test_ParabolasExample(self):
 
     u = ScalarVar()
@@ -0,0 +1,79 @@
+/** 
+ *  Codac tests
+ * ----------------------------------------------------------------------------
+ *  \date       2025
+ *  \author     Simon Rohou
+ *  \copyright  Copyright 2025 Codac Team
+ *  \license    GNU Lesser General Public License (LGPL)
+ */
+
+#include <random>
+#include <catch2/catch_test_macros.hpp>
+#include <codac2_CtcPointCloud.h>
+#include <codac2_CtcConstell.h>
+
+using namespace std;
+using namespace codac2;
+
+TEST_CASE("CtcPointCloud")
+{
+  CtcPointCloud c({
+    {{1,2},{1,2}},
+    {{3,4},{0,1}},
+    {{5,5},{5,5}}
+  });
+
+  IntervalVector x(2);
+  c.contract(x);
+  CHECK(x == IntervalVector({{1,5},{0,5}}));
+
+  x = IntervalVector({{1.5,3.5},{-1,1.5}});
+  c.contract(x);
+  CHECK(x == IntervalVector({{1.5,3.5},{0,1.5}}));
+
+  x = IntervalVector({{4.5,6},{4.5,6}});
+  c.contract(x);
+  CHECK(x == IntervalVector({{5,5},{5,5}}));
+
+  x = IntervalVector({{2.5,2.9},{0,10}});
+  c.contract(x);
+  CHECK(x.is_empty());
+}
+
+TEST_CASE("CtcPointCloud - large cloud")
+{
+  // Comparison with an exhaustive contraction, for boxes intersecting
+  // no point, some points, or all the points of the cloud
+
+  mt19937 gen(42);
+  uniform_real_distribution<double> d(-100.,100.), r(0.,20.);
+
+  vector<IntervalVector> p;
+  for(int i = 0 ; i < 5000 ; i++)
+  {
+    Vector pi({d(gen),d(gen),d(gen)});
+    p.push_back(IntervalVector(pi).inflate(i%3 == 0 ? 0. : 0.5));
+  }
+  p.push_back(IntervalVector::empty(3));
+
+  CtcPointCloud c_cloud(p);
+  CtcConstell c_constell(p);
+
+  for(int k = 0 ; k < 200 ; k++)
+  {
+    Vector xk({d(gen),d(gen),d(gen)});
+    IntervalVector x0 = IntervalVector(xk).inflate(k == 0 ? 200. : r(gen));
+
+    auto u = IntervalVector::empty(3);
+    for(const auto& pi : p)
+      u |= x0 & pi;
+
+    IntervalVector x = x0;
+    c_cloud.contract(x);
+    CHECK(x == u);
+
+    x = x0;
+    c_constell.contract(x);
+    CHECK(x == u);
+  }
+}
@@ -0,0 +1,71 @@
+#!/usr/bin/env python
+
+#  Codac tests
+# ----------------------------------------------------------------------------
+#  \date       2025
+#  \author     Simon Rohou
+#  \copyright  Copyright 2025 Codac Team
+#  \license    GNU Lesser General Public License (LGPL)
+
+import unittest
+import random
+from codac import *
+
+class TestCtcPointCloud(unittest.TestCase):
+
+  def test_CtcPointCloud(self):
+
+    c = CtcPointCloud([
+      IntervalVector([[1,2],[1,2]]),
+      IntervalVector([[3,4],[0,1]]),
+      IntervalVector([[5,5],[5,5]])
+    ])
+
+    x = IntervalVector(2)
+    c.contract(x)
+    self.assertTrue(x == IntervalVector([[1,5],[0,5]]))
+
+    x = IntervalVector([[1.5,3.5],[-1,1.5]])
+    c.contract(x)
+    self.assertTrue(x == IntervalVector([[1.5,3.5],[0,1.5]]))
+
+    x = IntervalVector([[4.5,6],[4.5,6]])
+    c.contract(x)
+    self.assertTrue(x == IntervalVector([[5,5],[5,5]]))
+
+    x = IntervalVector([[2.5,2.9],[0,10]])
+    c.contract(x)
+    self.assertTrue(x.is_empty())
+
+  def test_CtcPointCloud_large_cloud(self):
+
+    # Comparison with an exhaustive contraction, for boxes intersecting
+    # no point, some points, or all the points of the cloud
+
+    random.seed(42)
+    d = lambda: random.uniform(-100.,100.)
+
+    p = []
+    for i in range(0,1000):
+      p.append(IntervalVector([d(),d(),d()]).inflate(0. if i%3 == 0 else 0.5))
+
+    c_cloud = CtcPointCloud(p)
+    c_constell = CtcConstell(p)
+
+    for k in range(0,50):
+      x0 = IntervalVector([d(),d(),d()]).inflate(200. if k == 0 else random.uniform(0.,20.))
+
+      u = IntervalVector.empty(3)
+      for pi in p:
+        u |= x0 & pi
+
+      x = IntervalVector(x0)
+      c_cloud.contract(x)
+      self.assertTrue(x == u)
+
+      x = IntervalVector(x0)
+      c_constell.contract(x)
+      self.assertTrue(x == u)
+
+if __name__ ==  '__main__':
+  unittest.main()
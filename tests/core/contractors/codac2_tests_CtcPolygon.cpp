@@ -95,4 +95,45 @@ TEST_CASE("CtcPolygon - tests from Codac1")
       CHECK(x.is_empty());
     }
   }
-}
\ No newline at end of file
+}
+
+TEST_CASE("CtcPolygon - many edges")
+{
+  // Non-convex polygon made of many edges
+  vector<Vector> v;
+  for(int i = 0 ; i < 2000 ; i++)
+  {
+    double a = 2.*PI*i/2000., r = (i%2 == 0) ? 10. : 9.;
+    v.push_back({ r*std::cos(a), r*std::sin(a) });
+  }
+
+  Polygon p(v);
+  CtcPolygonBoundary c_boundary(make_shared<const IndexedPolygon>(p));
+  CtcUnion<IntervalVector> c_segments(2);
+  for(const auto& e : p.edges())
+    c_segments |= CtcSegment(e[0],e[1]);
+
+  // Same contractions as with the union of the contractors on the edges
+  for(double x = -11. ; x <= 11. ; x += 0.7)
+    for(double y = -11. ; y <= 11. ; y += 0.7)
+    {
+      IntervalVector b = IntervalVector({x,y}).inflate(0.4), b_(b);
+      c_boundary.contract(b);
+      c_segments.contract(b_);
+      CHECK(b == b_);
+    }
+
+  CtcPolygon c(p);
+
+  IntervalVector x = IntervalVector({0,0}).inflate(1.);
+  c.contract(x);
+  CHECK(x == IntervalVector({0,0}).inflate(1.));
+
+  x = IntervalVector({20,0}).inflate(1.);
+  c.contract(x);
+  CHECK(x.is_empty());
+
+  x = IntervalVector(2);
+  c.contract(x);
+  CHECK(x == p.box());
+}
@@ -8,6 +8,7 @@
 #  \license    GNU Lesser General Public License (LGPL)
 
 import unittest
+import math
 from codac import *
 
 class TestCtcPolygon(unittest.TestCase):
@@ -86,6 +87,29 @@ class TestCtcPolygon(unittest.TestCase):
     c.contract(x)
     self.assertTrue(x.is_empty())
 
+  def test_CtcPolygon_many_edges(self):
+
+    # Non-convex polygon made of many edges
+    v = []
+    for i in range(0,2000):
+      a = 2.*PI*i/2000.
+      r = 10. if i%2 == 0 else 9.
+      v.append(Vector([r*math.cos(a),r*math.sin(a)]))
+
+    p = Polygon(v)
+    c = CtcPolygon(p)
+
+    x = IntervalVector([0,0]).inflate(1.)
+    c.contract(x)
+    self.assertTrue(x == IntervalVector([0,0]).inflate(1.))
+
+    x = IntervalVector([20,0]).inflate(1.)
+    c.contract(x)
+    self.assertTrue(x.is_empty())
+
+    x = IntervalVector(2)
+    c.contract(x)
+    self.assertTrue(x == p.box())
 
 if __name__ ==  '__main__':
   unittest.main()
\ No newline at end of file
@@ -17,6 +17,8 @@
 #include <codac2_IntervalMatrix.h>
 #include <codac2_IntervalVector.h>
 #include <codac2_Approx.h>
+#include <codac2_arith_mul.h>
+#include <codac2_interval_kernels.h>
 
 using namespace std;
 using namespace codac2;
@@ -732,6 +734,103 @@ TEST_CASE("IntervalMatrix - mixing type")
   }
 }
 
+TEST_CASE("IntervalMatrix - interval kernels")
+{
+  // Same results as element-wise Gaol operations, whatever the instruction
+  // set selected at build time (including empty, unbounded and degenerate cases)
+  std::vector<Interval> v {
+    {1,2}, {-3,0.5}, {0}, {-oo,1}, {2,oo}, {-oo,oo}, Interval::empty(),
+    {-1e308,1e308}, {1./3.,2./3.}, {-0.1,-0.01}, {5}, {0,oo}, {-oo,0}
+  };
+
+  std::vector<Interval> x, y;
+  for(const auto& vi : v)
+    for(const auto& vj : v)
+    {
+      x.push_back(vi);
+      y.push_back(vj);
+    }
+
+  const Index n = x.size();
+  std::vector<Interval> z(n);
+
+  IntervalKernels::add(x.data(), y.data(), z.data(), n);
+  for(Index k = 0 ; k < n ; k++)
+    CHECK(z[k] == x[k]+y[k]);
+
+  IntervalKernels::sub(x.data(), y.data(), z.data(), n);
+  for(Index k = 0 ; k < n ; k++)
+    CHECK(z[k] == x[k]-y[k]);
+
+  IntervalKernels::inter(x.data(), y.data(), z.data(), n);
+  for(Index k = 0 ; k < n ; k++)
+    CHECK(z[k] == (x[k]&y[k]));
+
+  IntervalKernels::hull(x.data(), y.data(), z.data(), n);
+  for(Index k = 0 ; k < n ; k++)
+    CHECK(z[k] == (x[k]|y[k]));
+
+  // In-place operation
+  std::vector<Interval> x_(x);
+  IntervalKernels::add(x_.data(), y.data(), x_.data(), n);
+  for(Index k = 0 ; k < n ; k++)
+    CHECK(x_[k] == x[k]+y[k]);
+
+  // Products of single intervals, the rounding mode being switched once for all the calls
+  std::vector<Interval> p(n);
+  {
+    IntervalKernels::UpwardRounding rounding;
+    for(Index k = 0 ; k < n ; k++)
+      IntervalKernels::mul(&x[k], 1, 1, &y[k], 1, &p[k]);
+  }
+  for(Index k = 0 ; k < n ; k++)
+    CHECK(p[k] == x[k]*y[k]);
+
+  // Matrix products
+  IntervalMatrix A(5,3);
+  IntervalVector b(3);
+  IntervalMatrix B(3,4);
+  for(Index k = 0 ; k < A.size() ; k++)
+    A.data()[k] = v[(k*7)%6]-Interval(k);
+  for(Index k = 0 ; k < b.size() ; k++)
+    b[k] = Interval(-1.+k,2.+k/3.);
+  for(Index k = 0 ; k < B.size() ; k++)
+    B.data()[k] = v[(k*5)%6]+Interval(k,k+0.5);
+
+  IntervalVector Ab(A.rows());
+  IntervalKernels::mul(A.data(), A.rows(), A.cols(), b.data(), 1, Ab.data());
+  IntervalMatrix AB = MulOp::fwd(A,B);
+
+  for(Index i = 0 ; i < A.rows() ; i++)
+  {
+    Interval s(0.);
+    for(Index j = 0 ; j < A.cols() ; j++)
+      s += A(i,j)*b[j];
+    CHECK(Ab[i] == s);
+
+    for(Index q = 0 ; q < B.cols() ; q++)
+    {
+      Interval s_(0.);
+      for(Index j = 0 ; j < A.cols() ; j++)
+        s_ += A(i,j)*B(j,q);
+      CHECK(AB(i,q) == s_);
+    }
+  }
+
+  CHECK(MulOp::fwd(A,b) == Ab);
+  CHECK(Approx(MulOp::fwd(A,b),1e-10) == IntervalVector(A*b));
+
+  b[1].set_empty();
+  CHECK(MulOp::fwd(A,b).is_empty());
+  A(2,0).set_empty();
+  B(0,3).set_empty();
+  AB = MulOp::fwd(A,B);
+  CHECK(AB.row(2).is_empty());
+  CHECK(AB(2,0).is_empty());
+  CHECK(AB(0,3).is_empty());
+  CHECK(!AB(0,0).is_empty());
+}
+
 #if 0
 // Tests from the IBEX lib that are not considered in this file:
 
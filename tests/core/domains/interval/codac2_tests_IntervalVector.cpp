@@ -644,6 +644,45 @@ TEST_CASE("IntervalVector")
   }
 }
 
+TEST_CASE("IntervalVector - fixed size")
+{
+  IntervalVector_<2> x({{0,1},{2,4}}), y{{0.5,3},{-1,2.5}};
+  static_assert(sizeof(IntervalVector_<2>) == 2*sizeof(Interval)); // no heap storage
+
+  CHECK(x.size() == 2);
+  CHECK((x & y) == IntervalVector({{0.5,1},{2,2.5}}));
+  CHECK((x | y) == IntervalVector({{0,3},{-1,4}}));
+  CHECK(x.diam() == Vector({1,2}));
+  CHECK(x.mid() == Vector_<2>({0.5,3}));
+  CHECK(x.volume() == 2.);
+  CHECK(x.max_diam() == 2.);
+  CHECK(x.contains(Vector_<2>({0.5,3})));
+  CHECK(x.intersects(y));
+  CHECK(!x.is_subset(y));
+
+  auto p = x.bisect(1);
+  CHECK(p.first == IntervalVector({{0,1},{2,3}}));
+  CHECK(p.second == IntervalVector({{0,1},{3,4}}));
+
+  IntervalVector_<2> z(x);
+  z &= IntervalVector({{2,3},{2,3}});
+  CHECK(z.is_empty());
+  CHECK(IntervalVector_<3>::empty(3).is_empty());
+
+  // Conversions with dynamic-size vectors
+  IntervalVector d(x);
+  CHECK(d == x);
+  IntervalVector_<2> e(d);
+  CHECK(e == x);
+  d &= y;
+  CHECK(d == (x & y));
+  CHECK(IntervalVector(x+y) == IntervalVector({{0.5,4},{1,6.5}}));
+
+  std::ostringstream s;
+  s << x;
+  CHECK(s.str() == "[ [0, 1] ; [2, 4] ]");
+}
+
 #if 0
 // Tests from the IBEX lib that are not considered in this file:
 
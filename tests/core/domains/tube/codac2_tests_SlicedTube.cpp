@@ -16,6 +16,7 @@
 #include <codac2_AnalyticTraj.h>
 #include <codac2_SampledTraj.h>
 #include <codac2_Figure2D.h>
+#include <codac2_CtcInverse.h>
 
 using namespace std;
 using namespace codac2;
@@ -250,8 +251,8 @@ TEST_CASE("SlicedTube")
     CHECK(x.nb_slices() == 10);
     CHECK(tdomain->tslice(-oo) == tdomain->end());
     CHECK(tdomain->tslice(oo) == tdomain->end());
-    CHECK(x.first_slice() == tdomain->tslice(0.)->slices().at(&x));
-    CHECK(x.last_slice() == tdomain->tslice(1.)->slices().at(&x));
+    CHECK(x.first_slice() == tdomain->tslice(0.)->slice(&x));
+    CHECK(x.last_slice() == tdomain->tslice(1.)->slice(&x));
 
     for(auto& s : x)
       s.set(IntervalVector::constant(2,s.t0_tf()));
@@ -398,6 +399,32 @@ TEST_CASE("SlicedTube")
     CHECK(Approx(a(Interval(1,2)),1e-4) == Interval(-2.17496, 7.13757));
   }
 
+  SECTION("Parallel tube evaluation and contraction")
+  {
+    auto tdomain = create_tdomain(Interval(0,10), 0.01, true);
+    ScalarVar t;
+    AnalyticFunction g({t}, vec(2*cos(t),sin(t)));
+    SlicedTube x(tdomain, g);
+
+    VectorVar p(2);
+    AnalyticFunction f({p}, sqr(p[0])+sqr(p[1]));
+    SlicedTube y = f.tube_eval(x);
+
+    CtcInverse c(f, Interval(0,1));
+    SlicedTube x_ctc(x);
+    c.contract_tube(x_ctc);
+    CHECK(x_ctc != x);
+
+    for(size_t n : { 1,2,4 })
+    {
+      CHECK(f.parallel_tube_eval(n, x) == y);
+
+      SlicedTube x_par(x);
+      c.parallel_contract_tube(n, x_par);
+      CHECK(x_par == x_ctc);
+    }
+  }
+
   SECTION("Testing specific detected bug from sampling")
   {
     auto tdomain = create_tdomain({0.,46.}, 0.5, false);
@@ -707,4 +734,105 @@ TEST_CASE("SlicedTube")
     inv = x.invert(inv_val, restricted);
     CHECK(inv == Interval(15.2,38));
   }
-}
\ No newline at end of file
+
+  SECTION("Inversion, hull index")
+  {
+    SlicedTube x = tube_test_1();
+    x.set_ith_slice(Interval(-4,2), 14);
+    SlicedTube y(x);
+    y.enable_hull_index();
+    CHECK(y.has_hull_index());
+    CHECK(!x.has_hull_index());
+
+    for(const auto& yi : { Interval(0), Interval(-7), Interval(), Interval(-12,14), Interval(-20,-18),
+        Interval(-1,1), Interval(-10.5), Interval(10,11), Interval(6.01,7), Interval(5.9,7), Interval::empty() })
+      for(const auto& ti : { x.tdomain()->t0_tf(), Interval(3.8,42.5), Interval(15.2,39), Interval(7.5),
+          Interval(14), Interval(46), Interval(0,100), Interval::empty() })
+        CHECK(y.invert(yi, ti) == x.invert(yi, ti));
+
+    // The index is outdated by a modification of the tube, and built again by the next inversion
+    y.set_ith_slice(Interval(-30,-29), 20);
+    CHECK(!y.has_hull_index());
+    CHECK(y.invert(Interval(-30,-29), y.tdomain()->t0_tf()) == Interval(20,21));
+    CHECK(y.has_hull_index());
+    y.set_ith_slice(Interval(-30,-29), 20); // unchanged slice
+    for(auto& s : y)
+      s.set(std::as_const(s).codomain(), false);
+    CHECK(y.has_hull_index());
+    y.set_ith_slice(Interval(-31,-29), 20);
+    CHECK(!y.has_hull_index());
+    y.update_hull_index();
+    CHECK(y.has_hull_index());
+    CHECK(y.invert(Interval(-31), y.tdomain()->t0_tf()) == Interval(20,21));
+
+    // Vector tube, and contraction of the time through the tube as operator
+    SlicedTube<IntervalVector> z(x.tdomain(), IntervalVector(2));
+    for(auto it = z.tdomain()->begin() ; it != z.tdomain()->end() ; it++)
+      z.slice(it)->set(cart_prod(x.slice(it)->codomain(),x.slice(it)->codomain()-3), false);
+
+    IntervalVector inv_val = IntervalVector::constant(2,{0.5,0.5});
+    CHECK(z.invert(inv_val, Interval(15.2,39)) == Interval(15.2,38));
+    z.enable_hull_index();
+    CHECK(z.invert(inv_val, Interval(15.2,39)) == Interval(15.2,38));
+
+    ScalarVar t;
+    AnalyticFunction g { {t}, z.as_function()(t) };
+    CtcInverse<IntervalVector,Interval> c(g, inv_val);
+    Interval t0(15.2,39);
+    c.contract(t0);
+    CHECK(t0 == Interval(15.2,38));
+  }
+
+  SECTION("Adjacent slices after sampling")
+  {
+    auto tdomain = create_tdomain(Interval(0,1), 0.25, true);
+    SlicedTube x(tdomain, Interval(-1,1));
+    SlicedTube v(tdomain, Interval(0.5));
+
+    tdomain->sample(0.6, true);
+    tdomain->sample(-1.);
+    tdomain->sample(2., true);
+    tdomain->sample(0.1, true);
+    CHECK(tdomain->nb_tslices() == 16);
+
+    x.set(Interval(0.5), 0.6);
+    CHECK(x(0.6) == Interval(0.5));
+    CHECK(x.slice(tdomain->tslice(0.55))->output_gate() == Interval(0.5));
+
+    auto check_links = [&](const SlicedTube<Interval>& y)
+    {
+      const Slice<Interval>* prev = nullptr;
+      for(const auto& s : y)
+      {
+        CHECK(s.prev_slice_ptr() == prev);
+        CHECK(s.prev_slice().get() == prev);
+        if(prev)
+        {
+          CHECK(prev->next_slice_ptr() == &s);
+          CHECK(prev->t0_tf().ub() == s.t0_tf().lb());
+        }
+        prev = &s;
+      }
+      CHECK(prev == y.last_slice().get());
+      CHECK(!y.last_slice()->next_slice());
+      CHECK(!y.first_slice()->prev_slice());
+    };
+
+    check_links(x);
+    check_links(v);
+
+    CtcDeriv c;
+    c.contract(x,v);
+    CHECK(Approx(x(0.)) == Interval(0.2));
+    CHECK(Approx(x(1.)) == Interval(0.7));
+
+    SlicedTube y(x);
+    check_links(y);
+    CHECK(y == x);
+
+    tdomain->delete_gates();
+    CHECK(tdomain->nb_tslices() == 8);
+    check_links(x);
+    check_links(y);
+  }
+}
@@ -304,6 +304,29 @@ class TestSlicedTube(unittest.TestCase):
     self.assertTrue(Approx(tdomain.tslice(2.)) == Interval(1.900000000000001, 2.000000000000002))
     self.assertTrue(Approx(a(Interval(1,2)),1e-4) == Interval(-2.17496, 7.13757))
 
+  def test_parallel_tube_evaluation_and_contraction(self):
+
+    tdomain = create_tdomain(Interval(0,10), 0.01, True)
+    t = ScalarVar()
+    g = AnalyticFunction([t], vec(2*cos(t),sin(t)))
+    x = SlicedTube(tdomain, g)
+
+    p = VectorVar(2)
+    f = AnalyticFunction([p], sqr(p[0])+sqr(p[1]))
+    y = f.tube_eval(x)
+
+    c = CtcInverse(f, Interval(0,1))
+    x_ctc = SlicedTube(x)
+    c.contract_tube(x_ctc)
+    self.assertTrue(x_ctc != x)
+
+    for n in [1,2,4]:
+      self.assertTrue(f.parallel_tube_eval(x, n) == y)
+
+      x_par = SlicedTube(x)
+      c.parallel_contract_tube(x_par, n)
+      self.assertTrue(x_par == x_ctc)
+
   def test_specific_detected_bug_from_sampling(self):
 
     tdomain = create_tdomain([0.,46.], 0.5, False)
@@ -557,6 +580,92 @@ class TestSlicedTube(unittest.TestCase):
     inv = x.invert(inv_val, restricted)
     self.assertTrue(inv == Interval(15.2,38))
 
+  def test_inversion_hull_index(self):
+
+    x = predef.tube_test_1()
+    x.set_ith_slice(Interval(-4,2), 14)
+    y = SlicedTube(x)
+    y.enable_hull_index()
+    self.assertTrue(y.has_hull_index())
+    self.assertTrue(not x.has_hull_index())
+
+    for yi in [ Interval(0), Interval(-7), Interval(), Interval(-12,14), Interval(-20,-18),
+        Interval(-1,1), Interval(-10.5), Interval(10,11), Interval(6.01,7), Interval(5.9,7), Interval.empty() ]:
+      for ti in [ x.tdomain().t0_tf(), Interval(3.8,42.5), Interval(15.2,39), Interval(7.5),
+          Interval(14), Interval(46), Interval(0,100), Interval.empty() ]:
+        self.assertTrue(y.invert(yi, ti) == x.invert(yi, ti))
+
+    # The index is outdated by a modification of the tube, and built again by the next inversion
+    y.set_ith_slice(Interval(-30,-29), 20)
+    self.assertTrue(not y.has_hull_index())
+    self.assertTrue(y.invert(Interval(-30,-29), y.tdomain().t0_tf()) == Interval(20,21))
+    self.assertTrue(y.has_hull_index())
+    y.set_ith_slice(Interval(-30,-29), 20) # unchanged slice
+    self.assertTrue(y.has_hull_index())
+    y.set_ith_slice(Interval(-31,-29), 20)
+    self.assertTrue(not y.has_hull_index())
+    y.update_hull_index()
+    self.assertTrue(y.has_hull_index())
+    self.assertTrue(y.invert(Interval(-31), y.tdomain().t0_tf()) == Interval(20,21))
+
+    # Vector tube, and contraction of the time through the tube as operator
+    z = SlicedTube(x.tdomain(), IntervalVector(2))
+    for zi, xi in zip(z, x):
+      zi.set(cart_prod(xi.codomain(), xi.codomain() - 3), False)
+
+    inv_val = IntervalVector.constant(2,[0.5,0.5])
+    self.assertTrue(z.invert(inv_val, Interval(15.2,39)) == Interval(15.2,38))
+    z.enable_hull_index()
+    self.assertTrue(z.invert(inv_val, Interval(15.2,39)) == Interval(15.2,38))
+
+    b = VectorVar(1)
+    g = AnalyticFunction([b], z.as_function()(b[0]))
+    c = CtcInverse(g, inv_val)
+    t0 = IntervalVector([[15.2,39]])
+    c.contract(t0)
+    self.assertTrue(t0 == IntervalVector([[15.2,38]]))
+
+
+  def test_adjacent_slices_after_sampling(self):
+
+    tdomain = create_tdomain(Interval(0,1), 0.25, True)
+    x = SlicedTube(tdomain, Interval(-1,1))
+    v = SlicedTube(tdomain, Interval(0.5))
+
+    tdomain.sample(0.6, True)
+    tdomain.sample(-1.)
+    tdomain.sample(2., True)
+    tdomain.sample(0.1, True)
+    self.assertTrue(tdomain.nb_tslices() == 16)
+
+    x.set(Interval(0.5), 0.6)
+    self.assertTrue(x(0.6) == Interval(0.5))
+
+    def check_links(y):
+      prev = None
+      for s in y:
+        if prev is not None:
+          self.assertTrue(prev.t0_tf().ub() == s.t0_tf().lb())
+        prev = s
+      self.assertTrue(prev.t0_tf() == y.last_slice().t0_tf())
+
+    check_links(x)
+    check_links(v)
+
+    ctc = CtcDeriv()
+    ctc.contract(x,v)
+    self.assertTrue(Approx(x(0.)) == Interval(0.2))
+    self.assertTrue(Approx(x(1.)) == Interval(0.7))
+
+    y = SlicedTube(x)
+    check_links(y)
+    self.assertTrue(y == x)
+
+    tdomain.delete_gates()
+    self.assertTrue(tdomain.nb_tslices() == 8)
+    check_links(x)
+    check_links(y)
+
 
 if __name__ ==  '__main__':
   unittest.main()
\ No newline at end of file
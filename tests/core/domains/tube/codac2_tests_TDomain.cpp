@@ -120,4 +120,104 @@ TEST_CASE("TDomain")
     CHECK(vector_tslices.size() == 1);
     CHECK(vector_tslices[0] == Interval(-oo,oo));
   }
-}
\ No newline at end of file
+
+  SECTION("Test time index")
+  {
+    // Reference: linear search of the tslice containing t
+    auto linear_tslice = [](TDomain& tdom, double t)
+    {
+      if(!tdom.t0_tf().contains(t))
+        return tdom.end();
+      for(auto it = tdom.begin() ; it != tdom.end() ; it++)
+        if((it->is_gate() && it->lb() == t) || (it->lb() <= t && it->ub() > t))
+          return it;
+      return std::prev(tdom.end());
+    };
+
+    auto check_index = [&linear_tslice](TDomain& tdom)
+    {
+      for(double t = -2. ; t <= 13. ; t += 0.05)
+        CHECK(tdom.tslice(t) == linear_tslice(tdom,t));
+      for(const auto& ti : tdom)
+      {
+        CHECK(tdom.tslice(ti.lb()) == linear_tslice(tdom,ti.lb()));
+        CHECK(tdom.tslice(ti.ub()) == linear_tslice(tdom,ti.ub()));
+      }
+    };
+
+    auto tdomain = create_tdomain({0,10}, 0.5, true);
+    check_index(*tdomain);
+    CHECK(tdomain->tslice(10.) == std::prev(tdomain->end()));
+    CHECK(tdomain->tslice(10.)->is_gate());
+    CHECK(*tdomain->tslice(2.) == Interval(2.));
+    CHECK(*tdomain->tslice(2.2) == Interval(2.,2.5));
+
+    tdomain->sample(2.2,false);
+    tdomain->sample(3.,true); // already existing gate
+    tdomain->sample(4.1,true);
+    tdomain->sample(-1.,false); // before t0
+    tdomain->sample(12.,true); // after tf
+    check_index(*tdomain);
+    CHECK(*tdomain->tslice(4.1) == Interval(4.1));
+    CHECK(*tdomain->tslice(4.2) == Interval(4.1,4.5));
+    CHECK(*tdomain->tslice(-0.5) == Interval(-1.,0.));
+
+    tdomain->delete_gates();
+    check_index(*tdomain);
+    CHECK(*tdomain->tslice(4.1) == Interval(4.1,4.5));
+    CHECK(*tdomain->tslice(12.) == Interval(10.,12.));
+
+    auto tdomain_nogates = create_tdomain({0,10}, 0.5, false);
+    tdomain_nogates->sample(0.,true);
+    tdomain_nogates->sample(7.25,true);
+    check_index(*tdomain_nogates);
+    CHECK(*tdomain_nogates->tslice(0.) == Interval(0.));
+    CHECK(*tdomain_nogates->tslice(10.) == Interval(9.5,10.));
+  }
+
+  SECTION("Test sliding window")
+  {
+    auto tdomain = create_tdomain({0,1}, 0.25, true);
+    SlicedTube x(tdomain, Interval());
+    SlicedTube v(tdomain, Interval(1));
+    x.set(0., 0.);
+    CtcDeriv c;
+    c.contract(x,v);
+
+    for(int k = 5 ; k <= 100 ; k++)
+    {
+      double t = k*0.25;
+      tdomain->sample(t,true); // new slices at the head
+      v.set(1., {t-0.25,t});
+      c.contract(x,v);
+      Interval x_t0 = x(t-1.);
+      tdomain->truncate(t-1.); // old slices retired at the tail
+      CHECK(tdomain->t0_tf() == Interval(t-1.,t));
+      CHECK(tdomain->nb_tslices() == 9);
+      CHECK(tdomain->all_gates_defined());
+      CHECK(x(t-1.) == x_t0); // the gate summarizes the retired part
+      CHECK(x(t).contains(t));
+      CHECK(x(t).diam() < 1e-10);
+    }
+
+    CHECK(*tdomain->tslice(24.) == Interval(24.));
+    CHECK(*tdomain->tslice(24.1) == Interval(24.,24.25));
+    CHECK(tdomain->tslice(23.9) == tdomain->end());
+    CHECK(x.first_slice()->is_gate());
+    CHECK(x.first_slice()->prev_slice() == nullptr);
+    CHECK(*tdomain->truncate(24.5) == Interval(24.5));
+    CHECK(tdomain->t0_tf() == Interval(24.5,25.));
+    CHECK(x.nb_slices() == 5);
+
+    // A slice held across a truncation remains valid, unlinked from the tube
+    auto s = x.first_slice()->next_slice();
+    Interval y = s->codomain();
+    tdomain->truncate(24.75);
+    CHECK(s->codomain() == y);
+    CHECK(s->prev_slice() == nullptr);
+    CHECK(s->next_slice() == nullptr);
+    tdomain->sample(25.5,true); // new slices do not reuse the memory of s
+    x.set(Interval(-1.), Interval(25.,25.5));
+    CHECK(s->codomain() == y);
+  }
+}
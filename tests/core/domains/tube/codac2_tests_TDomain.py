@@ -111,5 +111,51 @@ class TestTDomain(unittest.TestCase):
     self.assertTrue(len(vector_tslices) == 1)
     self.assertTrue(vector_tslices[0] == Interval(-oo,oo))
 
+  def test_time_index(self):
+
+    tdomain = create_tdomain([0,10], 0.5, True)
+    self.assertTrue(tdomain.tslice(10.) == Interval(10.))
+    self.assertTrue(tdomain.tslice(2.) == Interval(2.))
+    self.assertTrue(tdomain.tslice(2.2) == Interval(2.,2.5))
+
+    tdomain.sample(2.2,False)
+    tdomain.sample(3.,True) # already existing gate
+    tdomain.sample(4.1,True)
+    tdomain.sample(-1.,False) # before t0
+    tdomain.sample(12.,True) # after tf
+    self.assertTrue(tdomain.tslice(2.3) == Interval(2.2,2.5))
+    self.assertTrue(tdomain.tslice(4.1) == Interval(4.1))
+    self.assertTrue(tdomain.tslice(4.2) == Interval(4.1,4.5))
+    self.assertTrue(tdomain.tslice(-0.5) == Interval(-1.,0.))
+
+    tdomain.delete_gates()
+    self.assertTrue(tdomain.tslice(4.1) == Interval(4.1,4.5))
+    self.assertTrue(tdomain.tslice(12.) == Interval(10.,12.))
+
+  def test_sliding_window(self):
+
+    tdomain = create_tdomain([0,1], 0.25, True)
+    x = SlicedTube(tdomain, Interval())
+    v = SlicedTube(tdomain, Interval(1))
+    x.set(Interval(0.), 0.)
+    c = CtcDeriv()
+    c.contract(x,v)
+
+    for k in range(5,101):
+      t = k*0.25
+      tdomain.sample(t,True) # new slices at the head
+      v.set(Interval(1.), [t-0.25,t])
+      c.contract(x,v)
+      x_t0 = x(t-1.)
+      tdomain.truncate(t-1.) # old slices retired at the tail
+      self.assertTrue(tdomain.t0_tf() == Interval(t-1.,t))
+      self.assertTrue(tdomain.nb_tslices() == 9)
+      self.assertTrue(x(t-1.) == x_t0) # the gate summarizes the retired part
+      self.assertTrue(x(t).contains(t))
+      self.assertTrue(x(t).diam() < 1e-10)
+
+    self.assertTrue(tdomain.truncate(24.5) == Interval(24.5))
+    self.assertTrue(x.nb_slices() == 5)
+
 if __name__ ==  '__main__':
   unittest.main()
\ No newline at end of file
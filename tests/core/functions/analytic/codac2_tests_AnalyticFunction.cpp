@@ -9,6 +9,7 @@
 
 #include <catch2/catch_test_macros.hpp>
 #include <codac2_AnalyticFunction.h>
+#include <codac2_CtcInverse.h>
 #include <codac2_Approx.h>
 #include <codac2_math.h>
 
@@ -529,3 +530,139 @@ TEST_CASE("AnalyticFunction")
     AnalyticFunction f2 { {x}, { x+x, 1. } };
   }
 }
+
+TEST_CASE("AnalyticFunction - compiled evaluation")
+{
+  ScalarVar x1, x2, x3;
+  AnalyticFunction f { {x1,x2,x3}, vec(x1*cos(x3)+sqr(x2), sqrt(exp(x2)-1.)) };
+
+  Interval b1(-1,1.5), b2(0.5,2), b3(0.1,0.3);
+
+  for(bool natural : { true, false })
+  {
+    // Recursive tree-walking evaluation
+    ValuesMap v_map;
+    f.fill_from_args(v_map, b1, b2, b3);
+    auto y_map = f.expr()->fwd_eval(v_map, f.input_size(), natural);
+
+    // Compiled evaluation (done twice, the second time with reused values)
+    for(int k = 0 ; k < 2 ; k++)
+    {
+      auto v = f.tape().values();
+      f.fill_from_args(*v, b1, b2, b3);
+      f.tape().fwd_eval(*v, f.input_size(), natural);
+      const auto& y = AnalyticExpr<VectorType>::value(*v, f.tape().root_slot());
+
+      CHECK(y.a == y_map.a);
+      if(!natural)
+      {
+        CHECK(y.m == y_map.m);
+        CHECK(y.da == y_map.da);
+      }
+    }
+
+    // Backward evaluations
+    IntervalVector y_ctc { {-1,1},{0,1} };
+
+    f.expr()->value(v_map).a &= y_ctc;
+    f.expr()->bwd_eval(v_map);
+    Interval c1(b1), c2(b2), c3(b3);
+    f.intersect_from_args(v_map, c1, c2, c3);
+
+    auto v = f.tape().values();
+    f.fill_from_args(*v, b1, b2, b3);
+    f.tape().fwd_eval(*v, f.input_size(), natural);
+    AnalyticExpr<VectorType>::value(*v, f.tape().root_slot()).a &= y_ctc;
+    f.tape().bwd_eval(*v);
+    Interval d1(b1), d2(b2), d3(b3);
+    f.intersect_from_args(*v, d1, d2, d3);
+
+    CHECK(d1 == c1);
+    CHECK(d2 == c2);
+    CHECK(d3 == c3);
+    CHECK(d2.is_strict_subset(b2));
+  }
+}
+
+TEST_CASE("AnalyticFunction - common sub-expressions")
+{
+  VectorVar x(3);
+  ScalarExpr c = cos(x[2]);
+
+  // Same function, with sub-expressions either shared or written several times
+  AnalyticFunction f1 { {x}, vec(x[0]*c+sqr(x[1]), x[1]*c-exp(x[0]), c*c) };
+  AnalyticFunction f2 { {x}, vec(x[0]*cos(x[2])+sqr(x[1]), x[1]*cos(x[2])-exp(x[0]), cos(x[2])*cos(x[2])) };
+
+  // x[0], x[1], x[2], cos(x[2]), x[0]*c, sqr(x[1]), +, x[1]*c, exp(x[0]), -, c*c, vec
+  CHECK(f1.tape().nb_steps() == 12);
+  CHECK(f2.tape().nb_steps() == 12);
+  CHECK(f1.tape().nb_slots() == f2.tape().nb_slots());
+
+  IntervalVector b { {-1,1.5},{0.5,2},{0.1,0.3} };
+  CHECK(f1.eval(EvalMode::NATURAL, b) == f2.eval(EvalMode::NATURAL, b));
+  CHECK(f1.eval(EvalMode::CENTERED, b) == f2.eval(EvalMode::CENTERED, b));
+
+  CtcInverse c1(f1, IntervalVector({{-1,1},{-1,1},{0.95,1}}));
+  CtcInverse c2(f2, IntervalVector({{-1,1},{-1,1},{0.95,1}}));
+
+  IntervalVector b1(b), b2(b);
+  c1.contract(b1);
+  c2.contract(b2);
+  CHECK(b1 == b2);
+  CHECK(b1.is_strict_subset(b));
+}
+
+TEST_CASE("AnalyticFunction - batch evaluation")
+{
+  VectorVar x(2);
+  AnalyticFunction f { {x}, vec(x[0]*cos(x[1])+sqr(x[0]), sqrt(exp(x[1])-1.)) };
+
+  std::vector<IntervalVector> b;
+  for(int i = 0 ; i < 20 ; i++)
+    b.push_back({ {-1.+0.1*i,0.2*i}, {0.1*i,0.5+0.1*i} });
+
+  for(const auto& m : { EvalMode::NATURAL, EvalMode::CENTERED, EvalMode::DEFAULT })
+  {
+    auto y = f.eval_batch(m, b);
+    CHECK(y.size() == b.size());
+    for(size_t k = 0 ; k < b.size() ; k++)
+      CHECK(y[k] == f.eval(m, b[k]));
+  }
+
+  // Values of a previous batch evaluation are reused for a smaller batch
+  std::vector<IntervalVector> b_(b.begin(), b.begin()+5);
+  auto y = f.eval_batch(b_);
+  CHECK(y.size() == 5);
+  for(size_t k = 0 ; k < b_.size() ; k++)
+    CHECK(y[k] == f.eval(b_[k]));
+
+  AnalyticFunction g { {x}, x[0]*x[1] };
+  std::vector<Vector> p { {1,2},{3,4} };
+  auto z = g.eval_batch(p);
+  CHECK(z.size() == 2);
+  CHECK(z[0] == g.eval(p[0]));
+  CHECK(z[1] == g.eval(p[1]));
+  CHECK(z[1].contains(12.));
+
+  // Element-wise operations evaluated on the bounds of the whole batch,
+  // with empty and unbounded components
+  VectorVar u(3);
+  AnalyticFunction h { {u}, vec(u[0]+u[1], u[0]-u[2], u[1]*u[2]) - u + vec(-u[0], u[0]*u[0], +u[2]) };
+  AnalyticFunction h_ { {u}, u.subvector(1,2) + vec(u[0], -u[2]) };
+  std::vector<IntervalVector> c {
+    { {-1,2},{0,3},{-4,-1} },
+    { {1,oo},{-oo,-2},{0.5,1} },
+    { Interval::empty(),{0,1},{2,3} },
+    { {-1e308,1e308},{2,2},{-3,3} },
+    { {0},{-1,1},{1e-5,1e-4} }
+  };
+
+  auto w = h.eval_batch(EvalMode::NATURAL, c);
+  CHECK(w.size() == c.size());
+  for(size_t k = 0 ; k < c.size() ; k++)
+    CHECK(w[k] == h.eval(EvalMode::NATURAL, c[k]));
+
+  auto w_ = h_.eval_batch(EvalMode::NATURAL, c);
+  for(size_t k = 0 ; k < c.size() ; k++)
+    CHECK(w_[k] == h_.eval(EvalMode::NATURAL, c[k]));
+}
@@ -437,6 +437,31 @@ class TestAnalyticFunction(unittest.TestCase):
     self.assertTrue(f.eval(Interval(0.0,4.0))==Interval(-4.0,4.0))
     self.assertTrue(f.eval(Interval(0.0))==Interval(0.0))
 
+  def test_AnalyticFunction_batch_evaluation(self):
+
+    x = VectorVar(2)
+    f = AnalyticFunction([x], vec(x[0]*cos(x[1])+sqr(x[0]), sqrt(exp(x[1])-1.)))
+
+    b = [ IntervalVector([[-1.+0.1*i,0.2*i],[0.1*i,0.5+0.1*i]]) for i in range(20) ]
+
+    for m in [ EvalMode.NATURAL, EvalMode.CENTERED, EvalMode.DEFAULT ]:
+      y = f.eval_batch(m, b)
+      self.assertTrue(len(y) == len(b))
+      for k in range(len(b)):
+        self.assertTrue(y[k] == f.eval(m, b[k]))
+
+    y = f.eval_batch(b[:5])
+    self.assertTrue(len(y) == 5)
+    for k in range(5):
+      self.assertTrue(y[k] == f.eval(b[k]))
+
+    t = ScalarVar()
+    g = AnalyticFunction([t], t*t-2*t)
+    z = g.eval_batch(EvalMode.NATURAL, [Interval(1,2),Interval(-1,3),Interval.empty()])
+    self.assertTrue(z[0] == g.eval(EvalMode.NATURAL, Interval(1,2)))
+    self.assertTrue(z[1] == g.eval(EvalMode.NATURAL, Interval(-1,3)))
+    self.assertTrue(z[2].is_empty())
+
     
 if __name__ ==  '__main__':
   unittest.main()
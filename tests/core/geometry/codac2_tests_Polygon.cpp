@@ -132,4 +132,33 @@ TEST_CASE("Polygon contains - limit cases")
     CHECK(i == ConvexPolygon(IntervalVector({4.5,4.25})));
     CHECK(i.vertices().size() == 1);
   }
-}
\ No newline at end of file
+}
+
+TEST_CASE("IndexedPolygon")
+{
+  // Non-convex polygon made of many edges
+  vector<Vector> v;
+  for(int i = 0 ; i < 2000 ; i++)
+  {
+    double a = 2.*PI*i/2000., r = (i%2 == 0) ? 10. : 9.;
+    v.push_back({ r*std::cos(a), r*std::sin(a) });
+  }
+
+  Polygon p(v);
+  IndexedPolygon ip(p);
+  CHECK(ip.polygon() == p);
+
+  for(double x = -11. ; x <= 11. ; x += 0.37)
+    for(double y = -11. ; y <= 11. ; y += 0.37)
+      CHECK(ip.contains(IntervalVector({x,y})) == p.contains(IntervalVector({x,y})));
+
+  for(size_t i = 0 ; i < v.size() ; i += 7)
+  {
+    CHECK(ip.contains(v[i]) == BoolInterval::TRUE);
+    CHECK(ip.contains(IntervalVector(v[i]).inflate(0.01)) == p.contains(IntervalVector(v[i]).inflate(0.01)));
+  }
+
+  CHECK(ip.contains(IntervalVector({0,0})) == BoolInterval::TRUE);
+  CHECK(ip.contains(IntervalVector({20,0})) == BoolInterval::FALSE);
+  CHECK(IndexedPolygon(Polygon::empty()).contains(IntervalVector({0,0})) == BoolInterval::FALSE);
+}
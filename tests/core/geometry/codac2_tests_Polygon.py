@@ -8,6 +8,7 @@
 #  \license    GNU Lesser General Public License (LGPL)
 
 import unittest
+import math
 from codac import *
 
 class TestPolygon(unittest.TestCase):
@@ -116,5 +117,29 @@ class TestPolygon(unittest.TestCase):
     self.assertTrue(i == ConvexPolygon(IntervalVector([4.5,4.25])))
     self.assertTrue(len(i.vertices()) == 1)
 
+  def test_IndexedPolygon(self):
+
+    # Non-convex polygon made of many edges
+    v = []
+    for i in range(0,2000):
+      a = 2.*PI*i/2000.
+      r = 10. if i%2 == 0 else 9.
+      v.append(Vector([r*math.cos(a),r*math.sin(a)]))
+
+    p = Polygon(v)
+    ip = IndexedPolygon(p)
+    self.assertTrue(ip.polygon() == p)
+
+    for i in range(0,60):
+      for j in range(0,60):
+        x = IntervalVector([-11.+i*0.37,-11.+j*0.37])
+        self.assertTrue(ip.contains(x) == p.contains(x))
+
+    for i in range(0,len(v),7):
+      self.assertTrue(ip.contains(IntervalVector(v[i])) == BoolInterval.TRUE)
+
+    self.assertTrue(ip.contains(IntervalVector([0,0])) == BoolInterval.TRUE)
+    self.assertTrue(ip.contains(IntervalVector([20,0])) == BoolInterval.FALSE)
+
 if __name__ ==  '__main__':
   unittest.main()
\ No newline at end of file
@@ -0,0 +1,116 @@
+/** 
+ *  Codac tests
+ * ----------------------------------------------------------------------------
+ *  \date       2025
+ *  \author     Simon Rohou
+ *  \copyright  Copyright 2025 Codac Team
+ *  \license    GNU Lesser General Public License (LGPL)
+ */
+
+#include <catch2/catch_test_macros.hpp>
+#include <codac2_pave.h>
+#include <codac2_CtcInverse.h>
+#include <codac2_SepInverse.h>
+#include <codac2_Subpaving.h>
+
+using namespace std;
+using namespace codac2;
+
+TEST_CASE("parallel_pave - contractor")
+{
+  VectorVar x(2);
+  AnalyticFunction f { {x}, sqr(x[0])+sqr(x[1]) };
+  CtcInverse c(f, Interval(1,2));
+  IntervalVector x0({{-3,3},{-3,3}});
+
+  auto l = pave(x0, c, 0.05).boxes(PavingOut::outer);
+  CHECK(l.size() > 1);
+
+  for(size_t n : { 1,2,4 })
+    CHECK(parallel_pave(x0, c, 0.05, n).boxes(PavingOut::outer) == l);
+}
+
+TEST_CASE("parallel_pave - separator")
+{
+  VectorVar x(2);
+  AnalyticFunction f { {x}, sqr(x[0])+sqr(x[1]) };
+  SepInverse s(f, Interval(1,2));
+  IntervalVector x0({{-3,3},{-3,3}});
+
+  auto p = pave(x0, s, 0.05);
+  auto l_inner = p.boxes(PavingInOut::inner);
+  auto l_bound = p.boxes(PavingInOut::bound);
+  CHECK(l_bound.size() > 1);
+
+  for(size_t n : { 1,2,4 })
+  {
+    auto q = parallel_pave(x0, s, 0.05, n);
+    CHECK(q.boxes(PavingInOut::inner) == l_inner);
+    CHECK(q.boxes(PavingInOut::bound) == l_bound);
+  }
+}
+
+TEST_CASE("compact_pave")
+{
+  VectorVar x(2);
+  AnalyticFunction f { {x}, sqr(x[0])+sqr(x[1]) };
+  IntervalVector x0({{-3,3},{-3,3}});
+
+  {
+    CtcInverse c(f, Interval(1,2));
+    auto p = pave(x0, c, 0.05);
+    auto q = compact_pave(x0, c, 0.05);
+    CHECK(q.boxes(CompactPavingOut::outer) == p.boxes(PavingOut::outer));
+    CHECK(q.boxes(CompactPavingOut::outer_complem) == p.boxes(PavingOut::outer_complem));
+
+    CompactPavingOut r(p);
+    CHECK(r.nb_nodes() == q.nb_nodes());
+    CHECK(r.boxes(CompactPavingOut::outer) == p.boxes(PavingOut::outer));
+  }
+
+  {
+    SepInverse s(f, Interval(1,2));
+    auto p = pave(x0, s, 0.05);
+    auto q = compact_pave(x0, s, 0.05);
+    CHECK(q.boxes(CompactPavingInOut::inner) == p.boxes(PavingInOut::inner));
+    CHECK(q.boxes(CompactPavingInOut::bound) == p.boxes(PavingInOut::bound));
+    CHECK(q.boxes(CompactPavingInOut::outer, IntervalVector({{0,1},{0,1}}))
+      == p.boxes(PavingInOut::outer, IntervalVector({{0,1},{0,1}})));
+  }
+}
+
+TEST_CASE("Paving - connected subsets")
+{
+  VectorVar x(2);
+  AnalyticFunction f { {x}, sqr(sqr(x[0])-1)+sqr(x[1]) };
+  CtcInverse c(f, Interval(0,0.2));
+
+  auto p = pave(IntervalVector({{-3,3},{-3,3}}), c, 0.02);
+  auto cs = p.connected_subsets();
+  CHECK(cs.size() == 2);
+
+  size_t n = 0;
+  for(const auto& si : cs)
+    n += si.size();
+  CHECK(n == p.boxes(PavingOut::outer).size());
+  CHECK(cs.front().box().ub()[0] < 0.);
+  CHECK(cs.back().box().lb()[0] > 0.);
+
+  cs = p.connected_subsets(IntervalVector({{0,3},{-3,3}}));
+  CHECK(cs.size() == 1);
+
+  // Equal boxes are merged into one entry of their subset
+  auto twice = [](PavingOut::Node_ n)
+  {
+    auto l = PavingOut::outer(n);
+    l.splice(l.end(), PavingOut::outer(n));
+    return l;
+  };
+
+  cs = p.connected_subsets(twice);
+  CHECK(cs.size() == 2);
+  n = 0;
+  for(const auto& si : cs)
+    n += si.size();
+  CHECK(n == p.boxes(PavingOut::outer).size());
+}
@@ -0,0 +1,84 @@
+#!/usr/bin/env python
+
+#  Codac tests
+# ----------------------------------------------------------------------------
+#  \date       2025
+#  \author     Simon Rohou
+#  \copyright  Copyright 2025 Codac Team
+#  \license    GNU Lesser General Public License (LGPL)
+
+import unittest
+from codac import *
+
+class TestPave(unittest.TestCase):
+
+  def test_parallel_pave_ctc(self):
+
+    x = VectorVar(2)
+    f = AnalyticFunction([x], sqr(x[0])+sqr(x[1]))
+    c = CtcInverse(f, Interval(1,2))
+    x0 = IntervalVector([[-3,3],[-3,3]])
+
+    l = pave(x0, c, 0.05).boxes(PavingOut.outer)
+    self.assertTrue(len(l) > 1)
+
+    for n in [1,2,4]:
+      self.assertTrue(parallel_pave(x0, c, 0.05, n).boxes(PavingOut.outer) == l)
+
+  def test_parallel_pave_sep(self):
+
+    x = VectorVar(2)
+    f = AnalyticFunction([x], sqr(x[0])+sqr(x[1]))
+    s = SepInverse(f, Interval(1,2))
+    x0 = IntervalVector([[-3,3],[-3,3]])
+
+    p = pave(x0, s, 0.05)
+    l_inner = p.boxes(PavingInOut.inner)
+    l_bound = p.boxes(PavingInOut.bound)
+    self.assertTrue(len(l_bound) > 1)
+
+    for n in [1,2,4]:
+      q = parallel_pave(x0, s, 0.05, n)
+      self.assertTrue(q.boxes(PavingInOut.inner) == l_inner)
+      self.assertTrue(q.boxes(PavingInOut.bound) == l_bound)
+
+  def test_compact_pave(self):
+
+    x = VectorVar(2)
+    f = AnalyticFunction([x], sqr(x[0])+sqr(x[1]))
+    x0 = IntervalVector([[-3,3],[-3,3]])
+
+    c = CtcInverse(f, Interval(1,2))
+    p = pave(x0, c, 0.05)
+    q = compact_pave(x0, c, 0.05)
+    self.assertTrue(q.boxes(CompactPavingOut.outer) == p.boxes(PavingOut.outer))
+    self.assertTrue(q.boxes(CompactPavingOut.outer_complem) == p.boxes(PavingOut.outer_complem))
+
+    r = CompactPavingOut(p)
+    self.assertTrue(r.nb_nodes() == q.nb_nodes())
+    self.assertTrue(r.boxes(CompactPavingOut.outer) == p.boxes(PavingOut.outer))
+
+    n = q.tree()
+    self.assertTrue(n.hull() == x0)
+    self.assertTrue(not n.top())
+    self.assertTrue(n.left().top() == n)
+
+    nb_leaves = [0]
+    def count_leaves(ni):
+      if ni.is_leaf() and not ni.boxes()[0].is_empty():
+        nb_leaves[0] += 1
+      return True
+    n.visit(count_leaves)
+    self.assertTrue(nb_leaves[0] == len(q.boxes(CompactPavingOut.outer)))
+
+    s = SepInverse(f, Interval(1,2))
+    p = pave(x0, s, 0.05)
+    q = compact_pave(x0, s, 0.05)
+    self.assertTrue(q.boxes(CompactPavingInOut.inner) == p.boxes(PavingInOut.inner))
+    self.assertTrue(q.boxes(CompactPavingInOut.bound) == p.boxes(PavingInOut.bound))
+    self.assertTrue(q.boxes(CompactPavingInOut.outer, IntervalVector([[0,1],[0,1]])) \
+      == p.boxes(PavingInOut.outer, IntervalVector([[0,1],[0,1]])))
+
+
+if __name__ ==  '__main__':
+  unittest.main()
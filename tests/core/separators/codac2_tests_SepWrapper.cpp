@@ -0,0 +1,76 @@
+/** 
+ *  Codac tests
+ * ----------------------------------------------------------------------------
+ *  \date       2025
+ *  \author     Simon Rohou
+ *  \copyright  Copyright 2025 Codac Team
+ *  \license    GNU Lesser General Public License (LGPL)
+ */
+
+#include <catch2/catch_test_macros.hpp>
+#include <codac2_SepWrapper.h>
+#include <codac2_SepInverse.h>
+#include <codac2_pave.h>
+
+using namespace std;
+using namespace codac2;
+
+// Separation computed from the lists of boxes of the paving
+BoxPair separate_from_lists(const PavingInOut& p, const IntervalVector& x)
+{
+  BoxPair result {
+    IntervalVector::empty(x.size()),
+    IntervalVector::empty(x.size())
+  };
+
+  for(const auto& b : p.boxes(PavingInOut::outer_complem, x))
+    result.inner |= b & x;
+  for(const auto& b : p.boxes(PavingInOut::inner, x))
+    result.outer |= b & x;
+  for(const auto& b : p.boxes(PavingInOut::bound, x))
+  {
+    result.inner |= b & x;
+    result.outer |= b & x;
+  }
+
+  return result;
+}
+
+TEST_CASE("SepWrapper - PavingInOut")
+{
+  VectorVar x(2);
+  AnalyticFunction f { {x}, sqr(x[0])+sqr(x[1]) };
+  SepInverse s(f, Interval(1,2));
+  IntervalVector x0({{-3,3},{-3,3}});
+
+  auto p = pave(x0, s, 0.1);
+  SepWrapper<PavingInOut> sp(p);
+
+  for(const auto& xi : {
+      x0, IntervalVector(2), IntervalVector({{-1,1},{-1,1}}),
+      IntervalVector({{0,0.5},{0,0.5}}), IntervalVector({{1.1,1.2},{-0.1,0.1}}),
+      IntervalVector({{5,6},{5,6}}), IntervalVector({{0,oo},{1,1}}),
+      IntervalVector::empty(2) })
+  {
+    auto r = sp.separate(xi);
+    auto r_ = separate_from_lists(p, xi);
+    CHECK(r.inner == r_.inner);
+    CHECK(r.outer == r_.outer);
+  }
+
+  for(double a = -3.2 ; a < 3.2 ; a += 0.37)
+    for(double b = -3.2 ; b < 3.2 ; b += 0.41)
+      for(double w : { 0.05, 0.3, 1.5 })
+      {
+        IntervalVector xi({{a,a+w},{b,b+w/2}});
+        auto r = sp.separate(xi);
+        auto r_ = separate_from_lists(p, xi);
+        CHECK(r.inner == r_.inner);
+        CHECK(r.outer == r_.outer);
+      }
+
+  // Boxes inside the ring are outer boxes only
+  auto r = sp.separate(IntervalVector({{1.1,1.2},{-0.1,0.1}}));
+  CHECK(r.inner.is_empty());
+  CHECK(r.outer == IntervalVector({{1.1,1.2},{-0.1,0.1}}));
+}
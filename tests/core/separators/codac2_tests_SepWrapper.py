@@ -0,0 +1,55 @@
+#!/usr/bin/env python
+
+#  Codac tests
+# ----------------------------------------------------------------------------
+#  \date       2025
+#  \author     Simon Rohou
+#  \copyright  Copyright 2025 Codac Team
+#  \license    GNU Lesser General Public License (LGPL)
+
+import unittest
+from codac import *
+
+# Separation computed from the lists of boxes of the paving
+def separate_from_lists(p, x):
+  inner = IntervalVector.empty(x.size())
+  outer = IntervalVector.empty(x.size())
+  for b in p.boxes(PavingInOut.outer_complem, x):
+    inner |= b & x
+  for b in p.boxes(PavingInOut.inner, x):
+    outer |= b & x
+  for b in p.boxes(PavingInOut.bound, x):
+    inner |= b & x
+    outer |= b & x
+  return inner,outer
+
+class TestSepWrapper(unittest.TestCase):
+
+  def test_SepWrapper_PavingInOut(self):
+
+    x = VectorVar(2)
+    f = AnalyticFunction([x], sqr(x[0])+sqr(x[1]))
+    s = SepInverse(f, [1,2])
+    x0 = IntervalVector([[-3,3],[-3,3]])
+
+    p = pave(x0, s, 0.1)
+    sp = SepWrapper_PavingInOut(p)
+
+    a = -3.2
+    while a < 3.2:
+      b = -3.2
+      while b < 3.2:
+        xi = IntervalVector([[a,a+0.6],[b,b+0.3]])
+        inner,outer = sp.separate(xi)
+        inner_,outer_ = separate_from_lists(p, xi)
+        self.assertTrue(inner == inner_)
+        self.assertTrue(outer == outer_)
+        b += 0.41
+      a += 0.37
+
+    inner,outer = sp.separate(IntervalVector([[1.1,1.2],[-0.1,0.1]]))
+    self.assertTrue(inner.is_empty())
+    self.assertTrue(outer == IntervalVector([[1.1,1.2],[-0.1,0.1]]))
+
+if __name__ ==  '__main__':
+  unittest.main()
@@ -0,0 +1,101 @@
+/** 
+ *  Codac tests
+ * ----------------------------------------------------------------------------
+ *  \date       2025
+ *  \author     Simon Rohou
+ *  \copyright  Copyright 2025 Codac Team
+ *  \license    GNU Lesser General Public License (LGPL)
+ */
+
+#include <catch2/catch_test_macros.hpp>
+#include <codac2_ChunkedFile.h>
+#include <codac2_AnalyticTraj.h>
+
+using namespace std;
+using namespace codac2;
+
+TEST_CASE("ChunkedFile: SampledTraj")
+{
+  ScalarVar t;
+  AnalyticFunction f({t}, vec(cos(t),sin(t)));
+  SampledTraj<Vector> x = AnalyticTraj(f,{0,10}).sampled(1e-2);
+
+  {
+    ChunkedFileWriter w("traj.cdc");
+    w.write(x);
+  }
+
+  ChunkedFileReader r("traj.cdc");
+  CHECK(r.content() == ChunkedFileContent::SAMPLED_TRAJ);
+  CHECK(r.value_type() == ChunkedFileValueType::VECTOR);
+  CHECK(r.nb_chunks() == 1);
+  CHECK(r.nb_records() == x.nb_samples());
+  CHECK(r.tdomain() == Interval(0,10));
+  CHECK(r.chunk(0).x[2] == x.values()[2]); // without copy
+
+  SampledTraj<Vector> y = r.sampled_traj<Vector>();
+  CHECK(y.times() == x.times());
+  CHECK(y.values() == x.values());
+
+  // Appending new samples while reading the file
+  size_t n = x.nb_samples();
+  x.set(Vector({0,1}), 11.);
+  x.set(Vector({2,3}), 12.);
+
+  {
+    ChunkedFileWriter w("traj.cdc", true);
+    w.write(x, n);
+  }
+
+  CHECK(r.refresh());
+  CHECK(r.nb_chunks() == 2);
+  CHECK(r.tdomain() == Interval(0,12));
+  CHECK(r.sampled_traj<Vector>().values() == x.values());
+
+  y = r.sampled_traj<Vector>({10.5,12});
+  CHECK(y.nb_samples() == 2);
+  CHECK(y.codomain() == IntervalVector({{0,2},{1,3}}));
+}
+
+TEST_CASE("ChunkedFile: SlicedTube")
+{
+  auto tdomain = create_tdomain({0,10}, 0.5, true);
+  SlicedTube x(tdomain, IntervalVector(2));
+  x.set({{0,1},{2,3}}, {1,3});
+  x.set({{-1,1},{0,0}}, 5.);
+  x.set(IntervalVector::empty(2), {8,8.5});
+
+  {
+    ChunkedFileWriter w("tube.cdc");
+    w.write(x);
+  }
+
+  ChunkedFileReader r("tube.cdc");
+  CHECK(r.content() == ChunkedFileContent::SLICED_TUBE);
+  CHECK(r.nb_records() == tdomain->nb_tslices());
+
+  // Appending the new slices of the tube while reading the file
+  size_t n = x.nb_slices();
+  tdomain->sample(12., true);
+  x.set({{2,3},{2,3}}, {10,12});
+
+  {
+    ChunkedFileWriter w("tube.cdc", true);
+    w.write(x, n);
+  }
+
+  CHECK(r.refresh());
+  CHECK(r.nb_chunks() == 2);
+  CHECK(r.nb_records() == tdomain->nb_tslices());
+  CHECK(r.tdomain() == Interval(0,12));
+
+  SlicedTube<IntervalVector> y = r.sliced_tube<IntervalVector>();
+  CHECK(y.tdomain()->nb_tslices() == tdomain->nb_tslices());
+  CHECK(y.tdomain()->all_gates_defined());
+  CHECK(y.codomain() == x.codomain());
+  CHECK(y(2.) == x(2.));
+  CHECK(y(5.) == IntervalVector({{-1,1},{0,0}}));
+  CHECK(y({8,8.5}).is_empty());
+  CHECK(y(11.) == IntervalVector({{2,3},{2,3}}));
+  CHECK(y.volume() == x.volume());
+}
@@ -0,0 +1,89 @@
+#!/usr/bin/env python
+
+#  Codac tests
+# ----------------------------------------------------------------------------
+#  \date       2025
+#  \author     Simon Rohou
+#  \copyright  Copyright 2025 Codac Team
+#  \license    GNU Lesser General Public License (LGPL)
+
+import unittest
+from codac import *
+
+class TestChunkedFile(unittest.TestCase):
+
+  def test_ChunkedFile_SampledTraj(self):
+
+    t = ScalarVar()
+    f = AnalyticFunction([t], vec(cos(t),sin(t)))
+    x = AnalyticTraj(f,[0,10]).sampled(1e-2)
+
+    w = ChunkedFileWriter("traj.cdc")
+    w.write(x)
+    del w
+
+    r = ChunkedFileReader("traj.cdc")
+    self.assertTrue(r.content() == ChunkedFileContent.SAMPLED_TRAJ)
+    self.assertTrue(r.value_type() == ChunkedFileValueType.VECTOR)
+    self.assertTrue(r.nb_chunks() == 1)
+    self.assertTrue(r.nb_records() == x.nb_samples())
+    self.assertTrue(r.tdomain() == Interval(0,10))
+
+    y = r.sampled_traj()
+    self.assertTrue(y.times() == x.times())
+    self.assertTrue(y.values() == x.values())
+
+    # Appending new samples while reading the file
+    n = x.nb_samples()
+    x.set(Vector([0,1]), 11.)
+    x.set(Vector([2,3]), 12.)
+
+    w = ChunkedFileWriter("traj.cdc", True)
+    w.write(x, n)
+    del w
+
+    self.assertTrue(r.refresh())
+    self.assertTrue(r.nb_chunks() == 2)
+    self.assertTrue(r.tdomain() == Interval(0,12))
+
+    y = r.sampled_traj(Interval(10.5,12))
+    self.assertTrue(y.nb_samples() == 2)
+    self.assertTrue(y.codomain() == IntervalVector([[0,2],[1,3]]))
+
+  def test_ChunkedFile_SlicedTube(self):
+
+    tdomain = create_tdomain([0,10], 0.5, True)
+    x = SlicedTube(tdomain, IntervalVector(2))
+    x.set([[0,1],[2,3]], [1,3])
+    x.set([[-1,1],[0,0]], 5.)
+
+    w = ChunkedFileWriter("tube.cdc")
+    w.write(x)
+    del w
+
+    r = ChunkedFileReader("tube.cdc")
+    self.assertTrue(r.content() == ChunkedFileContent.SLICED_TUBE)
+    self.assertTrue(r.nb_records() == tdomain.nb_tslices())
+
+    # Appending the new slices of the tube while reading the file
+    n = x.nb_slices()
+    tdomain.sample(12., True)
+    x.set([[2,3],[2,3]], [10,12])
+
+    w = ChunkedFileWriter("tube.cdc", True)
+    w.write(x, n)
+    del w
+
+    self.assertTrue(r.refresh())
+    self.assertTrue(r.nb_chunks() == 2)
+    self.assertTrue(r.nb_records() == tdomain.nb_tslices())
+
+    y = r.sliced_tube()
+    self.assertTrue(y.tdomain().nb_tslices() == tdomain.nb_tslices())
+    self.assertTrue(y.codomain() == x.codomain())
+    self.assertTrue(y(2.) == x(2.))
+    self.assertTrue(y(5.) == IntervalVector([[-1,1],[0,0]]))
+    self.assertTrue(y(11.) == IntervalVector([[2,3],[2,3]]))
+
+if __name__ ==  '__main__':
+  unittest.main()
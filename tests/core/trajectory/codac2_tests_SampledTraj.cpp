@@ -14,6 +14,7 @@
 #include <codac2_Approx.h>
 #include <codac2_Figure2D.h>
 #include <codac2_math.h>
+#include <codac2_CtcInverse.h>
 
 using namespace std;
 using namespace codac2;
@@ -110,6 +111,28 @@ TEST_CASE("SampledTraj as operator (nd case)")
   }
 }
 
+TEST_CASE("SampledTraj as operator (shared data)")
+{
+  ScalarVar t;
+  AnalyticFunction f { {t}, cos(t) };
+  auto x = make_shared<const SampledTraj<double>>(AnalyticTraj(f, {-PI,PI}).sampled(1e-2));
+
+  AnalyticFunction g {
+    {t},
+    AnalyticExprWrapper<ScalarType>(
+      make_shared<AnalyticOperationExpr<TrajectoryOp<SampledTraj<double>>,ScalarType,ScalarType>>(x,t))
+  };
+  CHECK(x.use_count() == 2);
+
+  // The copies of the expression share the data of the trajectory
+  AnalyticFunction h { {t}, g(t) };
+  AnalyticFunction h_copy(h);
+  CHECK(x.use_count() > 2);
+
+  for(double t_ = -PI ; t_ < PI ; t_+=1e-1)
+    CHECK(Approx(h_copy.real_eval(t_),1e-8) == cos(t_));
+}
+
 TEST_CASE("SampledTraj: operations")
 {
   ScalarVar t;
@@ -149,4 +172,142 @@ TEST_CASE("SampledTraj: derivative")
 
   for(double i = 0 ; i < 10 ; i+=1e-1)
     CHECK(Approx(p(i),1e-2) == x(i));
-}
\ No newline at end of file
+}
+TEST_CASE("SampledTraj: hull index")
+{
+  ScalarVar t;
+  AnalyticFunction f({t}, vec(cos(t),sin(3*t)));
+  SampledTraj<Vector> x = AnalyticTraj(f,{0,10}).sampled(1e-2);
+  SampledTraj<Vector> y(x);
+  y.enable_hull_index();
+  CHECK(y.has_hull_index());
+  CHECK(!x.has_hull_index());
+
+  auto check_hulls = [&]()
+  {
+    CHECK(y.codomain() == x.codomain());
+    for(const auto& ti : { Interval(0,10), Interval(0.5), Interval(1.005,1.015),
+        Interval(2.3,4.7), Interval(9.99,10), Interval(0,0.003) })
+      CHECK(y(ti) == x(ti));
+  };
+
+  check_hulls();
+
+  // New last value, modified value, new values inside the tdomain
+  for(auto& xi : { &x, &y })
+  {
+    xi->set(Vector({-1,-1}), 11.);
+    xi->set(Vector({-2,-2}), 11.);
+    CHECK(y.has_hull_index()); // updated
+    xi->set(Vector({4,0}), 3.);
+    xi->set(Vector({0,5}), 2.345);
+  }
+
+  CHECK(!y.has_hull_index()); // outdated by the insertion, built again by the next query
+  CHECK(y(Interval(2.9,3.1))[0].ub() == 4.);
+  CHECK(y.has_hull_index());
+  CHECK(y(Interval(2.34,2.35))[1].ub() == 5.);
+  CHECK(y(Interval(11.)) == IntervalVector(Vector({-2,-2})));
+  check_hulls();
+
+  for(auto& xi : { &x, &y })
+    xi->truncate_tdomain({1,5});
+  check_hulls();
+  CHECK(y.has_hull_index());
+
+  // Reading the values through non-const iterators outdates the index
+  double s = 0.;
+  for(auto&& [ti,yi] : y)
+    s += yi[0];
+  CHECK(!y.has_hull_index());
+  check_hulls();
+  CHECK(y.has_hull_index());
+
+  // The index is not copied, but built again by the copy
+  SampledTraj<Vector> z(y);
+  CHECK(!z.has_hull_index());
+  CHECK(z.codomain() == x.codomain());
+  CHECK(z.has_hull_index());
+
+  y.enable_hull_index(false);
+  CHECK(!y.has_hull_index());
+  check_hulls();
+}
+
+TEST_CASE("SampledTraj: inversion")
+{
+  SampledTraj<double> x;
+  for(const auto& [ti,xi] : vector<pair<double,double>>({ {0,0}, {1,2}, {2,1}, {3,3}, {4,0} }))
+    x.set(xi, ti);
+
+  CHECK(Approx(x.invert({1.5,2.5})) == Interval(0.75,3.5));
+  CHECK(Approx(x.invert({1.5,2.5}, {1.2,2.8})) == Interval(1.2,2.75));
+  CHECK(Approx(x.invert({3})) == Interval(3));
+  CHECK(x.invert({5,6}) == Interval::empty());
+  CHECK(Approx(x.invert({1.5,2.5}, {3,5})) == Interval(3.1666666666666667,3.5));
+  CHECK(x.invert({1.5,2.5}, Interval::empty()) == Interval::empty());
+
+  SampledTraj<Vector> y;
+  for(const auto& [ti,yi] : vector<pair<double,Vector>>({ {0,{0,0}}, {1,{2,0}}, {2,{2,2}}, {3,{0,2}} }))
+    y.set(yi, ti);
+
+  CHECK(Approx(y.invert({{1.5,2.5},{-0.5,0.5}})) == Interval(0.75,1.25));
+  CHECK(y.invert({{2.5,3},{0,2}}) == Interval::empty());
+
+  // Same inversions with the range-hull index
+  ScalarVar t;
+  SampledTraj<Vector> z = AnalyticTraj(AnalyticFunction({t}, vec(cos(t),sin(3*t))),{0,10}).sampled(1e-2);
+  SampledTraj<Vector> z_idx(z);
+  z_idx.enable_hull_index();
+  for(const auto& yi : { IntervalVector({{0.5,0.6},{-1,1}}), IntervalVector({{-0.1,0.1},{0.9,1}}),
+      IntervalVector({{0.99,1},{-0.1,0.1}}), IntervalVector({{2,3},{0,0}}), IntervalVector(2) })
+    for(const auto& ti : { Interval(0,10), Interval(2.3,4.7), Interval(5.005), Interval(9.99,10) })
+      CHECK(z_idx.invert(yi, ti) == z.invert(yi, ti));
+
+  // Contraction of the time through the trajectory as operator
+  AnalyticFunction f { {t}, x.as_function()(t) };
+  CtcInverse<Interval,Interval> c(f, Interval(1.5,2.5));
+  Interval t0(0,4);
+  c.contract(t0);
+  CHECK(Approx(t0) == Interval(0.75,3.5));
+}
+
+TEST_CASE("SampledTraj: columnar storage")
+{
+  SampledTraj<Vector> x;
+  x.reserve(4);
+  x.set(Vector({1,2}), 1.);
+  x.set(Vector({3,4}), 3.);
+  x.set(Vector({5,6}), 2.); // inserted between the two first samples
+  x.set(Vector({7,8}), 3.); // modified value
+
+  CHECK(x.nb_samples() == 3);
+  CHECK(x.size() == 2);
+  CHECK(x.times() == vector<double>({1,2,3}));
+  CHECK(x.values() == vector<double>({1,2,5,6,7,8}));
+  CHECK(x.at(2.) == Vector({5,6}));
+  CHECK(x.rbegin()->first == 3.);
+  CHECK(x.lower_bound(1.5)->first == 2.);
+  CHECK(x(2.5) == Vector({6,7}));
+
+  // Values modified through the iterators
+  x.enable_hull_index();
+  for(auto&& [ti,xi] : x)
+    xi *= 2.;
+  CHECK(!x.has_hull_index());
+  CHECK(x.codomain() == IntervalVector({{2,14},{4,16}}));
+  x.set(Vector({0,0}), 4.);
+  CHECK(x.has_hull_index());
+  CHECK(x.codomain() == IntervalVector({{0,14},{0,16}}));
+
+  x.erase(x.begin());
+  CHECK(x.tdomain() == Interval(2,4));
+  CHECK(x.codomain() == IntervalVector({{0,14},{0,16}}));
+
+  // Component-wise operations
+  SampledTraj<Vector> y = 2.*x - x/2.;
+  CHECK(y.times() == x.times());
+  CHECK(y.at(3.) == Vector({21,24}));
+  CHECK(x[1].values() == vector<double>({12,16,0}));
+  CHECK(x.subvector(0,0).values() == vector<double>({10,14,0}));
+}
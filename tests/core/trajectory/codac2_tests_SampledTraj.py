@@ -131,5 +131,106 @@ class TestSampledTraj(unittest.TestCase):
     for i in np.arange(0, 10, 1e-1):
       self.assertTrue(Approx(p(i),1e-2) == x(i))
 
+  def test_SampledTraj_hull_index(self):
+
+    t = ScalarVar()
+    f = AnalyticFunction([t], vec(cos(t),sin(3*t)))
+    x = AnalyticTraj(f,[0,10]).sampled(1e-2)
+    y = AnalyticTraj(f,[0,10]).sampled(1e-2)
+    y.enable_hull_index()
+    self.assertTrue(y.has_hull_index())
+    self.assertTrue(not x.has_hull_index())
+
+    def check_hulls():
+      self.assertTrue(y.codomain() == x.codomain())
+      for ti in [ Interval(0,10), Interval(0.5), Interval(1.005,1.015),
+          Interval(2.3,4.7), Interval(9.99,10), Interval(0,0.003) ]:
+        self.assertTrue(y(ti) == x(ti))
+
+    check_hulls()
+
+    # New last value, modified value, new values inside the tdomain
+    for xi in [x,y]:
+      xi.set(Vector([-1,-1]), 11.)
+      xi.set(Vector([-2,-2]), 11.)
+      self.assertTrue(y.has_hull_index()) # updated
+      xi.set(Vector([4,0]), 3.)
+      xi.set(Vector([0,5]), 2.345)
+
+    self.assertTrue(not y.has_hull_index()) # outdated by the insertion, built again by the next query
+    self.assertTrue(y(Interval(2.9,3.1))[0].ub() == 4.)
+    self.assertTrue(y.has_hull_index())
+    self.assertTrue(y(Interval(2.34,2.35))[1].ub() == 5.)
+    self.assertTrue(y(Interval(11.)) == IntervalVector(Vector([-2,-2])))
+    check_hulls()
+
+    for xi in [x,y]:
+      xi.truncate_tdomain(Interval(1,5))
+    check_hulls()
+    self.assertTrue(y.has_hull_index())
+
+    y.enable_hull_index(False)
+    self.assertTrue(not y.has_hull_index())
+    check_hulls()
+
+  def test_SampledTraj_inversion(self):
+
+    x = SampledScalarTraj()
+    for ti,xi in [ (0,0), (1,2), (2,1), (3,3), (4,0) ]:
+      x.set(xi, ti)
+
+    self.assertTrue(Approx(x.invert(Interval(1.5,2.5))) == Interval(0.75,3.5))
+    self.assertTrue(Approx(x.invert(Interval(1.5,2.5), Interval(1.2,2.8))) == Interval(1.2,2.75))
+    self.assertTrue(Approx(x.invert(Interval(3))) == Interval(3))
+    self.assertTrue(x.invert(Interval(5,6)) == Interval.empty())
+    self.assertTrue(Approx(x.invert(Interval(1.5,2.5), Interval(3,5))) == Interval(3.1666666666666667,3.5))
+    self.assertTrue(x.invert(Interval(1.5,2.5), Interval.empty()) == Interval.empty())
+
+    y = SampledVectorTraj()
+    for ti,yi in [ (0,[0,0]), (1,[2,0]), (2,[2,2]), (3,[0,2]) ]:
+      y.set(Vector(yi), ti)
+
+    self.assertTrue(Approx(y.invert(IntervalVector([[1.5,2.5],[-0.5,0.5]]))) == Interval(0.75,1.25))
+    self.assertTrue(y.invert(IntervalVector([[2.5,3],[0,2]])) == Interval.empty())
+
+    # Same inversions with the range-hull index
+    t = ScalarVar()
+    z = AnalyticTraj(AnalyticFunction([t], vec(cos(t),sin(3*t))),[0,10]).sampled(1e-2)
+    z_idx = AnalyticTraj(AnalyticFunction([t], vec(cos(t),sin(3*t))),[0,10]).sampled(1e-2)
+    z_idx.enable_hull_index()
+    for yi in [ IntervalVector([[0.5,0.6],[-1,1]]), IntervalVector([[-0.1,0.1],[0.9,1]]),
+        IntervalVector([[0.99,1],[-0.1,0.1]]), IntervalVector([[2,3],[0,0]]), IntervalVector(2) ]:
+      for ti in [ Interval(0,10), Interval(2.3,4.7), Interval(5.005), Interval(9.99,10) ]:
+        self.assertTrue(z_idx.invert(yi, ti) == z.invert(yi, ti))
+
+    # Contraction of the time through the trajectory as operator
+    b = VectorVar(1)
+    f = AnalyticFunction([b], x.as_function()(b[0]))
+    c = CtcInverse(f, Interval(1.5,2.5))
+    t0 = IntervalVector([[0,4]])
+    c.contract(t0)
+    self.assertTrue(Approx(t0) == IntervalVector([[0.75,3.5]]))
+
+  def test_SampledTraj_columnar_storage(self):
+
+    x = SampledVectorTraj()
+    x.reserve(4)
+    x.set(Vector([1,2]), 1.)
+    x.set(Vector([3,4]), 3.)
+    x.set(Vector([5,6]), 2.) # inserted between the two first samples
+    x.set(Vector([7,8]), 3.) # modified value
+
+    self.assertTrue(x.nb_samples() == 3)
+    self.assertTrue(x.size() == 2)
+    self.assertTrue(x.times() == [1,2,3])
+    self.assertTrue(x.values() == [1,2,5,6,7,8])
+    self.assertTrue([ti for ti,xi in x] == [1,2,3])
+    self.assertTrue(x(2.5) == Vector([6,7]))
+
+    y = 2.*x - x/2.
+    self.assertTrue(y.times() == x.times())
+    self.assertTrue(y(3.) == Vector([10.5,12]))
+    self.assertTrue(x[1].values() == [2,6,8])
+
 if __name__ ==  '__main__':
   unittest.main()
\ No newline at end of file
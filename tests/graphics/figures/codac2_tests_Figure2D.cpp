@@ -0,0 +1,70 @@
+/**
+ *  Codac tests
+ * ----------------------------------------------------------------------------
+ *  \date       2025
+ *  \author     Simon Rohou
+ *  \copyright  Copyright 2025 Codac Team
+ *  \license    GNU Lesser General Public License (LGPL)
+ */
+
+#include <catch2/catch_test_macros.hpp>
+#include <codac2_Figure2D.h>
+#include <codac2_SlicedTube.h>
+#include <codac2_CtcInverse.h>
+#include <codac2_pave.h>
+
+using namespace std;
+using namespace codac2;
+
+TEST_CASE("Figure2D - level of detail")
+{
+  Figure2D fig("lod", (GraphicOutput)0); // no output
+  fig.set_axes(axis(0,{0,100}), axis(1,{0,100}));
+  CHECK(fig.lod_tolerance() == 0.);
+
+  SECTION("Tube")
+  {
+    auto td = create_tdomain({0,100},1.,false);
+    SlicedTube x(td, IntervalVector(2));
+    CHECK(x.nb_slices() == 100);
+
+    // Slices drifting by 0.3 along the first axis
+    Index k = 0;
+    for(auto& s : x)
+    {
+      s.set({{0.3*k,0.3*k+1},{0,1}}, false);
+      k++;
+    }
+
+    fig.draw_tube(x, StyleProperties());
+    CHECK(fig.nb_lod_suppressed_shapes() == 0);
+
+    fig.set_lod_tolerance(7.); // 700x700 window: resolution of 1 along each axis
+    fig.draw_tube(x, StyleProperties());
+    // Groups of 4 slices: the hull of 5 consecutive slices would drift by 1.2
+    CHECK(fig.nb_lod_suppressed_shapes() == 75);
+
+    x.set({{0,1},{0,1}});
+    fig.draw_tube(x, StyleProperties());
+    CHECK(fig.nb_lod_suppressed_shapes() == 99);
+
+    fig.set_lod_tolerance(0.);
+    fig.draw_tube(x, StyleProperties());
+    CHECK(fig.nb_lod_suppressed_shapes() == 0);
+  }
+
+  SECTION("Paving")
+  {
+    VectorVar v(2);
+    AnalyticFunction f({v}, sqr(v[0])+sqr(v[1]));
+    auto p = pave({{-3,3},{-3,3}}, CtcInverse(f,Interval(1,2)), 0.01);
+    fig.set_axes(axis(0,{-3,3}), axis(1,{-3,3}));
+
+    fig.draw_paving(p);
+    CHECK(fig.nb_lod_suppressed_shapes() == 0);
+
+    fig.set_lod_tolerance(5.);
+    fig.draw_paving(p);
+    CHECK(fig.nb_lod_suppressed_shapes() > 0);
+  }
+}
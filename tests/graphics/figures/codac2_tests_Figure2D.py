@@ -0,0 +1,64 @@
+#!/usr/bin/env python
+
+#  Codac tests
+# ----------------------------------------------------------------------------
+#  \date       2025
+#  \author     Simon Rohou
+#  \copyright  Copyright 2025 Codac Team
+#  \license    GNU Lesser General Public License (LGPL)
+
+import unittest
+from codac import *
+
+
+class TestFigure2D(unittest.TestCase):
+  
+  def test_Figure2D_lod_tube(self):
+
+    fig = Figure2D("lod", GraphicOutput(0)) # no output
+    fig.set_axes(axis(0,[0,100]), axis(1,[0,100]))
+    self.assertTrue(fig.lod_tolerance() == 0.)
+
+    td = create_tdomain([0,100],1.,False)
+    x = SlicedTube(td, IntervalVector(2))
+    self.assertTrue(x.nb_slices() == 100)
+
+    # Slices drifting by 0.3 along the first axis
+    for k,s in enumerate(x):
+      s.set(IntervalVector([[0.3*k,0.3*k+1],[0,1]]), False)
+
+    fig.draw_tube(x, StyleProperties())
+    self.assertTrue(fig.nb_lod_suppressed_shapes() == 0)
+
+    fig.set_lod_tolerance(7.) # 700x700 window: resolution of 1 along each axis
+    fig.draw_tube(x, StyleProperties())
+    # Groups of 4 slices: the hull of 5 consecutive slices would drift by 1.2
+    self.assertTrue(fig.nb_lod_suppressed_shapes() == 75)
+
+    x.set(IntervalVector([[0,1],[0,1]]))
+    fig.draw_tube(x, StyleProperties())
+    self.assertTrue(fig.nb_lod_suppressed_shapes() == 99)
+
+    fig.set_lod_tolerance(0.)
+    fig.draw_tube(x, StyleProperties())
+    self.assertTrue(fig.nb_lod_suppressed_shapes() == 0)
+
+  def test_Figure2D_lod_paving(self):
+
+    fig = Figure2D("lod", GraphicOutput(0))
+    fig.set_axes(axis(0,[-3,3]), axis(1,[-3,3]))
+
+    v = VectorVar(2)
+    f = AnalyticFunction([v], sqr(v[0])+sqr(v[1]))
+    p = pave(IntervalVector([[-3,3],[-3,3]]), CtcInverse(f,[1,2]), 0.01)
+
+    fig.draw_paving(p)
+    self.assertTrue(fig.nb_lod_suppressed_shapes() == 0)
+
+    fig.set_lod_tolerance(5.)
+    fig.draw_paving(p)
+    self.assertTrue(fig.nb_lod_suppressed_shapes() > 0)
+
+
+if __name__ ==  '__main__':
+  unittest.main()